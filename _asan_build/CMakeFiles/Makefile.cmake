@@ -0,0 +1,151 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CheckAtomic.cmake"
+  "/root/repo/cmake/FindCrypto.cmake"
+  "/root/repo/cmake/FindCurl.cmake"
+  "/root/repo/cmake/FindFreetype.cmake"
+  "/root/repo/cmake/FindGLEW.cmake"
+  "/root/repo/cmake/FindNotify.cmake"
+  "/root/repo/cmake/FindOgg.cmake"
+  "/root/repo/cmake/FindOpus.cmake"
+  "/root/repo/cmake/FindOpusfile.cmake"
+  "/root/repo/cmake/FindPNG.cmake"
+  "/root/repo/cmake/FindRust.cmake"
+  "/root/repo/cmake/FindSDL2.cmake"
+  "/root/repo/cmake/FindSQLite3.cmake"
+  "/root/repo/cmake/FindSSP.cmake"
+  "/root/repo/cmake/FindWavpack.cmake"
+  "/root/repo/cmake/FindZLIB.cmake"
+  "/root/repo/cmake/checksummed_extra.txt"
+  "/root/repo/src/game/version.h"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGLEW.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindSQLite3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "checksummed_extra.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/glew.dir/DependInfo.cmake"
+  "CMakeFiles/wavpack.dir/DependInfo.cmake"
+  "CMakeFiles/json.dir/DependInfo.cmake"
+  "CMakeFiles/md5.dir/DependInfo.cmake"
+  "CMakeFiles/rust-bridge-shared.dir/DependInfo.cmake"
+  "CMakeFiles/rust_engine_shared_target.dir/DependInfo.cmake"
+  "CMakeFiles/engine-gfx.dir/DependInfo.cmake"
+  "CMakeFiles/engine-shared.dir/DependInfo.cmake"
+  "CMakeFiles/game-shared.dir/DependInfo.cmake"
+  "CMakeFiles/game-server.dir/DependInfo.cmake"
+  "CMakeFiles/DDNet-Server.dir/DependInfo.cmake"
+  "CMakeFiles/config_retrieve.dir/DependInfo.cmake"
+  "CMakeFiles/config_store.dir/DependInfo.cmake"
+  "CMakeFiles/crapnet.dir/DependInfo.cmake"
+  "CMakeFiles/demo_extract_chat.dir/DependInfo.cmake"
+  "CMakeFiles/dilate.dir/DependInfo.cmake"
+  "CMakeFiles/dummy_map.dir/DependInfo.cmake"
+  "CMakeFiles/loadgen.dir/DependInfo.cmake"
+  "CMakeFiles/map_convert_07.dir/DependInfo.cmake"
+  "CMakeFiles/map_create_pixelart.dir/DependInfo.cmake"
+  "CMakeFiles/map_diff.dir/DependInfo.cmake"
+  "CMakeFiles/map_extract.dir/DependInfo.cmake"
+  "CMakeFiles/map_find_env.dir/DependInfo.cmake"
+  "CMakeFiles/map_optimize.dir/DependInfo.cmake"
+  "CMakeFiles/map_replace_area.dir/DependInfo.cmake"
+  "CMakeFiles/map_replace_image.dir/DependInfo.cmake"
+  "CMakeFiles/map_resave.dir/DependInfo.cmake"
+  "CMakeFiles/packetgen.dir/DependInfo.cmake"
+  "CMakeFiles/stun.dir/DependInfo.cmake"
+  "CMakeFiles/teehistorian_extract.dir/DependInfo.cmake"
+  "CMakeFiles/twping.dir/DependInfo.cmake"
+  "CMakeFiles/unicode_confusables.dir/DependInfo.cmake"
+  "CMakeFiles/uuid.dir/DependInfo.cmake"
+  "CMakeFiles/tools.dir/DependInfo.cmake"
+  "CMakeFiles/everything.dir/DependInfo.cmake"
+  "CMakeFiles/testrunner.dir/DependInfo.cmake"
+  "CMakeFiles/run_cxx_tests.dir/DependInfo.cmake"
+  "CMakeFiles/run_tests.dir/DependInfo.cmake"
+  "CMakeFiles/rust_test.dir/DependInfo.cmake"
+  "CMakeFiles/run_rust_tests.dir/DependInfo.cmake"
+  "CMakeFiles/run_integration_tests.dir/DependInfo.cmake"
+  "CMakeFiles/run_replay_tests.dir/DependInfo.cmake"
+  "CMakeFiles/package_zip.dir/DependInfo.cmake"
+  "CMakeFiles/package_tar_gz.dir/DependInfo.cmake"
+  "CMakeFiles/package_tar_xz.dir/DependInfo.cmake"
+  "CMakeFiles/package_default.dir/DependInfo.cmake"
+  "CMakeFiles/package_all.dir/DependInfo.cmake"
+  )
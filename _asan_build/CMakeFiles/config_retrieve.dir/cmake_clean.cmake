@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/config_retrieve.dir/src/tools/config_retrieve.cpp.o"
+  "CMakeFiles/config_retrieve.dir/src/tools/config_retrieve.cpp.o.d"
+  "config_retrieve"
+  "config_retrieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/config_retrieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/config_store.dir/src/tools/config_store.cpp.o"
+  "CMakeFiles/config_store.dir/src/tools/config_store.cpp.o.d"
+  "config_store"
+  "config_store.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/config_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crapnet.dir/src/tools/crapnet.cpp.o"
+  "CMakeFiles/crapnet.dir/src/tools/crapnet.cpp.o.d"
+  "crapnet"
+  "crapnet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/crapnet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
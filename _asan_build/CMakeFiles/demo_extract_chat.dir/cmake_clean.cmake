@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo_extract_chat.dir/src/tools/demo_extract_chat.cpp.o"
+  "CMakeFiles/demo_extract_chat.dir/src/tools/demo_extract_chat.cpp.o.d"
+  "demo_extract_chat"
+  "demo_extract_chat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/demo_extract_chat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
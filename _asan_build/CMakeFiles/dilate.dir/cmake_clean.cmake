@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dilate.dir/src/tools/dilate.cpp.o"
+  "CMakeFiles/dilate.dir/src/tools/dilate.cpp.o.d"
+  "dilate"
+  "dilate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dilate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/gfx/image.cpp" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image.cpp.o" "gcc" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image.cpp.o.d"
+  "/root/repo/src/engine/gfx/image_loader.cpp" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_loader.cpp.o" "gcc" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_loader.cpp.o.d"
+  "/root/repo/src/engine/gfx/image_manipulation.cpp" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_manipulation.cpp.o" "gcc" "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_manipulation.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
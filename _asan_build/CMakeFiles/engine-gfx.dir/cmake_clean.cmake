@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image.cpp.o"
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image.cpp.o.d"
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_loader.cpp.o"
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_loader.cpp.o.d"
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_manipulation.cpp.o"
+  "CMakeFiles/engine-gfx.dir/src/engine/gfx/image_manipulation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine-gfx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,80 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/base/bezier.cpp" "CMakeFiles/engine-shared.dir/src/base/bezier.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/bezier.cpp.o.d"
+  "/root/repo/src/base/color.cpp" "CMakeFiles/engine-shared.dir/src/base/color.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/color.cpp.o.d"
+  "/root/repo/src/base/hash.cpp" "CMakeFiles/engine-shared.dir/src/base/hash.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/hash.cpp.o.d"
+  "/root/repo/src/base/hash_bundled.cpp" "CMakeFiles/engine-shared.dir/src/base/hash_bundled.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/hash_bundled.cpp.o.d"
+  "/root/repo/src/base/hash_libtomcrypt.cpp" "CMakeFiles/engine-shared.dir/src/base/hash_libtomcrypt.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/hash_libtomcrypt.cpp.o.d"
+  "/root/repo/src/base/hash_openssl.cpp" "CMakeFiles/engine-shared.dir/src/base/hash_openssl.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/hash_openssl.cpp.o.d"
+  "/root/repo/src/base/log.cpp" "CMakeFiles/engine-shared.dir/src/base/log.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/log.cpp.o.d"
+  "/root/repo/src/base/system.cpp" "CMakeFiles/engine-shared.dir/src/base/system.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/system.cpp.o.d"
+  "/root/repo/src/base/unicode/confusables.cpp" "CMakeFiles/engine-shared.dir/src/base/unicode/confusables.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/unicode/confusables.cpp.o.d"
+  "/root/repo/src/base/unicode/tolower.cpp" "CMakeFiles/engine-shared.dir/src/base/unicode/tolower.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/base/unicode/tolower.cpp.o.d"
+  "/root/repo/src/engine/shared/assertion_logger.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/assertion_logger.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/assertion_logger.cpp.o.d"
+  "/root/repo/src/engine/shared/async_file_writer.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/async_file_writer.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/async_file_writer.cpp.o.d"
+  "/root/repo/src/engine/shared/compression.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/compression.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/compression.cpp.o.d"
+  "/root/repo/src/engine/shared/config.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/config.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/config.cpp.o.d"
+  "/root/repo/src/engine/shared/console.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/console.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/console.cpp.o.d"
+  "/root/repo/src/engine/shared/csv.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/csv.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/csv.cpp.o.d"
+  "/root/repo/src/engine/shared/datafile.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/datafile.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/datafile.cpp.o.d"
+  "/root/repo/src/engine/shared/demo.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/demo.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/demo.cpp.o.d"
+  "/root/repo/src/engine/shared/econ.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/econ.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/econ.cpp.o.d"
+  "/root/repo/src/engine/shared/engine.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/engine.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/engine.cpp.o.d"
+  "/root/repo/src/engine/shared/fifo.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/fifo.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/fifo.cpp.o.d"
+  "/root/repo/src/engine/shared/filecollection.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/filecollection.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/filecollection.cpp.o.d"
+  "/root/repo/src/engine/shared/global_uuid_manager.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/global_uuid_manager.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/global_uuid_manager.cpp.o.d"
+  "/root/repo/src/engine/shared/host_lookup.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/host_lookup.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/host_lookup.cpp.o.d"
+  "/root/repo/src/engine/shared/http.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/http.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/http.cpp.o.d"
+  "/root/repo/src/engine/shared/huffman.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/huffman.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/huffman.cpp.o.d"
+  "/root/repo/src/engine/shared/jobs.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/jobs.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/jobs.cpp.o.d"
+  "/root/repo/src/engine/shared/json.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/json.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/json.cpp.o.d"
+  "/root/repo/src/engine/shared/jsonwriter.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/jsonwriter.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/jsonwriter.cpp.o.d"
+  "/root/repo/src/engine/shared/kernel.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/kernel.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/kernel.cpp.o.d"
+  "/root/repo/src/engine/shared/linereader.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/linereader.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/linereader.cpp.o.d"
+  "/root/repo/src/engine/shared/map.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/map.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/map.cpp.o.d"
+  "/root/repo/src/engine/shared/masterserver.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/masterserver.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/masterserver.cpp.o.d"
+  "/root/repo/src/engine/shared/memheap.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/memheap.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/memheap.cpp.o.d"
+  "/root/repo/src/engine/shared/netban.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/netban.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/netban.cpp.o.d"
+  "/root/repo/src/engine/shared/network.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network.cpp.o.d"
+  "/root/repo/src/engine/shared/network_client.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_client.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_client.cpp.o.d"
+  "/root/repo/src/engine/shared/network_conn.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_conn.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_conn.cpp.o.d"
+  "/root/repo/src/engine/shared/network_console.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_console.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_console.cpp.o.d"
+  "/root/repo/src/engine/shared/network_console_conn.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_console_conn.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_console_conn.cpp.o.d"
+  "/root/repo/src/engine/shared/network_recv_thread.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_recv_thread.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_recv_thread.cpp.o.d"
+  "/root/repo/src/engine/shared/network_server.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_server.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_server.cpp.o.d"
+  "/root/repo/src/engine/shared/network_stun.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/network_stun.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/network_stun.cpp.o.d"
+  "/root/repo/src/engine/shared/packer.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/packer.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/packer.cpp.o.d"
+  "/root/repo/src/engine/shared/protocol_ex.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/protocol_ex.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/protocol_ex.cpp.o.d"
+  "/root/repo/src/engine/shared/protocolglue.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/protocolglue.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/protocolglue.cpp.o.d"
+  "/root/repo/src/engine/shared/ringbuffer.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/ringbuffer.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/ringbuffer.cpp.o.d"
+  "/root/repo/src/engine/shared/serverinfo.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/serverinfo.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/serverinfo.cpp.o.d"
+  "/root/repo/src/engine/shared/sixup_translate_snapshot.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/sixup_translate_snapshot.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/sixup_translate_snapshot.cpp.o.d"
+  "/root/repo/src/engine/shared/snapshot.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/snapshot.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/snapshot.cpp.o.d"
+  "/root/repo/src/engine/shared/storage.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/storage.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/storage.cpp.o.d"
+  "/root/repo/src/engine/shared/stun.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/stun.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/stun.cpp.o.d"
+  "/root/repo/src/engine/shared/teehistorian_ex.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_ex.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_ex.cpp.o.d"
+  "/root/repo/src/engine/shared/teehistorian_reader.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_reader.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_reader.cpp.o.d"
+  "/root/repo/src/engine/shared/translation_context.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/translation_context.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/translation_context.cpp.o.d"
+  "/root/repo/src/engine/shared/uuid_manager.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/uuid_manager.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/uuid_manager.cpp.o.d"
+  "/root/repo/src/engine/shared/video.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/video.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/video.cpp.o.d"
+  "/root/repo/src/engine/shared/websockets.cpp" "CMakeFiles/engine-shared.dir/src/engine/shared/websockets.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/engine/shared/websockets.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/protocol.cpp" "CMakeFiles/engine-shared.dir/src/game/generated/protocol.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/game/generated/protocol.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/protocol7.cpp" "CMakeFiles/engine-shared.dir/src/game/generated/protocol7.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/game/generated/protocol7.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/protocolglue.cpp" "CMakeFiles/engine-shared.dir/src/game/generated/protocolglue.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/game/generated/protocolglue.cpp.o.d"
+  "/root/repo/src/game/mapitems_ex.cpp" "CMakeFiles/engine-shared.dir/src/game/mapitems_ex.cpp.o" "gcc" "CMakeFiles/engine-shared.dir/src/game/mapitems_ex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,137 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine-shared.dir/src/base/bezier.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/bezier.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/color.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/color.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/hash.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/hash.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/hash_bundled.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/hash_bundled.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/hash_libtomcrypt.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/hash_libtomcrypt.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/hash_openssl.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/hash_openssl.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/log.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/log.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/system.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/system.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/unicode/confusables.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/unicode/confusables.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/base/unicode/tolower.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/base/unicode/tolower.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/assertion_logger.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/assertion_logger.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/async_file_writer.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/async_file_writer.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/compression.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/compression.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/config.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/config.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/console.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/console.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/csv.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/csv.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/datafile.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/datafile.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/demo.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/demo.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/econ.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/econ.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/engine.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/engine.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/fifo.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/fifo.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/filecollection.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/filecollection.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/global_uuid_manager.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/global_uuid_manager.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/host_lookup.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/host_lookup.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/http.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/http.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/huffman.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/huffman.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/jobs.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/jobs.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/json.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/json.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/jsonwriter.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/jsonwriter.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/kernel.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/kernel.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/linereader.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/linereader.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/map.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/map.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/masterserver.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/masterserver.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/memheap.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/memheap.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/netban.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/netban.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_client.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_client.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_conn.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_conn.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_console.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_console.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_console_conn.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_console_conn.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_recv_thread.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_recv_thread.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_server.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_server.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_stun.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/network_stun.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/packer.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/packer.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/protocol_ex.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/protocol_ex.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/protocolglue.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/protocolglue.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/ringbuffer.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/ringbuffer.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/serverinfo.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/serverinfo.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/sixup_translate_snapshot.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/sixup_translate_snapshot.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/snapshot.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/snapshot.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/storage.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/storage.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/stun.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/stun.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_ex.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_ex.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_reader.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/teehistorian_reader.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/translation_context.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/translation_context.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/uuid_manager.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/uuid_manager.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/video.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/video.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/websockets.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/engine/shared/websockets.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocol.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocol.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocol7.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocol7.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocolglue.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/game/generated/protocolglue.cpp.o.d"
+  "CMakeFiles/engine-shared.dir/src/game/mapitems_ex.cpp.o"
+  "CMakeFiles/engine-shared.dir/src/game/mapitems_ex.cpp.o.d"
+  "src/game/generated/protocol.cpp"
+  "src/game/generated/protocol.h"
+  "src/game/generated/protocol7.cpp"
+  "src/game/generated/protocol7.h"
+  "src/game/generated/protocolglue.cpp"
+  "src/game/generated/protocolglue.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
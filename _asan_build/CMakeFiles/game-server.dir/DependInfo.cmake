@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/server/antibot.cpp" "CMakeFiles/game-server.dir/src/engine/server/antibot.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/antibot.cpp.o.d"
+  "/root/repo/src/engine/server/authmanager.cpp" "CMakeFiles/game-server.dir/src/engine/server/authmanager.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/authmanager.cpp.o.d"
+  "/root/repo/src/engine/server/databases/connection.cpp" "CMakeFiles/game-server.dir/src/engine/server/databases/connection.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/databases/connection.cpp.o.d"
+  "/root/repo/src/engine/server/databases/connection_pool.cpp" "CMakeFiles/game-server.dir/src/engine/server/databases/connection_pool.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/databases/connection_pool.cpp.o.d"
+  "/root/repo/src/engine/server/databases/mysql.cpp" "CMakeFiles/game-server.dir/src/engine/server/databases/mysql.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "/root/repo/src/engine/server/databases/sqlite.cpp" "CMakeFiles/game-server.dir/src/engine/server/databases/sqlite.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "/root/repo/src/engine/server/main.cpp" "CMakeFiles/game-server.dir/src/engine/server/main.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/main.cpp.o.d"
+  "/root/repo/src/engine/server/name_ban.cpp" "CMakeFiles/game-server.dir/src/engine/server/name_ban.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/name_ban.cpp.o.d"
+  "/root/repo/src/engine/server/register.cpp" "CMakeFiles/game-server.dir/src/engine/server/register.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/register.cpp.o.d"
+  "/root/repo/src/engine/server/server.cpp" "CMakeFiles/game-server.dir/src/engine/server/server.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/server.cpp.o.d"
+  "/root/repo/src/engine/server/server_logger.cpp" "CMakeFiles/game-server.dir/src/engine/server/server_logger.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/server_logger.cpp.o.d"
+  "/root/repo/src/engine/server/snap_id_pool.cpp" "CMakeFiles/game-server.dir/src/engine/server/snap_id_pool.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/snap_id_pool.cpp.o.d"
+  "/root/repo/src/engine/server/snapshot_bandwidth.cpp" "CMakeFiles/game-server.dir/src/engine/server/snapshot_bandwidth.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/snapshot_bandwidth.cpp.o.d"
+  "/root/repo/src/engine/server/snapshot_workers.cpp" "CMakeFiles/game-server.dir/src/engine/server/snapshot_workers.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/snapshot_workers.cpp.o.d"
+  "/root/repo/src/engine/server/sql_string_helpers.cpp" "CMakeFiles/game-server.dir/src/engine/server/sql_string_helpers.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "/root/repo/src/engine/server/teehistorian_replay.cpp" "CMakeFiles/game-server.dir/src/engine/server/teehistorian_replay.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/teehistorian_replay.cpp.o.d"
+  "/root/repo/src/engine/server/tick_profiler.cpp" "CMakeFiles/game-server.dir/src/engine/server/tick_profiler.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/tick_profiler.cpp.o.d"
+  "/root/repo/src/engine/server/upnp.cpp" "CMakeFiles/game-server.dir/src/engine/server/upnp.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/engine/server/upnp.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/server_data.cpp" "CMakeFiles/game-server.dir/src/game/generated/server_data.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/generated/server_data.cpp.o.d"
+  "/root/repo/src/game/server/ddracechat.cpp" "CMakeFiles/game-server.dir/src/game/server/ddracechat.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/ddracechat.cpp.o.d"
+  "/root/repo/src/game/server/ddracecommands.cpp" "CMakeFiles/game-server.dir/src/game/server/ddracecommands.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/ddracecommands.cpp.o.d"
+  "/root/repo/src/game/server/entities/character.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/character.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/character.cpp.o.d"
+  "/root/repo/src/game/server/entities/door.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/door.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/door.cpp.o.d"
+  "/root/repo/src/game/server/entities/dragger.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/dragger.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/dragger.cpp.o.d"
+  "/root/repo/src/game/server/entities/dragger_beam.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/dragger_beam.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/dragger_beam.cpp.o.d"
+  "/root/repo/src/game/server/entities/gun.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/gun.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/gun.cpp.o.d"
+  "/root/repo/src/game/server/entities/laser.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/laser.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/laser.cpp.o.d"
+  "/root/repo/src/game/server/entities/light.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/light.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/light.cpp.o.d"
+  "/root/repo/src/game/server/entities/pickup.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/pickup.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/pickup.cpp.o.d"
+  "/root/repo/src/game/server/entities/plasma.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/plasma.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/plasma.cpp.o.d"
+  "/root/repo/src/game/server/entities/projectile.cpp" "CMakeFiles/game-server.dir/src/game/server/entities/projectile.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entities/projectile.cpp.o.d"
+  "/root/repo/src/game/server/entity.cpp" "CMakeFiles/game-server.dir/src/game/server/entity.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/entity.cpp.o.d"
+  "/root/repo/src/game/server/event_index.cpp" "CMakeFiles/game-server.dir/src/game/server/event_index.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/event_index.cpp.o.d"
+  "/root/repo/src/game/server/eventhandler.cpp" "CMakeFiles/game-server.dir/src/game/server/eventhandler.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/eventhandler.cpp.o.d"
+  "/root/repo/src/game/server/gamecontext.cpp" "CMakeFiles/game-server.dir/src/game/server/gamecontext.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/gamecontext.cpp.o.d"
+  "/root/repo/src/game/server/gamecontroller.cpp" "CMakeFiles/game-server.dir/src/game/server/gamecontroller.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/gamecontroller.cpp.o.d"
+  "/root/repo/src/game/server/gamemodes/DDRace.cpp" "CMakeFiles/game-server.dir/src/game/server/gamemodes/DDRace.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/gamemodes/DDRace.cpp.o.d"
+  "/root/repo/src/game/server/gamemodes/mod.cpp" "CMakeFiles/game-server.dir/src/game/server/gamemodes/mod.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/gamemodes/mod.cpp.o.d"
+  "/root/repo/src/game/server/gameworld.cpp" "CMakeFiles/game-server.dir/src/game/server/gameworld.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/gameworld.cpp.o.d"
+  "/root/repo/src/game/server/player.cpp" "CMakeFiles/game-server.dir/src/game/server/player.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/player.cpp.o.d"
+  "/root/repo/src/game/server/save.cpp" "CMakeFiles/game-server.dir/src/game/server/save.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/save.cpp.o.d"
+  "/root/repo/src/game/server/score.cpp" "CMakeFiles/game-server.dir/src/game/server/score.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/score.cpp.o.d"
+  "/root/repo/src/game/server/scoreworker.cpp" "CMakeFiles/game-server.dir/src/game/server/scoreworker.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/scoreworker.cpp.o.d"
+  "/root/repo/src/game/server/teams.cpp" "CMakeFiles/game-server.dir/src/game/server/teams.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/teams.cpp.o.d"
+  "/root/repo/src/game/server/teamworkers.cpp" "CMakeFiles/game-server.dir/src/game/server/teamworkers.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/teamworkers.cpp.o.d"
+  "/root/repo/src/game/server/teehistorian.cpp" "CMakeFiles/game-server.dir/src/game/server/teehistorian.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/teehistorian.cpp.o.d"
+  "/root/repo/src/game/server/teeinfo.cpp" "CMakeFiles/game-server.dir/src/game/server/teeinfo.cpp.o" "gcc" "CMakeFiles/game-server.dir/src/game/server/teeinfo.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,106 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/game-server.dir/src/engine/server/antibot.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/antibot.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/authmanager.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/authmanager.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/connection.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/connection.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/connection_pool.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/connection_pool.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/mysql.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/sqlite.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/main.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/main.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/name_ban.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/name_ban.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/register.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/register.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/server.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/server.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/server_logger.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/server_logger.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/snap_id_pool.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/snap_id_pool.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/snapshot_bandwidth.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/snapshot_bandwidth.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/snapshot_workers.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/snapshot_workers.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/sql_string_helpers.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/teehistorian_replay.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/teehistorian_replay.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/tick_profiler.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/tick_profiler.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/engine/server/upnp.cpp.o"
+  "CMakeFiles/game-server.dir/src/engine/server/upnp.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/generated/server_data.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/generated/server_data.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/ddracechat.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/ddracechat.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/ddracecommands.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/ddracecommands.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/character.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/character.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/door.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/door.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/dragger.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/dragger.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/dragger_beam.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/dragger_beam.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/gun.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/gun.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/laser.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/laser.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/light.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/light.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/pickup.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/pickup.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/plasma.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/plasma.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entities/projectile.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entities/projectile.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/entity.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/entity.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/event_index.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/event_index.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/eventhandler.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/eventhandler.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/gamecontext.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/gamecontext.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/gamecontroller.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/gamecontroller.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/gamemodes/DDRace.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/gamemodes/DDRace.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/gamemodes/mod.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/gamemodes/mod.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/gameworld.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/gameworld.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/player.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/player.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/save.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/save.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/score.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/score.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/scoreworker.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/scoreworker.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/teams.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/teams.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/teamworkers.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/teamworkers.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/teehistorian.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/teehistorian.cpp.o.d"
+  "CMakeFiles/game-server.dir/src/game/server/teeinfo.cpp.o"
+  "CMakeFiles/game-server.dir/src/game/server/teeinfo.cpp.o.d"
+  "DDNet-Server"
+  "DDNet-Server.pdb"
+  "src/game/generated/server_data.cpp"
+  "src/game/generated/server_data.h"
+  "src/game/generated/wordlist.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/game-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/game/collision.cpp" "CMakeFiles/game-shared.dir/src/game/collision.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/collision.cpp.o.d"
+  "/root/repo/src/game/gamecore.cpp" "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/git_revision.cpp" "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o.d"
+  "/root/repo/src/game/layers.cpp" "CMakeFiles/game-shared.dir/src/game/layers.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/layers.cpp.o.d"
+  "/root/repo/src/game/localization.cpp" "CMakeFiles/game-shared.dir/src/game/localization.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/localization.cpp.o.d"
+  "/root/repo/src/game/mapbugs.cpp" "CMakeFiles/game-shared.dir/src/game/mapbugs.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/mapbugs.cpp.o.d"
+  "/root/repo/src/game/mapitems.cpp" "CMakeFiles/game-shared.dir/src/game/mapitems.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/mapitems.cpp.o.d"
+  "/root/repo/src/game/prng.cpp" "CMakeFiles/game-shared.dir/src/game/prng.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/prng.cpp.o.d"
+  "/root/repo/src/game/teamscore.cpp" "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/game-shared.dir/src/game/collision.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/collision.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/layers.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/layers.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/localization.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/localization.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/mapbugs.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/mapbugs.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/mapitems.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/mapitems.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/prng.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/prng.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o.d"
+  "src/game/generated/data_types.h"
+  "src/game/generated/git_revision.cpp"
+  "src/game/generated/protocol.h"
+  "src/game/generated/protocol7.h"
+  "src/game/generated/protocolglue.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/game-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/glew.dir/src/engine/external/glew/glew.c.o"
+  "CMakeFiles/glew.dir/src/engine/external/glew/glew.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/glew.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
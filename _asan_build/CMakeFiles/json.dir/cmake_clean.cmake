@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json.dir/src/engine/external/json-parser/json.c.o"
+  "CMakeFiles/json.dir/src/engine/external/json-parser/json.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/json.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
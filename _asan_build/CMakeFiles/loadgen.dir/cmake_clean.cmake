@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/loadgen.dir/src/tools/loadgen.cpp.o"
+  "CMakeFiles/loadgen.dir/src/tools/loadgen.cpp.o.d"
+  "loadgen"
+  "loadgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/loadgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
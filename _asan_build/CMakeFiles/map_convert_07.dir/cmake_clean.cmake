@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_convert_07.dir/src/tools/map_convert_07.cpp.o"
+  "CMakeFiles/map_convert_07.dir/src/tools/map_convert_07.cpp.o.d"
+  "map_convert_07"
+  "map_convert_07.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_convert_07.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_create_pixelart.dir/src/tools/map_create_pixelart.cpp.o"
+  "CMakeFiles/map_create_pixelart.dir/src/tools/map_create_pixelart.cpp.o.d"
+  "map_create_pixelart"
+  "map_create_pixelart.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_create_pixelart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_find_env.dir/src/tools/map_find_env.cpp.o"
+  "CMakeFiles/map_find_env.dir/src/tools/map_find_env.cpp.o.d"
+  "map_find_env"
+  "map_find_env.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_find_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_optimize.dir/src/tools/map_optimize.cpp.o"
+  "CMakeFiles/map_optimize.dir/src/tools/map_optimize.cpp.o.d"
+  "map_optimize"
+  "map_optimize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_optimize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_replace_area.dir/src/tools/map_replace_area.cpp.o"
+  "CMakeFiles/map_replace_area.dir/src/tools/map_replace_area.cpp.o.d"
+  "map_replace_area"
+  "map_replace_area.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_replace_area.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_replace_image.dir/src/tools/map_replace_image.cpp.o"
+  "CMakeFiles/map_replace_image.dir/src/tools/map_replace_image.cpp.o.d"
+  "map_replace_image"
+  "map_replace_image.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_replace_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
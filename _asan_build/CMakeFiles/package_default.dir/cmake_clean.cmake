@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/package_default"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/package_default.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/package_tar_xz"
+  "DDNet-18.7-linux_x86_64.tar.xz"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/package_tar_xz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rust-bridge-shared.dir/src/rust-bridge/cpp/console.cpp.o"
+  "CMakeFiles/rust-bridge-shared.dir/src/rust-bridge/cpp/console.cpp.o.d"
+  "CMakeFiles/rust-bridge-shared.dir/src/rust-bridge/engine/shared/rust_version.cpp.o"
+  "CMakeFiles/rust-bridge-shared.dir/src/rust-bridge/engine/shared/rust_version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rust-bridge-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rust_engine_shared_target"
+  "debug/libddnet_engine_shared.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/rust_engine_shared_target.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stun.dir/src/tools/stun.cpp.o"
+  "CMakeFiles/stun.dir/src/tools/stun.cpp.o.d"
+  "stun"
+  "stun.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/stun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/teehistorian_extract.dir/src/tools/teehistorian_extract.cpp.o"
+  "CMakeFiles/teehistorian_extract.dir/src/tools/teehistorian_extract.cpp.o.d"
+  "teehistorian_extract"
+  "teehistorian_extract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/teehistorian_extract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
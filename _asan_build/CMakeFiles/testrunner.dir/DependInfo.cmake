@@ -0,0 +1,99 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/client/blocklist_driver.cpp" "CMakeFiles/testrunner.dir/src/engine/client/blocklist_driver.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/blocklist_driver.cpp.o.d"
+  "/root/repo/src/engine/client/serverbrowser.cpp" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser.cpp.o.d"
+  "/root/repo/src/engine/client/serverbrowser_http.cpp" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_http.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_http.cpp.o.d"
+  "/root/repo/src/engine/client/serverbrowser_ping_cache.cpp" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_ping_cache.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_ping_cache.cpp.o.d"
+  "/root/repo/src/engine/client/snapshot_unpacker.cpp" "CMakeFiles/testrunner.dir/src/engine/client/snapshot_unpacker.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/snapshot_unpacker.cpp.o.d"
+  "/root/repo/src/engine/client/sqlite.cpp" "CMakeFiles/testrunner.dir/src/engine/client/sqlite.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/client/sqlite.cpp.o.d"
+  "/root/repo/src/engine/server/databases/connection.cpp" "CMakeFiles/testrunner.dir/src/engine/server/databases/connection.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/databases/connection.cpp.o.d"
+  "/root/repo/src/engine/server/databases/mysql.cpp" "CMakeFiles/testrunner.dir/src/engine/server/databases/mysql.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "/root/repo/src/engine/server/databases/sqlite.cpp" "CMakeFiles/testrunner.dir/src/engine/server/databases/sqlite.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "/root/repo/src/engine/server/name_ban.cpp" "CMakeFiles/testrunner.dir/src/engine/server/name_ban.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/name_ban.cpp.o.d"
+  "/root/repo/src/engine/server/snapshot_bandwidth.cpp" "CMakeFiles/testrunner.dir/src/engine/server/snapshot_bandwidth.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/snapshot_bandwidth.cpp.o.d"
+  "/root/repo/src/engine/server/snapshot_workers.cpp" "CMakeFiles/testrunner.dir/src/engine/server/snapshot_workers.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/snapshot_workers.cpp.o.d"
+  "/root/repo/src/engine/server/sql_string_helpers.cpp" "CMakeFiles/testrunner.dir/src/engine/server/sql_string_helpers.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "/root/repo/src/engine/server/tick_profiler.cpp" "CMakeFiles/testrunner.dir/src/engine/server/tick_profiler.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/engine/server/tick_profiler.cpp.o.d"
+  "/root/repo/src/game/client/laser_data.cpp" "CMakeFiles/testrunner.dir/src/game/client/laser_data.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/laser_data.cpp.o.d"
+  "/root/repo/src/game/client/pickup_data.cpp" "CMakeFiles/testrunner.dir/src/game/client/pickup_data.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/pickup_data.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entities/character.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/character.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/character.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entities/dragger.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/dragger.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/dragger.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entities/laser.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/laser.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/laser.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entities/pickup.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/pickup.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/pickup.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entities/projectile.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/projectile.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/projectile.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entity.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entity.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entity.cpp.o.d"
+  "/root/repo/src/game/client/prediction/entity_pool.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/entity_pool.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/entity_pool.cpp.o.d"
+  "/root/repo/src/game/client/prediction/gameworld.cpp" "CMakeFiles/testrunner.dir/src/game/client/prediction/gameworld.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/prediction/gameworld.cpp.o.d"
+  "/root/repo/src/game/client/projectile_data.cpp" "CMakeFiles/testrunner.dir/src/game/client/projectile_data.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/client/projectile_data.cpp.o.d"
+  "/root/repo/_asan_build/src/game/generated/client_data.cpp" "CMakeFiles/testrunner.dir/src/game/generated/client_data.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/generated/client_data.cpp.o.d"
+  "/root/repo/src/game/server/event_index.cpp" "CMakeFiles/testrunner.dir/src/game/server/event_index.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/server/event_index.cpp.o.d"
+  "/root/repo/src/game/server/scoreworker.cpp" "CMakeFiles/testrunner.dir/src/game/server/scoreworker.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/server/scoreworker.cpp.o.d"
+  "/root/repo/src/game/server/teehistorian.cpp" "CMakeFiles/testrunner.dir/src/game/server/teehistorian.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/game/server/teehistorian.cpp.o.d"
+  "/root/repo/src/test/aio.cpp" "CMakeFiles/testrunner.dir/src/test/aio.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/aio.cpp.o.d"
+  "/root/repo/src/test/async_file_writer.cpp" "CMakeFiles/testrunner.dir/src/test/async_file_writer.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/async_file_writer.cpp.o.d"
+  "/root/repo/src/test/bezier.cpp" "CMakeFiles/testrunner.dir/src/test/bezier.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/bezier.cpp.o.d"
+  "/root/repo/src/test/blocklist_driver.cpp" "CMakeFiles/testrunner.dir/src/test/blocklist_driver.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/blocklist_driver.cpp.o.d"
+  "/root/repo/src/test/bytes_be.cpp" "CMakeFiles/testrunner.dir/src/test/bytes_be.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/bytes_be.cpp.o.d"
+  "/root/repo/src/test/collision.cpp" "CMakeFiles/testrunner.dir/src/test/collision.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/collision.cpp.o.d"
+  "/root/repo/src/test/color.cpp" "CMakeFiles/testrunner.dir/src/test/color.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/color.cpp.o.d"
+  "/root/repo/src/test/compression.cpp" "CMakeFiles/testrunner.dir/src/test/compression.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/compression.cpp.o.d"
+  "/root/repo/src/test/csv.cpp" "CMakeFiles/testrunner.dir/src/test/csv.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/csv.cpp.o.d"
+  "/root/repo/src/test/datafile.cpp" "CMakeFiles/testrunner.dir/src/test/datafile.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/datafile.cpp.o.d"
+  "/root/repo/src/test/editor.cpp" "CMakeFiles/testrunner.dir/src/test/editor.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/editor.cpp.o.d"
+  "/root/repo/src/test/entity_grid.cpp" "CMakeFiles/testrunner.dir/src/test/entity_grid.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/entity_grid.cpp.o.d"
+  "/root/repo/src/test/entity_pool.cpp" "CMakeFiles/testrunner.dir/src/test/entity_pool.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/entity_pool.cpp.o.d"
+  "/root/repo/src/test/event_index.cpp" "CMakeFiles/testrunner.dir/src/test/event_index.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/event_index.cpp.o.d"
+  "/root/repo/src/test/fs.cpp" "CMakeFiles/testrunner.dir/src/test/fs.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/fs.cpp.o.d"
+  "/root/repo/src/test/gamecore.cpp" "CMakeFiles/testrunner.dir/src/test/gamecore.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/gamecore.cpp.o.d"
+  "/root/repo/src/test/git_revision.cpp" "CMakeFiles/testrunner.dir/src/test/git_revision.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/git_revision.cpp.o.d"
+  "/root/repo/src/test/hash.cpp" "CMakeFiles/testrunner.dir/src/test/hash.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/hash.cpp.o.d"
+  "/root/repo/src/test/huffman.cpp" "CMakeFiles/testrunner.dir/src/test/huffman.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/huffman.cpp.o.d"
+  "/root/repo/src/test/io.cpp" "CMakeFiles/testrunner.dir/src/test/io.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/io.cpp.o.d"
+  "/root/repo/src/test/jobs.cpp" "CMakeFiles/testrunner.dir/src/test/jobs.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/jobs.cpp.o.d"
+  "/root/repo/src/test/json.cpp" "CMakeFiles/testrunner.dir/src/test/json.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/json.cpp.o.d"
+  "/root/repo/src/test/jsonwriter.cpp" "CMakeFiles/testrunner.dir/src/test/jsonwriter.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/jsonwriter.cpp.o.d"
+  "/root/repo/src/test/linereader.cpp" "CMakeFiles/testrunner.dir/src/test/linereader.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/linereader.cpp.o.d"
+  "/root/repo/src/test/mapbugs.cpp" "CMakeFiles/testrunner.dir/src/test/mapbugs.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/mapbugs.cpp.o.d"
+  "/root/repo/src/test/math.cpp" "CMakeFiles/testrunner.dir/src/test/math.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/math.cpp.o.d"
+  "/root/repo/src/test/memory.cpp" "CMakeFiles/testrunner.dir/src/test/memory.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/memory.cpp.o.d"
+  "/root/repo/src/test/name_ban.cpp" "CMakeFiles/testrunner.dir/src/test/name_ban.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/name_ban.cpp.o.d"
+  "/root/repo/src/test/net.cpp" "CMakeFiles/testrunner.dir/src/test/net.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/net.cpp.o.d"
+  "/root/repo/src/test/netaddr.cpp" "CMakeFiles/testrunner.dir/src/test/netaddr.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/netaddr.cpp.o.d"
+  "/root/repo/src/test/netserver.cpp" "CMakeFiles/testrunner.dir/src/test/netserver.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/netserver.cpp.o.d"
+  "/root/repo/src/test/os.cpp" "CMakeFiles/testrunner.dir/src/test/os.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/os.cpp.o.d"
+  "/root/repo/src/test/packer.cpp" "CMakeFiles/testrunner.dir/src/test/packer.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/packer.cpp.o.d"
+  "/root/repo/src/test/prng.cpp" "CMakeFiles/testrunner.dir/src/test/prng.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/prng.cpp.o.d"
+  "/root/repo/src/test/score.cpp" "CMakeFiles/testrunner.dir/src/test/score.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/score.cpp.o.d"
+  "/root/repo/src/test/secure_random.cpp" "CMakeFiles/testrunner.dir/src/test/secure_random.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/secure_random.cpp.o.d"
+  "/root/repo/src/test/serverbrowser.cpp" "CMakeFiles/testrunner.dir/src/test/serverbrowser.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/serverbrowser.cpp.o.d"
+  "/root/repo/src/test/serverinfo.cpp" "CMakeFiles/testrunner.dir/src/test/serverinfo.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/serverinfo.cpp.o.d"
+  "/root/repo/src/test/snapshot.cpp" "CMakeFiles/testrunner.dir/src/test/snapshot.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/snapshot.cpp.o.d"
+  "/root/repo/src/test/snapshot_bandwidth.cpp" "CMakeFiles/testrunner.dir/src/test/snapshot_bandwidth.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/snapshot_bandwidth.cpp.o.d"
+  "/root/repo/src/test/snapshot_unpacker.cpp" "CMakeFiles/testrunner.dir/src/test/snapshot_unpacker.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/snapshot_unpacker.cpp.o.d"
+  "/root/repo/src/test/snapshot_workers.cpp" "CMakeFiles/testrunner.dir/src/test/snapshot_workers.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/snapshot_workers.cpp.o.d"
+  "/root/repo/src/test/str.cpp" "CMakeFiles/testrunner.dir/src/test/str.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/str.cpp.o.d"
+  "/root/repo/src/test/strip_path_and_extension.cpp" "CMakeFiles/testrunner.dir/src/test/strip_path_and_extension.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/strip_path_and_extension.cpp.o.d"
+  "/root/repo/src/test/swap_endian.cpp" "CMakeFiles/testrunner.dir/src/test/swap_endian.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/swap_endian.cpp.o.d"
+  "/root/repo/src/test/teehistorian.cpp" "CMakeFiles/testrunner.dir/src/test/teehistorian.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/teehistorian.cpp.o.d"
+  "/root/repo/src/test/test.cpp" "CMakeFiles/testrunner.dir/src/test/test.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/test.cpp.o.d"
+  "/root/repo/src/test/thread.cpp" "CMakeFiles/testrunner.dir/src/test/thread.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/thread.cpp.o.d"
+  "/root/repo/src/test/tick_profiler.cpp" "CMakeFiles/testrunner.dir/src/test/tick_profiler.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/tick_profiler.cpp.o.d"
+  "/root/repo/src/test/timestamp.cpp" "CMakeFiles/testrunner.dir/src/test/timestamp.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/timestamp.cpp.o.d"
+  "/root/repo/src/test/unix.cpp" "CMakeFiles/testrunner.dir/src/test/unix.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/unix.cpp.o.d"
+  "/root/repo/src/test/uuid.cpp" "CMakeFiles/testrunner.dir/src/test/uuid.cpp.o" "gcc" "CMakeFiles/testrunner.dir/src/test/uuid.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,173 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testrunner.dir/src/engine/client/blocklist_driver.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/blocklist_driver.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_http.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_http.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_ping_cache.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/serverbrowser_ping_cache.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/client/snapshot_unpacker.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/snapshot_unpacker.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/client/sqlite.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/client/sqlite.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/connection.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/connection.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/mysql.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/sqlite.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/name_ban.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/name_ban.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/snapshot_bandwidth.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/snapshot_bandwidth.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/snapshot_workers.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/snapshot_workers.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/sql_string_helpers.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/engine/server/tick_profiler.cpp.o"
+  "CMakeFiles/testrunner.dir/src/engine/server/tick_profiler.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/laser_data.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/laser_data.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/pickup_data.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/pickup_data.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/character.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/character.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/dragger.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/dragger.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/laser.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/laser.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/pickup.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/pickup.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/projectile.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entities/projectile.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entity.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entity.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entity_pool.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/entity_pool.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/gameworld.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/prediction/gameworld.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/client/projectile_data.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/client/projectile_data.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/generated/client_data.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/generated/client_data.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/server/event_index.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/server/event_index.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/server/scoreworker.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/server/scoreworker.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/game/server/teehistorian.cpp.o"
+  "CMakeFiles/testrunner.dir/src/game/server/teehistorian.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/aio.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/aio.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/async_file_writer.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/async_file_writer.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/bezier.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/bezier.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/blocklist_driver.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/blocklist_driver.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/bytes_be.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/bytes_be.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/collision.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/collision.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/color.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/color.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/compression.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/compression.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/csv.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/csv.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/datafile.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/datafile.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/editor.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/editor.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/entity_grid.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/entity_grid.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/entity_pool.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/entity_pool.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/event_index.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/event_index.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/fs.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/fs.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/gamecore.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/gamecore.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/git_revision.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/git_revision.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/hash.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/hash.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/huffman.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/huffman.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/io.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/io.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/jobs.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/jobs.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/json.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/json.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/jsonwriter.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/jsonwriter.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/linereader.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/linereader.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/mapbugs.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/mapbugs.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/math.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/math.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/memory.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/memory.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/name_ban.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/name_ban.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/net.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/net.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/netaddr.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/netaddr.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/netserver.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/netserver.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/os.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/os.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/packer.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/packer.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/prng.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/prng.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/score.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/score.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/secure_random.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/secure_random.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/serverbrowser.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/serverbrowser.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/serverinfo.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/serverinfo.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/snapshot.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/snapshot.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_bandwidth.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_bandwidth.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_unpacker.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_unpacker.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_workers.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/snapshot_workers.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/str.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/str.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/strip_path_and_extension.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/strip_path_and_extension.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/swap_endian.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/swap_endian.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/teehistorian.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/teehistorian.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/test.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/test.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/thread.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/thread.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/tick_profiler.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/tick_profiler.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/timestamp.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/timestamp.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/unix.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/unix.cpp.o.d"
+  "CMakeFiles/testrunner.dir/src/test/uuid.cpp.o"
+  "CMakeFiles/testrunner.dir/src/test/uuid.cpp.o.d"
+  "src/game/generated/client_data.cpp"
+  "src/game/generated/client_data.h"
+  "testrunner"
+  "testrunner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/testrunner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/twping.dir/src/tools/twping.cpp.o"
+  "CMakeFiles/twping.dir/src/tools/twping.cpp.o.d"
+  "twping"
+  "twping.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/twping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unicode_confusables.dir/src/tools/unicode_confusables.cpp.o"
+  "CMakeFiles/unicode_confusables.dir/src/tools/unicode_confusables.cpp.o.d"
+  "unicode_confusables"
+  "unicode_confusables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/unicode_confusables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uuid.dir/src/tools/uuid.cpp.o"
+  "CMakeFiles/uuid.dir/src/tools/uuid.cpp.o.d"
+  "uuid"
+  "uuid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/uuid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/external/wavpack/bits.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/bits.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/bits.c.o.d"
+  "/root/repo/src/engine/external/wavpack/float.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/float.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/float.c.o.d"
+  "/root/repo/src/engine/external/wavpack/metadata.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/metadata.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/metadata.c.o.d"
+  "/root/repo/src/engine/external/wavpack/unpack.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/unpack.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/unpack.c.o.d"
+  "/root/repo/src/engine/external/wavpack/words.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/words.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/words.c.o.d"
+  "/root/repo/src/engine/external/wavpack/wputils.c" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/wputils.c.o" "gcc" "CMakeFiles/wavpack.dir/src/engine/external/wavpack/wputils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
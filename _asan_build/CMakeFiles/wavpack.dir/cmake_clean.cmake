@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/bits.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/bits.c.o.d"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/float.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/float.c.o.d"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/metadata.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/metadata.c.o.d"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/unpack.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/unpack.c.o.d"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/words.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/words.c.o.d"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/wputils.c.o"
+  "CMakeFiles/wavpack.dir/src/engine/external/wavpack/wputils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wavpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
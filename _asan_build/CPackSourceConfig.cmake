@@ -0,0 +1,75 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_ARCHIVE_COMPONENT_INSTALL "ON")
+set(CPACK_ARCHIVE_PORTABLE_FILE_NAME "DDNet-18.7-linux_x86_64")
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_asan_build")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "portable")
+set(CPACK_COMPONENTS_ALL_SET_BY_USER "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "DDNet built using CMake")
+set(CPACK_FILES_TMP "license.txt;storage.cfg;other/config_directory.sh")
+set(CPACK_GENERATOR "ZIP;TGZ;TBZ2;TXZ")
+set(CPACK_IGNORE_FILES "\\.pyc$;/\\.git;/__pycache__/;/root/repo/([^CRcdddllmosssuv]|$);/root/repo/C([^M]|$);/root/repo/R([^E]|$);/root/repo/c([^m]|$);/root/repo/d([^aad]|$);/root/repo/l([^is]|$);/root/repo/m([^e]|$);/root/repo/o([^t]|$);/root/repo/s([^crt]|$);/root/repo/u([^b]|$);/root/repo/v([^a]|$);/root/repo/CM([^a]|$);/root/repo/RE([^A]|$);/root/repo/cm([^a]|$);/root/repo/da([^tt]|$);/root/repo/dd([^n]|$);/root/repo/li([^c]|$);/root/repo/ls([^a]|$);/root/repo/me([^m]|$);/root/repo/ot([^h]|$);/root/repo/sc([^r]|$);/root/repo/sr([^c]|$);/root/repo/st([^o]|$);/root/repo/ub([^s]|$);/root/repo/va([^l]|$);/root/repo/CMa([^k]|$);/root/repo/REA([^D]|$);/root/repo/cma([^k]|$);/root/repo/dat([^aa]|$);/root/repo/ddn([^e]|$);/root/repo/lic([^e]|$);/root/repo/lsa([^n]|$);/root/repo/mem([^c]|$);/root/repo/oth([^e]|$);/root/repo/scr([^i]|$);/root/repo/src([^/]|$);/root/repo/sto([^r]|$);/root/repo/ubs([^a]|$);/root/repo/val([^g]|$);/root/repo/CMak([^e]|$);/root/repo/READ([^M]|$);/root/repo/cmak([^e]|$);/root/repo/data([^/s]|$);/root/repo/ddne([^t]|$);/root/repo/lice([^n]|$);/root/repo/lsan([^.]|$);/root/repo/memc([^h]|$);/root/repo/othe([^r]|$);/root/repo/scri([^p]|$);/root/repo/stor([^a]|$);/root/repo/ubsa([^n]|$);/root/repo/valg([^r]|$);/root/repo/CMake([^L]|$);/root/repo/READM([^E]|$);/root/repo/cmake([^/]|$);/root/repo/datas([^r]|$);/root/repo/ddnet([^-]|$);/root/repo/licen([^s]|$);/root/repo/lsan\\.([^s]|$);/root/repo/memch([^e]|$);/root/repo/other([^/]|$);/root/repo/scrip([^t]|$);/root/repo/stora([^g]|$);/root/repo/ubsan([^.]|$);/root/repo/valgr([^i]|$);/root/repo/CMakeL([^i]|$);/root/repo/README([^.]|$);/root/repo/datasr([^c]|$);/root/repo/ddnet-([^l]|$);/root/repo/licens([^e]|$);/root/repo/lsan\\.s([^u]|$);/root/repo/memche([^c]|$);/root/repo/script([^s]|$);/root/repo/storag([^e]|$);/root/repo/ubsan\\.([^s]|$);/root/repo/valgri([^n]|$);/root/repo/CMakeLi([^s]|$);/root/repo/README\\.([^m]|$);/root/repo/datasrc([^/]|$);/root/repo/ddnet-l([^i]|$);/root/repo/license([^.]|$);/root/repo/lsan\\.su([^p]|$);/root/repo/memchec([^k]|$);/root/repo/scripts([^/]|$);/root/repo/storage([^.]|$);/root/repo/ubsan\\.s([^u]|$);/root/repo/valgrin([^d]|$);/root/repo/CMakeLis([^t]|$);/root/repo/README\\.m([^d]|$);/root/repo/ddnet-li([^b]|$);/root/repo/license\\.([^t]|$);/root/repo/lsan\\.sup([^p]|$);/root/repo/memcheck([^.]|$);/root/repo/storage\\.([^c]|$);/root/repo/ubsan\\.su([^p]|$);/root/repo/valgrind([^.]|$);/root/repo/CMakeList([^s]|$);/root/repo/ddnet-lib([^s]|$);/root/repo/license\\.t([^x]|$);/root/repo/memcheck\\.([^s]|$);/root/repo/storage\\.c([^f]|$);/root/repo/ubsan\\.sup([^p]|$);/root/repo/valgrind\\.([^s]|$);/root/repo/CMakeLists([^.]|$);/root/repo/ddnet-libs([^/]|$);/root/repo/license\\.tx([^t]|$);/root/repo/memcheck\\.s([^u]|$);/root/repo/storage\\.cf([^g]|$);/root/repo/valgrind\\.s([^u]|$);/root/repo/CMakeLists\\.([^t]|$);/root/repo/memcheck\\.su([^p]|$);/root/repo/valgrind\\.su([^p]|$);/root/repo/CMakeLists\\.t([^x]|$);/root/repo/memcheck\\.sup([^p]|$);/root/repo/valgrind\\.sup([^p]|$);/root/repo/CMakeLists\\.tx([^t]|$)")
+set(CPACK_INSTALLED_DIRECTORIES "/root/repo;/")
+set(CPACK_INSTALL_CMAKE_PROJECTS "")
+set(CPACK_INSTALL_PREFIX "/usr/local")
+set(CPACK_MODULE_PATH "/root/repo/cmake")
+set(CPACK_NSIS_DISPLAY_NAME "DDNet 18.7")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_PACKAGE_NAME "DDNet 18.7")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_asan_build/CPackConfig.cmake")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "DDNet built using CMake")
+set(CPACK_PACKAGE_FILE_NAME "DDNet-18.7-src")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "DDNet 18.7")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "DDNet 18.7")
+set(CPACK_PACKAGE_NAME "DDNet")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "Humanity")
+set(CPACK_PACKAGE_VERSION "18.7")
+set(CPACK_PACKAGE_VERSION_MAJOR "18")
+set(CPACK_PACKAGE_VERSION_MINOR "7")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/usr/share/cmake-3.25/Templates/CPack.GenericLicense.txt")
+set(CPACK_RESOURCE_FILE_README "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_RESOURCE_FILE_WELCOME "/usr/share/cmake-3.25/Templates/CPack.GenericWelcome.txt")
+set(CPACK_RPM_PACKAGE_SOURCES "ON")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "ZIP;TGZ;TBZ2;TXZ")
+set(CPACK_SOURCE_IGNORE_FILES "\\.pyc$;/\\.git;/__pycache__/;/root/repo/([^CRcdddllmosssuv]|$);/root/repo/C([^M]|$);/root/repo/R([^E]|$);/root/repo/c([^m]|$);/root/repo/d([^aad]|$);/root/repo/l([^is]|$);/root/repo/m([^e]|$);/root/repo/o([^t]|$);/root/repo/s([^crt]|$);/root/repo/u([^b]|$);/root/repo/v([^a]|$);/root/repo/CM([^a]|$);/root/repo/RE([^A]|$);/root/repo/cm([^a]|$);/root/repo/da([^tt]|$);/root/repo/dd([^n]|$);/root/repo/li([^c]|$);/root/repo/ls([^a]|$);/root/repo/me([^m]|$);/root/repo/ot([^h]|$);/root/repo/sc([^r]|$);/root/repo/sr([^c]|$);/root/repo/st([^o]|$);/root/repo/ub([^s]|$);/root/repo/va([^l]|$);/root/repo/CMa([^k]|$);/root/repo/REA([^D]|$);/root/repo/cma([^k]|$);/root/repo/dat([^aa]|$);/root/repo/ddn([^e]|$);/root/repo/lic([^e]|$);/root/repo/lsa([^n]|$);/root/repo/mem([^c]|$);/root/repo/oth([^e]|$);/root/repo/scr([^i]|$);/root/repo/src([^/]|$);/root/repo/sto([^r]|$);/root/repo/ubs([^a]|$);/root/repo/val([^g]|$);/root/repo/CMak([^e]|$);/root/repo/READ([^M]|$);/root/repo/cmak([^e]|$);/root/repo/data([^/s]|$);/root/repo/ddne([^t]|$);/root/repo/lice([^n]|$);/root/repo/lsan([^.]|$);/root/repo/memc([^h]|$);/root/repo/othe([^r]|$);/root/repo/scri([^p]|$);/root/repo/stor([^a]|$);/root/repo/ubsa([^n]|$);/root/repo/valg([^r]|$);/root/repo/CMake([^L]|$);/root/repo/READM([^E]|$);/root/repo/cmake([^/]|$);/root/repo/datas([^r]|$);/root/repo/ddnet([^-]|$);/root/repo/licen([^s]|$);/root/repo/lsan\\.([^s]|$);/root/repo/memch([^e]|$);/root/repo/other([^/]|$);/root/repo/scrip([^t]|$);/root/repo/stora([^g]|$);/root/repo/ubsan([^.]|$);/root/repo/valgr([^i]|$);/root/repo/CMakeL([^i]|$);/root/repo/README([^.]|$);/root/repo/datasr([^c]|$);/root/repo/ddnet-([^l]|$);/root/repo/licens([^e]|$);/root/repo/lsan\\.s([^u]|$);/root/repo/memche([^c]|$);/root/repo/script([^s]|$);/root/repo/storag([^e]|$);/root/repo/ubsan\\.([^s]|$);/root/repo/valgri([^n]|$);/root/repo/CMakeLi([^s]|$);/root/repo/README\\.([^m]|$);/root/repo/datasrc([^/]|$);/root/repo/ddnet-l([^i]|$);/root/repo/license([^.]|$);/root/repo/lsan\\.su([^p]|$);/root/repo/memchec([^k]|$);/root/repo/scripts([^/]|$);/root/repo/storage([^.]|$);/root/repo/ubsan\\.s([^u]|$);/root/repo/valgrin([^d]|$);/root/repo/CMakeLis([^t]|$);/root/repo/README\\.m([^d]|$);/root/repo/ddnet-li([^b]|$);/root/repo/license\\.([^t]|$);/root/repo/lsan\\.sup([^p]|$);/root/repo/memcheck([^.]|$);/root/repo/storage\\.([^c]|$);/root/repo/ubsan\\.su([^p]|$);/root/repo/valgrind([^.]|$);/root/repo/CMakeList([^s]|$);/root/repo/ddnet-lib([^s]|$);/root/repo/license\\.t([^x]|$);/root/repo/memcheck\\.([^s]|$);/root/repo/storage\\.c([^f]|$);/root/repo/ubsan\\.sup([^p]|$);/root/repo/valgrind\\.([^s]|$);/root/repo/CMakeLists([^.]|$);/root/repo/ddnet-libs([^/]|$);/root/repo/license\\.tx([^t]|$);/root/repo/memcheck\\.s([^u]|$);/root/repo/storage\\.cf([^g]|$);/root/repo/valgrind\\.s([^u]|$);/root/repo/CMakeLists\\.([^t]|$);/root/repo/memcheck\\.su([^p]|$);/root/repo/valgrind\\.su([^p]|$);/root/repo/CMakeLists\\.t([^x]|$);/root/repo/memcheck\\.sup([^p]|$);/root/repo/valgrind\\.sup([^p]|$);/root/repo/CMakeLists\\.tx([^t]|$)")
+set(CPACK_SOURCE_INSTALLED_DIRECTORIES "/root/repo;/")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_asan_build/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_PACKAGE_FILE_NAME "DDNet-18.7-src")
+set(CPACK_SOURCE_TOPLEVEL_TAG "linux_x86_64-Source")
+set(CPACK_STRIP_FILES "")
+set(CPACK_SYSTEM_NAME "linux_x86_64")
+set(CPACK_THREADS "1")
+set(CPACK_TOPLEVEL_TAG "linux_x86_64-Source")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_asan_build/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
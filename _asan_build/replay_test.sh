@@ -0,0 +1,197 @@
+#!/bin/bash
+
+arg_verbose=0
+
+for arg in "$@"; do
+	if [ "$arg" == "-h" ] || [ "$arg" == "--help" ]; then
+		echo "usage: $(basename "$0") [OPTION..]"
+		echo "description:"
+		echo "  Records a teehistorian file of load generator clients playing"
+		echo "  and spectating on the server and replays it to check the"
+		echo "  server, using the binaries of the current build directory."
+		echo "  The replayed character positions have to match the recorded ones."
+		echo "  The snap culling check needs a debug build. The replays with"
+		echo "  and without team threads or the core broadphase have to end in"
+		echo "  the same state."
+		echo "options:"
+		echo "  --help|-h             show this help"
+		echo "  --verbose|-v          verbose output"
+		exit 0
+	elif [ "$arg" == "-v" ] || [ "$arg" == "--verbose" ]; then
+		arg_verbose=1
+	else
+		echo "Error: unknown argument '$arg'"
+		exit 1
+	fi
+done
+
+if [ ! -f DDNet-Server ]; then
+	echo "[-] Error: server binary 'DDNet-Server' not found"
+	exit 1
+fi
+if [ ! -f loadgen ]; then
+	echo "[-] Error: load generator binary 'loadgen' not found"
+	exit 1
+fi
+
+echo "[*] Setup"
+
+function fail() {
+	echo "[-] Error: $1"
+	echo "$1" >> fail_replay.txt
+}
+
+# replays the recording with two values of a setting that must not change
+# the game, the reported state hashes have to be the same
+function compare_replays() {
+	local setting="$1"
+	local value
+	for value in "$2" "$3"; do
+		../DDNet-Server --replay "$teehistorian" "$setting $value" > "stdout_replay_${setting}_$value.txt" 2> "stderr_replay_${setting}_$value.txt"
+		if [ "$arg_verbose" == "1" ]; then
+			echo "[*] $setting $value: $(grep -o 'replay: ticks=.*' "stdout_replay_${setting}_$value.txt")"
+		fi
+	done
+	local hash_first
+	local hash_second
+	hash_first="$(grep -o 'sha256=[0-9a-f]*' "stdout_replay_${setting}_$2.txt")"
+	hash_second="$(grep -o 'sha256=[0-9a-f]*' "stdout_replay_${setting}_$3.txt")"
+	if [ "$hash_first" == "" ] || [ "$hash_second" == "" ]; then
+		fail "no state hash reported by the replays with $setting"
+	elif [ "$hash_first" != "$hash_second" ]; then
+		fail "$setting changed the state: $hash_first with $2, $hash_second with $3"
+	else
+		echo "[*] $setting $2 and $3: $hash_first"
+	fi
+}
+
+# Get unused port from the system by binding to port 0 and immediately closing the socket again
+port=$(python3 -c 'import socket; s=socket.socket(); s.bind(("", 0)); print(s.getsockname()[1]); s.close()')
+
+if [[ $OSTYPE == 'darwin'* ]]; then
+	DETECT_LEAKS=0
+else
+	DETECT_LEAKS=1
+fi
+
+export UBSAN_OPTIONS=suppressions=../ubsan.supp:log_path=./SAN:print_stacktrace=1:halt_on_errors=0
+export ASAN_OPTIONS=log_path=./SAN:print_stacktrace=1:check_initialization_order=1:detect_leaks=$DETECT_LEAKS:halt_on_errors=0
+export LSAN_OPTIONS=suppressions=../lsan.supp:print_suppressions=0
+
+rm -rf replay_test
+mkdir -p replay_test/data/maps
+cp data/maps/coverage.map replay_test/data/maps
+cd replay_test || exit 1
+
+{
+	echo $'add_path $CURRENTDIR'
+	echo $'add_path $USERDIR'
+	echo $'add_path $DATADIR'
+	echo $'add_path ../data'
+} > storage.cfg
+
+echo "[*] Launch server"
+../DDNet-Server \
+	"sv_input_fifo server.fifo;
+	sv_map coverage;
+	sv_tee_historian 1;
+	sv_max_clients_per_ip 64;
+	sv_register 0;
+	sv_port $port" > stdout_server.txt 2> stderr_server.txt &
+server_pid=$!
+
+tries=0
+while [[ ! -p server.fifo ]]; do
+	tries="$((tries + 1))"
+	if [ "$tries" -gt 100 ]; then
+		echo "[-] Error: server possibly crashed on launch"
+		kill "$server_pid" 2> /dev/null
+		exit 1
+	fi
+	sleep 0.1
+done
+
+# the last clients spectate, looking around the map or following players,
+# while the map's lasers and draggers are out of the view of most clients
+echo "[*] Record load generator clients"
+../loadgen -n 24 -S 8 -t 15 -m random -s 1 "127.0.0.1:$port" > stdout_loadgen.txt 2> stderr_loadgen.txt &
+loadgen_pid=$!
+
+# split the players into several teams, so the team threads have work
+sleep 3
+for ((i = 0; i < 16; i++)); do
+	if ! timeout 3 sh -c "echo 'set_team_ddr $i $((i % 4 + 1))' > server.fifo"; then
+		fail "set_team_ddr timed out"
+		break
+	fi
+done
+
+if ! wait "$loadgen_pid"; then
+	fail "load generator exited with code $?"
+fi
+
+echo "[*] Shutting down server"
+if ! timeout 3 sh -c "echo shutdown > server.fifo"; then
+	echo "[-] shutdown server timed out"
+	kill "$server_pid" 2> /dev/null
+fi
+wait "$server_pid"
+
+teehistorian="$(find teehistorian -name '*.teehistorian' -print -quit 2> /dev/null)"
+if [ "$teehistorian" == "" ]; then
+	fail "no teehistorian file recorded"
+else
+	if [ "$arg_verbose" == "1" ]; then
+		echo "[*] Replay $teehistorian"
+	fi
+
+	echo "[*] Replay with snap culling check"
+	../DDNet-Server --replay "$teehistorian" "dbg_snap_culling 1" > stdout_replay.txt 2> stderr_replay.txt
+	if grep -q "snap culling changed" stdout_replay.txt; then
+		grep "snap culling changed" stdout_replay.txt | head -n 10
+		fail "snap culling changed snapshots"
+	fi
+	positions="$(grep -o 'positions=[0-9]* mismatches=[0-9]*' stdout_replay.txt)"
+	if [ "$positions" == "" ]; then
+		fail "no positions checked by the replay"
+	elif ! [[ "$positions" =~ positions=[1-9][0-9]*\ mismatches=0$ ]]; then
+		grep "first mismatch" stdout_replay.txt | head -n 10
+		fail "the replay diverged from the recording: $positions"
+	else
+		echo "[*] $positions"
+	fi
+	snap_culling="$(grep -o 'snap_culling: snapshots=[0-9]* mismatches=[0-9]*' stdout_replay.txt)"
+	if [ "$snap_culling" == "" ]; then
+		fail "no snapshots checked, the snap culling check needs a debug build"
+	elif ! [[ "$snap_culling" =~ snapshots=[1-9][0-9]*\ mismatches=0$ ]]; then
+		fail "unexpected snap culling result: $snap_culling"
+	else
+		echo "[*] $snap_culling"
+	fi
+
+	echo "[*] Replay with and without team threads"
+	compare_replays sv_team_threads 0 1
+	echo "[*] Replay with and without the core broadphase"
+	compare_replays sv_core_broadphase 0 1
+fi
+
+for stderr in ./stderr_*.txt; do
+	if [ "$(cat "$stderr")" == "" ]; then
+		continue
+	fi
+	echo "[!] Warning: $stderr"
+	cat "$stderr"
+done
+
+if test -n "$(find . -maxdepth 1 -name 'SAN.*' -print -quit)"; then
+	echo "[-] Error: ASAN has detected the following errors:"
+	cat SAN.*
+	exit 1
+fi
+
+if [ -f fail_replay.txt ]; then
+	echo "[-] Test failed. See errors above"
+	exit 1
+fi
+
+echo "[*] All tests passed"
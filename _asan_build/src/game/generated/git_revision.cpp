@@ -0,0 +1 @@
+const char *GIT_SHORTREV_HASH = "cf46f799461cb9ec11cd45a138969da1";
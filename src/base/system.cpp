@@ -84,7 +84,15 @@
 #include <sys/filio.h>
 #endif
 
-static NETSTATS network_stats = {0};
+// the sockets of the client may be read on their own threads
+static struct
+{
+	std::atomic<uint64_t> sent_packets{0};
+	std::atomic<uint64_t> sent_bytes{0};
+	std::atomic<uint64_t> sent_syscalls{0};
+	std::atomic<uint64_t> recv_packets{0};
+	std::atomic<uint64_t> recv_bytes{0};
+} network_stats;
 
 #define VLEN 128
 #define PACKETSIZE 1400
@@ -106,6 +114,18 @@ void net_buffer_init(NETSOCKET_BUFFER *buffer);
 void net_buffer_reinit(NETSOCKET_BUFFER *buffer);
 void net_buffer_simple(NETSOCKET_BUFFER *buffer, char **buf, int *size);
 
+#if defined(CONF_PLATFORM_LINUX)
+typedef struct
+{
+	int count;
+	int socks[VLEN];
+	struct mmsghdr msgs[VLEN];
+	struct iovec iovecs[VLEN];
+	char bufs[VLEN][PACKETSIZE];
+	struct sockaddr_storage sockaddrs[VLEN];
+} NETSOCKET_SEND_QUEUE;
+#endif
+
 struct NETSOCKET_INTERNAL
 {
 	int type;
@@ -113,6 +133,9 @@ struct NETSOCKET_INTERNAL
 	int ipv6sock;
 	int web_ipv4sock;
 
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_QUEUE *send_queue;
+#endif
 	NETSOCKET_BUFFER buffer;
 };
 static NETSOCKET_INTERNAL invalid_socket = {NETTYPE_INVALID, -1, -1, -1};
@@ -316,7 +339,7 @@ int io_skip(IOHANDLE io, int size)
 	return io_seek(io, size, IOSEEK_CUR);
 }
 
-int io_seek(IOHANDLE io, int offset, int origin)
+int io_seek(IOHANDLE io, int64_t offset, int origin)
 {
 	int real_origin;
 	switch(origin)
@@ -334,17 +357,25 @@ int io_seek(IOHANDLE io, int offset, int origin)
 		dbg_assert(false, "origin invalid");
 		return -1;
 	}
-	return fseek((FILE *)io, offset, real_origin);
+#if defined(CONF_FAMILY_WINDOWS)
+	return _fseeki64((FILE *)io, offset, real_origin);
+#else
+	return fseeko((FILE *)io, offset, real_origin);
+#endif
 }
 
-long int io_tell(IOHANDLE io)
+int64_t io_tell(IOHANDLE io)
 {
-	return ftell((FILE *)io);
+#if defined(CONF_FAMILY_WINDOWS)
+	return _ftelli64((FILE *)io);
+#else
+	return ftello((FILE *)io);
+#endif
 }
 
-long int io_length(IOHANDLE io)
+int64_t io_length(IOHANDLE io)
 {
-	long int length;
+	int64_t length;
 	io_seek(io, 0, IOSEEK_END);
 	length = io_tell(io);
 	io_seek(io, 0, IOSEEK_START);
@@ -1631,10 +1662,157 @@ NETSOCKET net_udp_create(NETADDR bindaddr)
 	return sock;
 }
 
+#if defined(CONF_PLATFORM_LINUX)
+/* returns 1 if the packet was queued, 0 if it has to be sent directly and -1
+   if it has to be dropped because queued packets are still waiting for the
+   socket buffer, sending it directly would overtake them */
+static int priv_net_udp_enqueue(NETSOCKET sock, const NETADDR *addr, const void *data, int size)
+{
+	NETSOCKET_SEND_QUEUE *queue = sock->send_queue;
+
+	/* websocket, broadcast or unsupported addresses and packets too big for
+	   the queue */
+	int socket = -1;
+	if(size <= PACKETSIZE)
+	{
+		if(addr->type == NETTYPE_IPV4 && sock->ipv4sock >= 0)
+			socket = sock->ipv4sock;
+		else if(addr->type == NETTYPE_IPV6 && sock->ipv6sock >= 0)
+			socket = sock->ipv6sock;
+	}
+	if(socket < 0)
+	{
+		/* keep the packet order */
+		net_udp_flush(sock);
+		return queue->count == 0 ? 0 : -1;
+	}
+
+	if(queue->count == VLEN)
+	{
+		net_udp_flush(sock);
+		/* the socket buffer is still full, drop the packet like a failed
+		   sendto */
+		if(queue->count == VLEN)
+			return -1;
+	}
+
+	const int i = queue->count++;
+	queue->socks[i] = socket;
+	if(addr->type == NETTYPE_IPV4)
+	{
+		netaddr_to_sockaddr_in(addr, (struct sockaddr_in *)&queue->sockaddrs[i]);
+		queue->msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+	}
+	else
+	{
+		netaddr_to_sockaddr_in6(addr, (struct sockaddr_in6 *)&queue->sockaddrs[i]);
+		queue->msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in6);
+	}
+	mem_copy(queue->bufs[i], data, size);
+	queue->iovecs[i].iov_len = size;
+	return 1;
+}
+#endif
+
+bool net_udp_set_send_batching(NETSOCKET sock, bool enable)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	if(enable && !sock->send_queue)
+	{
+		NETSOCKET_SEND_QUEUE *queue = (NETSOCKET_SEND_QUEUE *)calloc(1, sizeof(*queue));
+		for(int i = 0; i < VLEN; ++i)
+		{
+			queue->iovecs[i].iov_base = queue->bufs[i];
+			queue->msgs[i].msg_hdr.msg_iov = &queue->iovecs[i];
+			queue->msgs[i].msg_hdr.msg_iovlen = 1;
+			queue->msgs[i].msg_hdr.msg_name = &queue->sockaddrs[i];
+		}
+		sock->send_queue = queue;
+	}
+	else if(!enable && sock->send_queue)
+	{
+		net_udp_flush(sock);
+		free(sock->send_queue);
+		sock->send_queue = nullptr;
+	}
+	return enable;
+#else
+	return false;
+#endif
+}
+
+int net_udp_flush(NETSOCKET sock)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_QUEUE *queue = sock->send_queue;
+	if(!queue || queue->count == 0)
+		return 0;
+
+	int sent = 0;
+	int start = 0;
+	while(start < queue->count)
+	{
+		/* one syscall per run of packets going out through the same socket */
+		int end = start + 1;
+		while(end < queue->count && queue->socks[end] == queue->socks[start])
+			end++;
+
+		const int result = sendmmsg(queue->socks[start], &queue->msgs[start], end - start, 0);
+		network_stats.sent_syscalls++;
+		if(result > 0)
+		{
+			sent += result;
+			start += result;
+		}
+		else if(net_would_block())
+		{
+			/* the socket buffer is full, keep the unsent packets for the
+			   next flush */
+			break;
+		}
+		else
+		{
+			/* the first packet failed, drop it like a failed sendto */
+			start++;
+		}
+	}
+
+	/* move the unsent packets to the front */
+	for(int i = start; i < queue->count; i++)
+	{
+		const int j = i - start;
+		queue->socks[j] = queue->socks[i];
+		queue->sockaddrs[j] = queue->sockaddrs[i];
+		queue->msgs[j].msg_hdr.msg_namelen = queue->msgs[i].msg_hdr.msg_namelen;
+		queue->iovecs[j].iov_len = queue->iovecs[i].iov_len;
+		mem_copy(queue->bufs[j], queue->bufs[i], queue->iovecs[i].iov_len);
+	}
+	queue->count -= start;
+	return sent;
+#else
+	return 0;
+#endif
+}
+
 int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size)
 {
 	int d = -1;
 
+#if defined(CONF_PLATFORM_LINUX)
+	if(sock->send_queue)
+	{
+		const int queued = priv_net_udp_enqueue(sock, addr, data, size);
+		if(queued < 0)
+			return -1;
+		if(queued > 0)
+		{
+			network_stats.sent_bytes += size;
+			network_stats.sent_packets++;
+			return size;
+		}
+	}
+#endif
+
 	if(addr->type & NETTYPE_IPV4)
 	{
 		if(sock->ipv4sock >= 0)
@@ -1651,6 +1829,7 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 				netaddr_to_sockaddr_in(addr, &sa);
 
 			d = sendto((int)sock->ipv4sock, (const char *)data, size, 0, (struct sockaddr *)&sa, sizeof(sa));
+			network_stats.sent_syscalls++;
 		}
 		else
 			dbg_msg("net", "can't send ipv4 traffic to this socket");
@@ -1689,6 +1868,7 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 				netaddr_to_sockaddr_in6(addr, &sa);
 
 			d = sendto((int)sock->ipv6sock, (const char *)data, size, 0, (struct sockaddr *)&sa, sizeof(sa));
+			network_stats.sent_syscalls++;
 		}
 		else
 			dbg_msg("net", "can't send ipv6 traffic to this socket");
@@ -1836,6 +2016,7 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data)
 
 int net_udp_close(NETSOCKET sock)
 {
+	net_udp_set_send_batching(sock, false);
 	return priv_net_close_all_sockets(sock);
 }
 
@@ -3576,7 +3757,11 @@ void str_escape(char **dst, const char *src, const char *end)
 
 void net_stats(NETSTATS *stats_inout)
 {
-	*stats_inout = network_stats;
+	stats_inout->sent_packets = network_stats.sent_packets.load(std::memory_order_relaxed);
+	stats_inout->sent_bytes = network_stats.sent_bytes.load(std::memory_order_relaxed);
+	stats_inout->sent_syscalls = network_stats.sent_syscalls.load(std::memory_order_relaxed);
+	stats_inout->recv_packets = network_stats.recv_packets.load(std::memory_order_relaxed);
+	stats_inout->recv_bytes = network_stats.recv_bytes.load(std::memory_order_relaxed);
 }
 
 int str_isspace(char c)
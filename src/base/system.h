@@ -338,7 +338,7 @@ int io_skip(IOHANDLE io, int size);
  *
  * @return `0` on success.
  */
-int io_seek(IOHANDLE io, int offset, int origin);
+int io_seek(IOHANDLE io, int64_t offset, int origin);
 
 /**
  * Gets the current position in the file.
@@ -349,7 +349,7 @@ int io_seek(IOHANDLE io, int offset, int origin);
  *
  * @return The current position, or `-1` on failure.
  */
-long int io_tell(IOHANDLE io);
+int64_t io_tell(IOHANDLE io);
 
 /**
  * Gets the total length of the file. Resets cursor to the beginning.
@@ -360,7 +360,7 @@ long int io_tell(IOHANDLE io);
  *
  * @return The total size, or `-1` on failure.
  */
-long int io_length(IOHANDLE io);
+int64_t io_length(IOHANDLE io);
 
 /**
  * Writes data from a buffer to a file.
@@ -958,6 +958,41 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 */
 int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data);
 
+/**
+ * Enables or disables batching of packets sent over an UDP socket.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ * @param enable Whether to batch outgoing packets.
+ *
+ * @return `true` if batching is enabled, `false` if it was disabled or is
+ * not supported on this platform.
+ *
+ * @remark While batching is enabled, @link net_udp_send @endlink only queues
+ * the packets, they are sent with as few syscalls as possible by
+ * @link net_udp_flush @endlink.
+ * @remark Disabling batching sends the queued packets.
+ * @remark To keep the packet order, packets are dropped while the socket
+ * buffer is full and queued packets are still waiting for it.
+ * @remark Only supported on Linux.
+ */
+bool net_udp_set_send_batching(NETSOCKET sock, bool enable);
+
+/**
+ * Sends all packets queued on an UDP socket with batching enabled.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ *
+ * @return The number of packets sent.
+ *
+ * @remark Packets that can't be sent because the socket buffer is full stay
+ * queued for the next call.
+ */
+int net_udp_flush(NETSOCKET sock);
+
 /**
  * Closes an UDP socket.
  *
@@ -2170,6 +2205,7 @@ typedef struct
 {
 	uint64_t sent_packets;
 	uint64_t sent_bytes;
+	uint64_t sent_syscalls;
 	uint64_t recv_packets;
 	uint64_t recv_bytes;
 } NETSTATS;
@@ -458,6 +458,7 @@ void CClient::OnEnterGame(bool Dummy)
 	m_aReceivedSnapshots[Dummy] = 0;
 	m_aSnapshotParts[Dummy] = 0;
 	m_aSnapshotIncomingDataSize[Dummy] = 0;
+	m_aSnapshotGeneration[Dummy]++;
 	m_SnapCrcErrors = 0;
 	// Also make gameclient aware that snapshots have been purged
 	GameClient()->InvalidateSnapshot();
@@ -1820,7 +1821,8 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy)
 				return;
 			}
 
-			int64_t Now = time_get();
+			// the time the timing arrived, not the one it is processed at
+			int64_t Now = m_aNetClient[Conn].RecvTime();
 
 			// adjust our prediction time
 			int64_t Target = 0;
@@ -1838,7 +1840,7 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy)
 			}
 
 			if(Target)
-				m_PredictedTime.Update(&m_InputtimeMarginGraph, Target, TimeLeft, CSmoothTime::ADJUSTDIRECTION_UP);
+				m_PredictedTime.Update(&m_InputtimeMarginGraph, Target, Now, TimeLeft, CSmoothTime::ADJUSTDIRECTION_UP);
 		}
 		else if(Msg == NETMSG_SNAP || Msg == NETMSG_SNAPSINGLE || Msg == NETMSG_SNAPEMPTY)
 		{
@@ -1894,18 +1896,15 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy)
 				if((NumParts < CSnapshot::MAX_PARTS && m_aSnapshotParts[Conn] == (((uint64_t)(1) << NumParts) - 1)) ||
 					(NumParts == CSnapshot::MAX_PARTS && m_aSnapshotParts[Conn] == std::numeric_limits<uint64_t>::max()))
 				{
-					unsigned char aTmpBuffer2[CSnapshot::MAX_SIZE];
-					unsigned char aTmpBuffer3[CSnapshot::MAX_SIZE];
-					CSnapshot *pTmpBuffer3 = (CSnapshot *)aTmpBuffer3; // Fix compiler warning for strict-aliasing
-
 					// reset snapshoting
 					m_aSnapshotParts[Conn] = 0;
 
 					// find snapshot that we should use as delta
 					const CSnapshot *pDeltaShot = CSnapshot::EmptySnapshot();
+					int DeltashotSize = sizeof(CSnapshot);
 					if(DeltaTick >= 0)
 					{
-						int DeltashotSize = m_aSnapshotStorage[Conn].Get(DeltaTick, nullptr, &pDeltaShot, nullptr);
+						DeltashotSize = m_aSnapshotStorage[Conn].Get(DeltaTick, nullptr, &pDeltaShot, nullptr);
 
 						if(DeltashotSize < 0)
 						{
@@ -1923,251 +1922,45 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy)
 						}
 					}
 
-					// decompress snapshot
-					const void *pDeltaData = m_SnapshotDelta.EmptyDelta();
-					int DeltaSize = sizeof(int) * 3;
-
-					if(m_aSnapshotIncomingDataSize[Conn])
-					{
-						int IntSize = CVariableInt::Decompress(m_aaSnapshotIncomingData[Conn], m_aSnapshotIncomingDataSize[Conn], aTmpBuffer2, sizeof(aTmpBuffer2));
-
-						if(IntSize < 0) // failure during decompression
-							return;
-
-						pDeltaData = aTmpBuffer2;
-						DeltaSize = IntSize;
-					}
-
-					// unpack delta
-					const int SnapSize = m_SnapshotDelta.UnpackDelta(pDeltaShot, pTmpBuffer3, pDeltaData, DeltaSize, IsSixup());
-					if(SnapSize < 0)
-					{
-						dbg_msg("client", "delta unpack failed. error=%d", SnapSize);
-						return;
-					}
-					if(!pTmpBuffer3->IsValid(SnapSize))
-					{
-						dbg_msg("client", "snapshot invalid. SnapSize=%d, DeltaSize=%d", SnapSize, DeltaSize);
-						return;
-					}
-
-					if(Msg != NETMSG_SNAPEMPTY && pTmpBuffer3->Crc() != Crc)
+					const auto &&FillJob = [&](CSnapshotUnpacker::CJob *pJob) {
+						pJob->m_Conn = Conn;
+						pJob->m_Dummy = Dummy;
+						pJob->m_Generation = m_aSnapshotGeneration[Conn];
+						pJob->m_GameTick = GameTick;
+						pJob->m_DeltaTick = DeltaTick;
+						pJob->m_Crc = Crc;
+						pJob->m_CheckCrc = Msg != NETMSG_SNAPEMPTY;
+						pJob->m_Sixup = IsSixup();
+						pJob->m_RecvTime = m_aNetClient[Conn].RecvTime();
+					};
+
+					if(g_Config.m_ClSnapshotThread)
 					{
-						log_error("client", "snapshot crc error #%d - tick=%d wantedcrc=%d gotcrc=%d compressed_size=%d delta_tick=%d",
-							m_SnapCrcErrors, GameTick, Crc, pTmpBuffer3->Crc(), m_aSnapshotIncomingDataSize[Conn], DeltaTick);
-
-						m_SnapCrcErrors++;
-						if(m_SnapCrcErrors > 10)
-						{
-							// to many errors, send reset
-							m_aAckGameTick[Conn] = -1;
-							SendInput();
-							m_SnapCrcErrors = 0;
-						}
-						return;
+						// decompress and unpack on the unpacker thread, the snapshot is added in PumpNetwork
+						if(!m_SnapshotUnpacker.IsRunning())
+							m_SnapshotUnpacker.Init(m_SnapshotDelta);
+						if(m_SnapshotUnpacker.IsFull())
+							ApplyUnpackedSnapshots(true);
+						CSnapshotUnpacker::CJob *pJob = m_SnapshotUnpacker.NewJob(m_aaSnapshotIncomingData[Conn], m_aSnapshotIncomingDataSize[Conn], pDeltaShot, DeltashotSize);
+						FillJob(pJob);
+						m_SnapshotUnpacker.Push();
 					}
 					else
 					{
-						if(m_SnapCrcErrors)
-							m_SnapCrcErrors--;
-					}
-
-					// purge old snapshots
-					int PurgeTick = DeltaTick;
-					if(m_aapSnapshots[Conn][SNAP_PREV] && m_aapSnapshots[Conn][SNAP_PREV]->m_Tick < PurgeTick)
-						PurgeTick = m_aapSnapshots[Conn][SNAP_PREV]->m_Tick;
-					if(m_aapSnapshots[Conn][SNAP_CURRENT] && m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick < PurgeTick)
-						PurgeTick = m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick;
-					m_aSnapshotStorage[Conn].PurgeUntil(PurgeTick);
-
-					// create a verified and unpacked snapshot
-					int AltSnapSize = -1;
-					unsigned char aAltSnapBuffer[CSnapshot::MAX_SIZE];
-					CSnapshot *pAltSnapBuffer = (CSnapshot *)aAltSnapBuffer;
-
-					if(IsSixup())
-					{
-						unsigned char aTmpTransSnapBuffer[CSnapshot::MAX_SIZE];
-						CSnapshot *pTmpTransSnapBuffer = (CSnapshot *)aTmpTransSnapBuffer;
-						mem_copy(pTmpTransSnapBuffer, pTmpBuffer3, CSnapshot::MAX_SIZE);
-						AltSnapSize = GameClient()->TranslateSnap(pAltSnapBuffer, pTmpTransSnapBuffer, Conn, Dummy);
-					}
-					else
-					{
-						AltSnapSize = UnpackAndValidateSnapshot(pTmpBuffer3, pAltSnapBuffer);
-					}
-
-					if(AltSnapSize < 0)
-					{
-						dbg_msg("client", "unpack snapshot and validate failed. error=%d", AltSnapSize);
-						return;
-					}
-
-					// add new
-					m_aSnapshotStorage[Conn].Add(GameTick, time_get(), SnapSize, pTmpBuffer3, AltSnapSize, pAltSnapBuffer);
-
-					if(!Dummy)
-					{
-						// for antiping: if the projectile netobjects from the server contains extra data, this is removed and the original content restored before recording demo
-						SnapshotRemoveExtraProjectileInfo(pTmpBuffer3);
-
-						unsigned char aSnapSeven[CSnapshot::MAX_SIZE];
-						CSnapshot *pSnapSeven = (CSnapshot *)aSnapSeven;
-						int DemoSnapSize = SnapSize;
-						if(IsSixup())
-						{
-							DemoSnapSize = GameClient()->OnDemoRecSnap7(pTmpBuffer3, pSnapSeven, Conn);
-							if(DemoSnapSize < 0)
-							{
-								dbg_msg("sixup", "demo snapshot failed. error=%d", DemoSnapSize);
-							}
-						}
-
-						if(DemoSnapSize >= 0)
-						{
-							// add snapshot to demo
-							for(auto &DemoRecorder : m_aDemoRecorder)
-							{
-								if(DemoRecorder.IsRecording())
-								{
-									// write snapshot
-									DemoRecorder.RecordSnapshot(GameTick, IsSixup() ? pSnapSeven : pTmpBuffer3, DemoSnapSize);
-								}
-							}
-						}
-					}
-
-					// apply snapshot, cycle pointers
-					m_aReceivedSnapshots[Conn]++;
-
-					// we got two snapshots until we see us self as connected
-					if(m_aReceivedSnapshots[Conn] == 2)
-					{
-						// start at 200ms and work from there
-						if(!Dummy)
-						{
-							m_PredictedTime.Init(GameTick * time_freq() / GameTickSpeed());
-							m_PredictedTime.SetAdjustSpeed(CSmoothTime::ADJUSTDIRECTION_UP, 1000.0f);
-							m_PredictedTime.UpdateMargin(PredictionMargin() * time_freq() / 1000);
-						}
-						m_aGameTime[Conn].Init((GameTick - 1) * time_freq() / GameTickSpeed());
-						m_aapSnapshots[Conn][SNAP_PREV] = m_aSnapshotStorage[Conn].m_pFirst;
-						m_aapSnapshots[Conn][SNAP_CURRENT] = m_aSnapshotStorage[Conn].m_pLast;
-						m_aPrevGameTick[Conn] = m_aapSnapshots[Conn][SNAP_PREV]->m_Tick;
-						m_aCurGameTick[Conn] = m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick;
-						if(!Dummy)
-						{
-							m_LocalStartTime = time_get();
-#if defined(CONF_VIDEORECORDER)
-							IVideo::SetLocalStartTime(m_LocalStartTime);
-#endif
-							GameClient()->OnNewSnapshot();
-						}
-						SetState(IClient::STATE_ONLINE);
-						if(!Dummy)
-						{
-							DemoRecorder_HandleAutoStart();
-						}
-					}
-
-					// adjust game time
-					if(m_aReceivedSnapshots[Conn] > 2)
-					{
-						int64_t Now = m_aGameTime[Conn].Get(time_get());
-						int64_t TickStart = GameTick * time_freq() / GameTickSpeed();
-						int64_t TimeLeft = (TickStart - Now) * 1000 / time_freq();
-						m_aGameTime[Conn].Update(&m_GametimeMarginGraph, (GameTick - 1) * time_freq() / GameTickSpeed(), TimeLeft, CSmoothTime::ADJUSTDIRECTION_DOWN);
+						// snapshots that are still being unpacked come first
+						ApplyUnpackedSnapshots(true);
+
+						char aDeltaData[CSnapshot::MAX_SIZE];
+						unsigned char aSnapData[CSnapshot::MAX_SIZE];
+						CSnapshotUnpacker::CJob Job;
+						Job.m_pData = m_aaSnapshotIncomingData[Conn];
+						Job.m_DataSize = m_aSnapshotIncomingDataSize[Conn];
+						Job.m_pDeltaShot = pDeltaShot;
+						Job.m_pSnap = (CSnapshot *)aSnapData;
+						FillJob(&Job);
+						CSnapshotUnpacker::Unpack(&m_SnapshotDelta, aDeltaData, &Job);
+						OnSnapshotUnpacked(&Job);
 					}
-					if(g_Config.m_ClRunOnJoinConsole && m_aReceivedSnapshots[Conn] > g_Config.m_ClRunOnJoinDelay && !m_aCodeRunAfterJoinConsole[Conn])
-					{
-						m_pConsole->ExecuteLine(g_Config.m_ClRunOnJoin);
-						m_aCodeRunAfterJoinConsole[Conn] = true;
-					}
-
-					if(m_aReceivedSnapshots[Conn] > GameTickSpeed() && !m_aCodeRunAfterJoin[Conn])
-					{
-						if(m_ServerCapabilities.m_ChatTimeoutCode)
-						{
-							CNetMsg_Cl_Say TOMsgp;
-							TOMsgp.m_Team = 0;
-							char aBufTO[256];
-							str_format(aBufTO, sizeof(aBufTO), "/timeout %s", m_aTimeoutCodes[Conn]);
-							TOMsgp.m_pMessage = aBufTO;
-							CMsgPacker PackerTO(TOMsgp.ms_MsgId, false);
-							TOMsgp.Pack(&PackerTO);
-							SendMsg(Conn, &PackerTO, MSGFLAG_VITAL);
-
-							char aBuf[128];
-							char aBufMsg[256];
-							//if(!g_Config.m_ClRunOnJoin[0] && !g_Config.m_ClDummyDefaultEyes && !g_Config.m_ClPlayerDefaultEyes)
-							//	str_format(aBufMsg, sizeof(aBufMsg), "/timeout %s", m_aTimeoutCodes[Conn]);
-							//else
-							//	str_format(aBufMsg, sizeof(aBufMsg), "/mc;timeout %s", m_aTimeoutCodes[Conn]);
-							str_copy(aBufMsg, "/mc");
-							bool HasMsg = false;
-							if(g_Config.m_ClRunOnJoin[0] && !g_Config.m_ClRunOnJoinConsole)
-							{
-								str_format(aBuf, sizeof(aBuf), ";%s", g_Config.m_ClRunOnJoin);
-								str_append(aBufMsg, aBuf);
-								HasMsg = true;
-							}
-							if(g_Config.m_ClDummyDefaultEyes || g_Config.m_ClPlayerDefaultEyes)
-							{
-								int Emote = ((g_Config.m_ClDummy) ? !Dummy : Dummy) ? g_Config.m_ClDummyDefaultEyes : g_Config.m_ClPlayerDefaultEyes;
-								char aBufEmote[128];
-								aBufEmote[0] = '\0';
-								switch(Emote)
-								{
-								case EMOTE_NORMAL:
-									break;
-								case EMOTE_PAIN:
-									str_format(aBufEmote, sizeof(aBufEmote), "emote pain %d", g_Config.m_ClEyeDuration);
-									break;
-								case EMOTE_HAPPY:
-									str_format(aBufEmote, sizeof(aBufEmote), "emote happy %d", g_Config.m_ClEyeDuration);
-									break;
-								case EMOTE_SURPRISE:
-									str_format(aBufEmote, sizeof(aBufEmote), "emote surprise %d", g_Config.m_ClEyeDuration);
-									break;
-								case EMOTE_ANGRY:
-									str_format(aBufEmote, sizeof(aBufEmote), "emote angry %d", g_Config.m_ClEyeDuration);
-									break;
-								case EMOTE_BLINK:
-									str_format(aBufEmote, sizeof(aBufEmote), "emote blink %d", g_Config.m_ClEyeDuration);
-									break;
-								}
-								if(aBufEmote[0])
-								{
-									str_format(aBuf, sizeof(aBuf), ";%s", aBufEmote);
-									str_append(aBufMsg, aBuf);
-									HasMsg = true;
-								}
-							}
-							if(IsSixup())
-							{
-								protocol7::CNetMsg_Cl_Say Msg7;
-								Msg7.m_Mode = protocol7::CHAT_ALL;
-								Msg7.m_Target = -1;
-								Msg7.m_pMessage = aBufMsg;
-								if(HasMsg)
-									SendPackMsg(Conn, &Msg7, MSGFLAG_VITAL, true);
-							}
-							else
-							{
-								CNetMsg_Cl_Say MsgP;
-								MsgP.m_Team = 0;
-								MsgP.m_pMessage = aBufMsg;
-								CMsgPacker PackerTimeout(&MsgP);
-								MsgP.Pack(&PackerTimeout);
-								if(HasMsg)
-									SendMsg(Conn, &PackerTimeout, MSGFLAG_VITAL);
-							}
-						}
-						m_aCodeRunAfterJoin[Conn] = true;
-					}
-
-					// ack snapshot
-					m_aAckGameTick[Conn] = GameTick;
 				}
 			}
 		}
@@ -2199,14 +1992,273 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy)
 		if(!Dummy)
 		{
 			for(auto &DemoRecorder : m_aDemoRecorder)
+			{
 				if(DemoRecorder.IsRecording())
+				{
+					// keep the order of snapshots and messages in the demo
+					ApplyUnpackedSnapshots(true);
 					DemoRecorder.RecordMessage(pPacket->m_pData, pPacket->m_DataSize);
+				}
+			}
 		}
 
 		GameClient()->OnMessage(Msg, &Unpacker, Conn, Dummy);
 	}
 }
 
+void CClient::OnSnapshotUnpacked(CSnapshotUnpacker::CJob *pJob)
+{
+	const int Conn = pJob->m_Conn;
+	const bool Dummy = pJob->m_Dummy;
+	const int GameTick = pJob->m_GameTick;
+	const int DeltaTick = pJob->m_DeltaTick;
+	const int SnapSize = pJob->m_SnapSize;
+	CSnapshot *pSnap = pJob->m_pSnap;
+
+	// the snapshots were reset or a newer snapshot was added since the job was queued
+	if(pJob->m_Generation != m_aSnapshotGeneration[Conn] || State() < IClient::STATE_LOADING || GameTick <= m_aAckGameTick[Conn])
+		return;
+
+	switch(pJob->m_Result)
+	{
+	case CSnapshotUnpacker::RESULT_DECOMPRESS_FAILED:
+		return;
+	case CSnapshotUnpacker::RESULT_UNPACK_FAILED:
+		dbg_msg("client", "delta unpack failed. error=%d", SnapSize);
+		return;
+	case CSnapshotUnpacker::RESULT_INVALID:
+		dbg_msg("client", "snapshot invalid. SnapSize=%d, DeltaSize=%d", SnapSize, pJob->m_DeltaSize);
+		return;
+	case CSnapshotUnpacker::RESULT_CRC_ERROR:
+		log_error("client", "snapshot crc error #%d - tick=%d wantedcrc=%d gotcrc=%d compressed_size=%d delta_tick=%d",
+			m_SnapCrcErrors, GameTick, pJob->m_Crc, pSnap->Crc(), pJob->m_DataSize, DeltaTick);
+
+		m_SnapCrcErrors++;
+		if(m_SnapCrcErrors > 10)
+		{
+			// to many errors, send reset
+			m_aAckGameTick[Conn] = -1;
+			SendInput();
+			m_SnapCrcErrors = 0;
+		}
+		return;
+	default:
+		if(m_SnapCrcErrors)
+			m_SnapCrcErrors--;
+	}
+
+	// purge old snapshots
+	int PurgeTick = DeltaTick;
+	if(m_aapSnapshots[Conn][SNAP_PREV] && m_aapSnapshots[Conn][SNAP_PREV]->m_Tick < PurgeTick)
+		PurgeTick = m_aapSnapshots[Conn][SNAP_PREV]->m_Tick;
+	if(m_aapSnapshots[Conn][SNAP_CURRENT] && m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick < PurgeTick)
+		PurgeTick = m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick;
+	m_aSnapshotStorage[Conn].PurgeUntil(PurgeTick);
+
+	// create a verified and unpacked snapshot
+	int AltSnapSize = -1;
+	unsigned char aAltSnapBuffer[CSnapshot::MAX_SIZE];
+	CSnapshot *pAltSnapBuffer = (CSnapshot *)aAltSnapBuffer;
+
+	if(IsSixup())
+	{
+		unsigned char aTmpTransSnapBuffer[CSnapshot::MAX_SIZE];
+		CSnapshot *pTmpTransSnapBuffer = (CSnapshot *)aTmpTransSnapBuffer;
+		mem_copy(pTmpTransSnapBuffer, pSnap, CSnapshot::MAX_SIZE);
+		AltSnapSize = GameClient()->TranslateSnap(pAltSnapBuffer, pTmpTransSnapBuffer, Conn, Dummy);
+	}
+	else
+	{
+		AltSnapSize = UnpackAndValidateSnapshot(pSnap, pAltSnapBuffer);
+	}
+
+	if(AltSnapSize < 0)
+	{
+		dbg_msg("client", "unpack snapshot and validate failed. error=%d", AltSnapSize);
+		return;
+	}
+
+	// add new
+	m_aSnapshotStorage[Conn].Add(GameTick, pJob->m_RecvTime, SnapSize, pSnap, AltSnapSize, pAltSnapBuffer);
+
+	if(!Dummy)
+	{
+		// for antiping: if the projectile netobjects from the server contains extra data, this is removed and the original content restored before recording demo
+		SnapshotRemoveExtraProjectileInfo(pSnap);
+
+		unsigned char aSnapSeven[CSnapshot::MAX_SIZE];
+		CSnapshot *pSnapSeven = (CSnapshot *)aSnapSeven;
+		int DemoSnapSize = SnapSize;
+		if(IsSixup())
+		{
+			DemoSnapSize = GameClient()->OnDemoRecSnap7(pSnap, pSnapSeven, Conn);
+			if(DemoSnapSize < 0)
+			{
+				dbg_msg("sixup", "demo snapshot failed. error=%d", DemoSnapSize);
+			}
+		}
+
+		if(DemoSnapSize >= 0)
+		{
+			// add snapshot to demo
+			for(auto &DemoRecorder : m_aDemoRecorder)
+			{
+				if(DemoRecorder.IsRecording())
+				{
+					// write snapshot
+					DemoRecorder.RecordSnapshot(GameTick, IsSixup() ? pSnapSeven : pSnap, DemoSnapSize);
+				}
+			}
+		}
+	}
+
+	// apply snapshot, cycle pointers
+	m_aReceivedSnapshots[Conn]++;
+
+	// we got two snapshots until we see us self as connected
+	if(m_aReceivedSnapshots[Conn] == 2)
+	{
+		// start at 200ms and work from there
+		if(!Dummy)
+		{
+			m_PredictedTime.Init(GameTick * time_freq() / GameTickSpeed());
+			m_PredictedTime.SetAdjustSpeed(CSmoothTime::ADJUSTDIRECTION_UP, 1000.0f);
+			m_PredictedTime.UpdateMargin(PredictionMargin() * time_freq() / 1000);
+		}
+		m_aGameTime[Conn].Init((GameTick - 1) * time_freq() / GameTickSpeed());
+		m_aapSnapshots[Conn][SNAP_PREV] = m_aSnapshotStorage[Conn].m_pFirst;
+		m_aapSnapshots[Conn][SNAP_CURRENT] = m_aSnapshotStorage[Conn].m_pLast;
+		m_aPrevGameTick[Conn] = m_aapSnapshots[Conn][SNAP_PREV]->m_Tick;
+		m_aCurGameTick[Conn] = m_aapSnapshots[Conn][SNAP_CURRENT]->m_Tick;
+		if(!Dummy)
+		{
+			m_LocalStartTime = time_get();
+#if defined(CONF_VIDEORECORDER)
+			IVideo::SetLocalStartTime(m_LocalStartTime);
+#endif
+			GameClient()->OnNewSnapshot();
+		}
+		SetState(IClient::STATE_ONLINE);
+		if(!Dummy)
+		{
+			DemoRecorder_HandleAutoStart();
+		}
+	}
+
+	// adjust game time
+	if(m_aReceivedSnapshots[Conn] > 2)
+	{
+		int64_t Now = m_aGameTime[Conn].Get(pJob->m_RecvTime);
+		int64_t TickStart = GameTick * time_freq() / GameTickSpeed();
+		int64_t TimeLeft = (TickStart - Now) * 1000 / time_freq();
+		m_aGameTime[Conn].Update(&m_GametimeMarginGraph, (GameTick - 1) * time_freq() / GameTickSpeed(), pJob->m_RecvTime, TimeLeft, CSmoothTime::ADJUSTDIRECTION_DOWN);
+	}
+	if(g_Config.m_ClRunOnJoinConsole && m_aReceivedSnapshots[Conn] > g_Config.m_ClRunOnJoinDelay && !m_aCodeRunAfterJoinConsole[Conn])
+	{
+		m_pConsole->ExecuteLine(g_Config.m_ClRunOnJoin);
+		m_aCodeRunAfterJoinConsole[Conn] = true;
+	}
+
+	if(m_aReceivedSnapshots[Conn] > GameTickSpeed() && !m_aCodeRunAfterJoin[Conn])
+	{
+		if(m_ServerCapabilities.m_ChatTimeoutCode)
+		{
+			CNetMsg_Cl_Say TOMsgp;
+			TOMsgp.m_Team = 0;
+			char aBufTO[256];
+			str_format(aBufTO, sizeof(aBufTO), "/timeout %s", m_aTimeoutCodes[Conn]);
+			TOMsgp.m_pMessage = aBufTO;
+			CMsgPacker PackerTO(TOMsgp.ms_MsgId, false);
+			TOMsgp.Pack(&PackerTO);
+			SendMsg(Conn, &PackerTO, MSGFLAG_VITAL);
+
+			char aBuf[128];
+			char aBufMsg[256];
+			//if(!g_Config.m_ClRunOnJoin[0] && !g_Config.m_ClDummyDefaultEyes && !g_Config.m_ClPlayerDefaultEyes)
+			//	str_format(aBufMsg, sizeof(aBufMsg), "/timeout %s", m_aTimeoutCodes[Conn]);
+			//else
+			//	str_format(aBufMsg, sizeof(aBufMsg), "/mc;timeout %s", m_aTimeoutCodes[Conn]);
+			str_copy(aBufMsg, "/mc");
+			bool HasMsg = false;
+			if(g_Config.m_ClRunOnJoin[0] && !g_Config.m_ClRunOnJoinConsole)
+			{
+				str_format(aBuf, sizeof(aBuf), ";%s", g_Config.m_ClRunOnJoin);
+				str_append(aBufMsg, aBuf);
+				HasMsg = true;
+			}
+			if(g_Config.m_ClDummyDefaultEyes || g_Config.m_ClPlayerDefaultEyes)
+			{
+				int Emote = ((g_Config.m_ClDummy) ? !Dummy : Dummy) ? g_Config.m_ClDummyDefaultEyes : g_Config.m_ClPlayerDefaultEyes;
+				char aBufEmote[128];
+				aBufEmote[0] = '\0';
+				switch(Emote)
+				{
+				case EMOTE_NORMAL:
+					break;
+				case EMOTE_PAIN:
+					str_format(aBufEmote, sizeof(aBufEmote), "emote pain %d", g_Config.m_ClEyeDuration);
+					break;
+				case EMOTE_HAPPY:
+					str_format(aBufEmote, sizeof(aBufEmote), "emote happy %d", g_Config.m_ClEyeDuration);
+					break;
+				case EMOTE_SURPRISE:
+					str_format(aBufEmote, sizeof(aBufEmote), "emote surprise %d", g_Config.m_ClEyeDuration);
+					break;
+				case EMOTE_ANGRY:
+					str_format(aBufEmote, sizeof(aBufEmote), "emote angry %d", g_Config.m_ClEyeDuration);
+					break;
+				case EMOTE_BLINK:
+					str_format(aBufEmote, sizeof(aBufEmote), "emote blink %d", g_Config.m_ClEyeDuration);
+					break;
+				}
+				if(aBufEmote[0])
+				{
+					str_format(aBuf, sizeof(aBuf), ";%s", aBufEmote);
+					str_append(aBufMsg, aBuf);
+					HasMsg = true;
+				}
+			}
+			if(IsSixup())
+			{
+				protocol7::CNetMsg_Cl_Say Msg7;
+				Msg7.m_Mode = protocol7::CHAT_ALL;
+				Msg7.m_Target = -1;
+				Msg7.m_pMessage = aBufMsg;
+				if(HasMsg)
+					SendPackMsg(Conn, &Msg7, MSGFLAG_VITAL, true);
+			}
+			else
+			{
+				CNetMsg_Cl_Say MsgP;
+				MsgP.m_Team = 0;
+				MsgP.m_pMessage = aBufMsg;
+				CMsgPacker PackerTimeout(&MsgP);
+				MsgP.Pack(&PackerTimeout);
+				if(HasMsg)
+					SendMsg(Conn, &PackerTimeout, MSGFLAG_VITAL);
+			}
+		}
+		m_aCodeRunAfterJoin[Conn] = true;
+	}
+
+	// ack snapshot
+	m_aAckGameTick[Conn] = GameTick;
+}
+
+void CClient::ApplyUnpackedSnapshots(bool Wait)
+{
+	if(!m_SnapshotUnpacker.IsRunning())
+		return;
+	while(m_SnapshotUnpacker.NumPending())
+	{
+		CSnapshotUnpacker::CJob *pJob = m_SnapshotUnpacker.Finished(Wait);
+		if(!pJob)
+			break;
+		OnSnapshotUnpacked(pJob);
+		m_SnapshotUnpacker.Pop();
+	}
+}
+
 int CClient::UnpackAndValidateSnapshot(CSnapshot *pFrom, CSnapshot *pTo)
 {
 	CUnpacker Unpacker;
@@ -2490,6 +2542,10 @@ void CClient::PumpNetwork()
 {
 	for(auto &NetClient : m_aNetClient)
 	{
+		if(g_Config.m_ClNetThread && !NetClient.RecvThreadRunning())
+			NetClient.StartRecvThread();
+		else if(!g_Config.m_ClNetThread && NetClient.RecvThreadRunning())
+			NetClient.StopRecvThread();
 		NetClient.Update();
 	}
 
@@ -2550,6 +2606,8 @@ void CClient::PumpNetwork()
 			}
 		}
 	}
+
+	ApplyUnpackedSnapshots(false);
 }
 
 void CClient::OnDemoPlayerSnapshot(void *pData, int Size)
@@ -3300,7 +3358,15 @@ void CClient::Run()
 			auto NowInner = Now;
 			while((SleepTimeInNanoSecondsInner / std::chrono::nanoseconds(1us).count()) > 0ns)
 			{
-				net_socket_read_wait(m_aNetClient[CONN_MAIN].m_Socket, SleepTimeInNanoSecondsInner);
+				// the receive thread takes the packets out of the socket, wake
+				// up to handle them as soon as it queued one
+				if(m_aNetClient[CONN_MAIN].RecvThreadRunning())
+				{
+					if(m_aNetClient[CONN_MAIN].RecvThreadWait(SleepTimeInNanoSecondsInner))
+						break;
+				}
+				else
+					net_socket_read_wait(m_aNetClient[CONN_MAIN].m_Socket, SleepTimeInNanoSecondsInner);
 				auto NowInnerCalc = time_get_nanoseconds();
 				SleepTimeInNanoSecondsInner -= (NowInnerCalc - NowInner);
 				NowInner = NowInnerCalc;
@@ -3348,6 +3414,9 @@ void CClient::Run()
 	GameClient()->OnShutdown();
 	delete m_pEditor;
 
+	if(m_SnapshotUnpacker.IsRunning())
+		m_SnapshotUnpacker.Shutdown();
+
 	// close sockets
 	for(unsigned int i = 0; i < std::size(m_aNetClient); i++)
 		m_aNetClient[i].Close();
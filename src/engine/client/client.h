@@ -26,6 +26,7 @@
 
 #include "graph.h"
 #include "smooth_time.h"
+#include "snapshot_unpacker.h"
 
 class CDemoEdit;
 class IDemoRecorder;
@@ -198,11 +199,14 @@ class CClient : public IClient, public CDemoPlayer::IListener
 	int m_aReceivedSnapshots[NUM_DUMMIES] = {0, 0};
 	char m_aaSnapshotIncomingData[NUM_DUMMIES][CSnapshot::MAX_SIZE];
 	int m_aSnapshotIncomingDataSize[NUM_DUMMIES] = {0, 0};
+	// incremented when the snapshots are reset, to drop the ones still being unpacked
+	int m_aSnapshotGeneration[NUM_DUMMIES] = {0, 0};
 
 	CSnapshotStorage::CHolder m_aDemorecSnapshotHolders[NUM_SNAPSHOT_TYPES];
 	char m_aaaDemorecSnapshotData[NUM_SNAPSHOT_TYPES][2][CSnapshot::MAX_SIZE];
 
 	CSnapshotDelta m_SnapshotDelta;
+	CSnapshotUnpacker m_SnapshotUnpacker;
 
 	std::deque<std::shared_ptr<CDemoEdit>> m_EditJobs;
 
@@ -362,6 +366,8 @@ public:
 	void ProcessServerInfo(int Type, NETADDR *pFrom, const void *pData, int DataSize);
 	void ProcessServerPacket(CNetChunk *pPacket, int Conn, bool Dummy);
 
+	void OnSnapshotUnpacked(CSnapshotUnpacker::CJob *pJob);
+	void ApplyUnpackedSnapshots(bool Wait);
 	int UnpackAndValidateSnapshot(CSnapshot *pFrom, CSnapshot *pTo);
 
 	void ResetMapDownload(bool ResetActive);
@@ -49,22 +49,23 @@ int64_t CSmoothTime::Get(int64_t Now) const
 	return r + m_Margin;
 }
 
-void CSmoothTime::UpdateInt(int64_t Target)
+void CSmoothTime::UpdateInt(int64_t Target, int64_t TargetTime)
 {
+	int64_t Now = time_get();
+	// the target got older while the packet it came from waited to be processed
+	Target += Now - TargetTime;
 	if (g_Config.m_ClSmoothPredictionMargin) {
-		int64_t Now = time_get();
 		m_Current = Get(Now) - GetMargin(Now);
 		m_Snap = Now;
 		m_Target = Target - GetMargin(Now);
 		return;
 	}
-	int64_t Now = time_get();
 	m_Current = Get(Now) - m_Margin;
 	m_Snap = Now;
 	m_Target = Target;
 }
 
-void CSmoothTime::Update(CGraph *pGraph, int64_t Target, int TimeLeft, EAdjustDirection AdjustDirection)
+void CSmoothTime::Update(CGraph *pGraph, int64_t Target, int64_t TargetTime, int TimeLeft, EAdjustDirection AdjustDirection)
 {
 	bool UpdateTimer = true;
 
@@ -106,7 +107,7 @@ void CSmoothTime::Update(CGraph *pGraph, int64_t Target, int TimeLeft, EAdjustDi
 	}
 
 	if(UpdateTimer)
-		UpdateInt(Target);
+		UpdateInt(Target, TargetTime);
 }
 
 void CSmoothTime::UpdateMargin(int64_t Margin)
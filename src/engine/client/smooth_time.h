@@ -36,8 +36,9 @@ public:
 
 	int64_t Get(int64_t Now) const;
 
-	void UpdateInt(int64_t Target);
-	void Update(CGraph *pGraph, int64_t Target, int TimeLeft, EAdjustDirection AdjustDirection);
+	// `Target` is the time that should have been reached at `TargetTime`
+	void UpdateInt(int64_t Target, int64_t TargetTime);
+	void Update(CGraph *pGraph, int64_t Target, int64_t TargetTime, int TimeLeft, EAdjustDirection AdjustDirection);
 
 	void UpdateMargin(int64_t Margin);
 	int64_t GetMargin(int64_t Now) const;
@@ -0,0 +1,142 @@
+#include "snapshot_unpacker.h"
+
+#include <engine/shared/compression.h>
+
+CSnapshotUnpacker::CSnapshotUnpacker() :
+	m_NumQueued(0),
+	m_NumTaken(0),
+	m_NumDone(0),
+	m_pThread(nullptr),
+	m_Shutdown(false)
+{
+}
+
+CSnapshotUnpacker::~CSnapshotUnpacker()
+{
+	if(IsRunning())
+	{
+		Shutdown();
+	}
+}
+
+void CSnapshotUnpacker::Unpack(CSnapshotDelta *pDelta, char *pDeltaData, CJob *pJob)
+{
+	const void *pUnpackData = pDelta->EmptyDelta();
+	pJob->m_DeltaSize = sizeof(int) * 3;
+	pJob->m_SnapSize = 0;
+
+	if(pJob->m_DataSize)
+	{
+		const int IntSize = CVariableInt::Decompress(pJob->m_pData, pJob->m_DataSize, pDeltaData, CSnapshot::MAX_SIZE);
+		if(IntSize < 0)
+		{
+			pJob->m_Result = RESULT_DECOMPRESS_FAILED;
+			return;
+		}
+		pUnpackData = pDeltaData;
+		pJob->m_DeltaSize = IntSize;
+	}
+
+	pJob->m_SnapSize = pDelta->UnpackDelta(pJob->m_pDeltaShot, pJob->m_pSnap, pUnpackData, pJob->m_DeltaSize, pJob->m_Sixup);
+	if(pJob->m_SnapSize < 0)
+		pJob->m_Result = RESULT_UNPACK_FAILED;
+	else if(!pJob->m_pSnap->IsValid(pJob->m_SnapSize))
+		pJob->m_Result = RESULT_INVALID;
+	else if(pJob->m_CheckCrc && pJob->m_pSnap->Crc() != pJob->m_Crc)
+		pJob->m_Result = RESULT_CRC_ERROR;
+	else
+		pJob->m_Result = RESULT_OK;
+}
+
+void CSnapshotUnpacker::Thread(void *pUser)
+{
+	CSnapshotUnpacker *pSelf = static_cast<CSnapshotUnpacker *>(pUser);
+	while(true)
+	{
+		sphore_wait(&pSelf->m_Work);
+		if(pSelf->m_Shutdown)
+			break;
+		const unsigned Index = pSelf->m_NumDone.load(std::memory_order_relaxed);
+		Unpack(pSelf->m_pDelta.get(), pSelf->m_aDeltaData, &pSelf->m_apSlots[Index % QUEUE_SIZE]->m_Job);
+		pSelf->m_NumDone.store(Index + 1, std::memory_order_release);
+		sphore_signal(&pSelf->m_Done);
+	}
+}
+
+void CSnapshotUnpacker::Init(const CSnapshotDelta &Delta)
+{
+	dbg_assert(!IsRunning(), "Snapshot unpacker already running");
+	for(auto &pSlot : m_apSlots)
+	{
+		if(!pSlot)
+			pSlot = std::make_unique<CSlot>();
+	}
+	m_pDelta = std::make_unique<CSnapshotDelta>(Delta);
+	m_NumQueued = 0;
+	m_NumTaken = 0;
+	m_NumDone = 0;
+	m_Shutdown = false;
+	sphore_init(&m_Work);
+	sphore_init(&m_Done);
+	m_pThread = thread_init(Thread, this, "snap unpacker");
+}
+
+void CSnapshotUnpacker::Shutdown()
+{
+	dbg_assert(IsRunning(), "Snapshot unpacker not running");
+	m_Shutdown = true;
+	sphore_signal(&m_Work);
+	thread_wait(m_pThread);
+	m_pThread = nullptr;
+	sphore_destroy(&m_Work);
+	sphore_destroy(&m_Done);
+	// jobs that weren't taken yet are dropped
+	m_NumQueued = 0;
+	m_NumTaken = 0;
+	m_NumDone = 0;
+}
+
+CSnapshotUnpacker::CJob *CSnapshotUnpacker::NewJob(const void *pData, int DataSize, const CSnapshot *pDeltaShot, int DeltaShotSize)
+{
+	dbg_assert(IsRunning(), "Snapshot unpacker not running");
+	dbg_assert(!IsFull(), "Snapshot unpacker queue full");
+	CSlot *pSlot = m_apSlots[m_NumQueued % QUEUE_SIZE].get();
+	mem_copy(pSlot->m_aData, pData, DataSize);
+	mem_copy(pSlot->m_aDeltaShot, pDeltaShot, DeltaShotSize);
+
+	CJob *pJob = &pSlot->m_Job;
+	pJob->m_pData = pSlot->m_aData;
+	pJob->m_DataSize = DataSize;
+	pJob->m_pDeltaShot = (CSnapshot *)pSlot->m_aDeltaShot;
+	pJob->m_pSnap = (CSnapshot *)pSlot->m_aSnap;
+	return pJob;
+}
+
+void CSnapshotUnpacker::Push()
+{
+	m_NumQueued++;
+	sphore_signal(&m_Work);
+}
+
+CSnapshotUnpacker::CJob *CSnapshotUnpacker::Finished(bool Wait)
+{
+	if(!NumPending())
+	{
+		dbg_assert(!Wait, "No snapshot to wait for");
+		return nullptr;
+	}
+	while(m_NumDone.load(std::memory_order_acquire) == m_NumTaken)
+	{
+		if(!Wait)
+			return nullptr;
+		// signals of jobs that were taken without waiting are consumed here as well
+		sphore_wait(&m_Done);
+	}
+	return &m_apSlots[m_NumTaken % QUEUE_SIZE]->m_Job;
+}
+
+void CSnapshotUnpacker::Pop()
+{
+	dbg_assert(NumPending() > 0, "No snapshot to pop");
+	m_NumTaken++;
+}
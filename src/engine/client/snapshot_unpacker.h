@@ -0,0 +1,135 @@
+#ifndef ENGINE_CLIENT_SNAPSHOT_UNPACKER_H
+#define ENGINE_CLIENT_SNAPSHOT_UNPACKER_H
+
+#include <base/system.h>
+
+#include <engine/shared/snapshot.h>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * Decompresses and unpacks the snapshots received from the server,
+ * optionally on a separate thread.
+ *
+ * The parts of a snapshot are still received and reassembled on the main
+ * thread, which also looks up the delta snapshot. Complete snapshots are
+ * handed to the thread through a single producer, single consumer queue and
+ * the unpacked results are taken out in the same order, to be added to the
+ * snapshot storage on the main thread.
+ */
+class CSnapshotUnpacker
+{
+public:
+	enum
+	{
+		RESULT_OK = 0,
+		RESULT_DECOMPRESS_FAILED,
+		RESULT_UNPACK_FAILED,
+		RESULT_INVALID,
+		RESULT_CRC_ERROR,
+	};
+
+	class CJob
+	{
+	public:
+		int m_Conn;
+		// whether the connection was the dummy when the snapshot was received
+		bool m_Dummy;
+		// snapshot state of the connection the job was created for
+		int m_Generation;
+		int m_GameTick;
+		int m_DeltaTick;
+		unsigned m_Crc;
+		bool m_CheckCrc;
+		bool m_Sixup;
+		int64_t m_RecvTime;
+
+		// compressed delta, empty if there is none
+		const void *m_pData;
+		int m_DataSize;
+		const CSnapshot *m_pDeltaShot;
+
+		// result, the sizes are only set as far as the unpacking got
+		int m_Result;
+		int m_DeltaSize;
+		int m_SnapSize;
+		CSnapshot *m_pSnap;
+	};
+
+	/**
+	 * Decompresses and unpacks the delta of a single job.
+	 *
+	 * @param pDelta The delta to use, must not be shared with other threads.
+	 * @param pDeltaData Scratch buffer of at least `CSnapshot::MAX_SIZE` bytes.
+	 * @param pJob The job to process, `m_pSnap` must point to a buffer of
+	 * at least `CSnapshot::MAX_SIZE` bytes.
+	 */
+	static void Unpack(CSnapshotDelta *pDelta, char *pDeltaData, CJob *pJob);
+
+private:
+	enum
+	{
+		QUEUE_SIZE = 4,
+	};
+
+	class CSlot
+	{
+	public:
+		CJob m_Job;
+		char m_aData[CSnapshot::MAX_SIZE];
+		char m_aDeltaShot[CSnapshot::MAX_SIZE];
+		char m_aSnap[CSnapshot::MAX_SIZE];
+	};
+
+	std::unique_ptr<CSlot> m_apSlots[QUEUE_SIZE];
+	// only touched by the main thread
+	unsigned m_NumQueued;
+	unsigned m_NumTaken;
+	// advanced by the unpacker thread
+	std::atomic<unsigned> m_NumDone;
+
+	void *m_pThread;
+	SEMAPHORE m_Work;
+	SEMAPHORE m_Done;
+	std::atomic<bool> m_Shutdown;
+	std::unique_ptr<CSnapshotDelta> m_pDelta;
+	char m_aDeltaData[CSnapshot::MAX_SIZE];
+
+	static void Thread(void *pUser);
+
+public:
+	CSnapshotUnpacker();
+	~CSnapshotUnpacker();
+
+	/**
+	 * Starts the unpacker thread.
+	 *
+	 * @param Delta Delta with the static item sizes set, copied for the thread.
+	 */
+	void Init(const CSnapshotDelta &Delta);
+	void Shutdown();
+	bool IsRunning() const { return m_pThread != nullptr; }
+
+	int NumPending() const { return m_NumQueued - m_NumTaken; }
+	bool IsFull() const { return NumPending() == QUEUE_SIZE; }
+
+	/**
+	 * Returns the next job with copies of the given data, to be filled in
+	 * and queued with `Push`. The queue must not be full.
+	 */
+	CJob *NewJob(const void *pData, int DataSize, const CSnapshot *pDeltaShot, int DeltaShotSize);
+	void Push();
+
+	/**
+	 * Returns the oldest job if it is unpacked, `nullptr` otherwise.
+	 * The job stays valid until it is released with `Pop`.
+	 *
+	 * @param Wait Whether to block until the oldest job is unpacked,
+	 * there must be a pending job then.
+	 */
+	CJob *Finished(bool Wait);
+	void Pop();
+};
+
+#endif
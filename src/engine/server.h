@@ -365,6 +365,26 @@ public:
 
 	virtual void FillAntibot(CAntibotRoundData *pData) = 0;
 
+	// Rounded position of the client's character like the teehistorian
+	// records it, returns false if the client has no character.
+	virtual bool CharacterPos(int ClientId, int *pX, int *pY) const = 0;
+
+	class CEntityTickStats
+	{
+	public:
+		const char *m_pName;
+		// nanoseconds
+		int64_t m_Duration;
+		int64_t m_NumTicked;
+	};
+	// Measures the time spent ticking the entities from now on, off by
+	// default as it reads the clock several times per tick.
+	virtual void EnableEntityTickStats() = 0;
+	// Time spent ticking the game world's entities by type since the
+	// start of the game, returns the number of types. The durations are
+	// zero unless enabled.
+	virtual int EntityTickStats(CEntityTickStats *pStats, int MaxStats) const = 0;
+
 	/**
 	 * Used to report custom player info to master servers.
 	 *
@@ -11,12 +11,14 @@
 #include <engine/server/databases/connection.h>
 #include <engine/server/server.h>
 #include <engine/server/server_logger.h>
+#include <engine/server/teehistorian_replay.h>
 
 #include <engine/shared/assertion_logger.h>
 #include <engine/shared/config.h>
 
 #include <game/version.h>
 
+#include <memory>
 #include <vector>
 
 #if defined(CONF_FAMILY_WINDOWS)
@@ -153,8 +155,34 @@ int main(int argc, const char **argv)
 	// register all console commands
 	pServer->RegisterCommands();
 
+	// `--replay <file>` replays a teehistorian file instead of running the
+	// server, the remaining arguments are passed to the console
+	const char *pReplayFile = nullptr;
+	std::vector<const char *> vpArguments;
+	for(int i = 1; i < argc; i++)
+	{
+		if(str_comp("--replay", argv[i]) == 0 && i + 1 < argc)
+			pReplayFile = argv[++i];
+		else
+			vpArguments.push_back(argv[i]);
+	}
+
+	std::unique_ptr<CTeeHistorianReplay> pReplay;
+	if(pReplayFile)
+	{
+		pReplay = std::make_unique<CTeeHistorianReplay>(pServer);
+		if(!pReplay->Load(pStorage, pReplayFile))
+		{
+			delete pKernel;
+			MysqlUninit();
+			secure_random_uninit();
+			return -1;
+		}
+		// use the config of the recorded server instead of the local one
+		pReplay->ApplyConfig(pConsole);
+	}
 	// execute autoexec file
-	if(pStorage->FileExists(AUTOEXEC_SERVER_FILE, IStorage::TYPE_ALL))
+	else if(pStorage->FileExists(AUTOEXEC_SERVER_FILE, IStorage::TYPE_ALL))
 	{
 		pConsole->ExecuteFile(AUTOEXEC_SERVER_FILE);
 	}
@@ -164,8 +192,8 @@ int main(int argc, const char **argv)
 	}
 
 	// parse the command line arguments
-	if(argc > 1)
-		pConsole->ParseArguments(argc - 1, &argv[1]);
+	if(!vpArguments.empty())
+		pConsole->ParseArguments(vpArguments.size(), vpArguments.data());
 
 	pConfigManager->SetReadOnly("sv_max_clients", true);
 	pConfigManager->SetReadOnly("sv_test_cmds", true);
@@ -195,8 +223,9 @@ int main(int argc, const char **argv)
 
 	// run the server
 	log_trace("server", "initialization finished after %.2fms, starting...", (time_get() - MainStart) * 1000.0f / (float)time_freq());
-	int Ret = pServer->Run();
+	int Ret = pReplay ? pReplay->Run() : pServer->Run();
 
+	pReplay.reset();
 	pServerLogger->OnServerDeletion();
 	// free
 	delete pKernel;
@@ -39,6 +39,7 @@
 
 // DDRace
 #include <engine/shared/linereader.h>
+#include <algorithm>
 #include <vector>
 #include <zlib.h>
 
@@ -234,6 +235,12 @@ CServer::CServer()
 	m_CurrentGameTick = MIN_TICK;
 	m_RunServer = UNINITIALIZED;
 
+	mem_zero(&m_LastNetStats, sizeof(m_LastNetStats));
+	m_LastNetStatsTick = 0;
+	m_NextTickProfileEcon = 0;
+	m_SnapshotBandwidthFile = nullptr;
+	m_NextSnapshotBandwidthDump = 0;
+
 	m_aShutdownReason[0] = 0;
 
 	for(int i = 0; i < NUM_MAP_TYPES; i++)
@@ -878,8 +885,89 @@ void CServer::SendMsgRaw(int ClientId, const void *pData, int Size, int Flags)
 	m_NetServer.Send(&Packet);
 }
 
+void CServer::SendSnapshot(const CSnapshotWorkers::CTask *pTask)
+{
+	const int ClientId = pTask->m_ClientId;
+	const CSnapshotWorkers::CTask *pResult = pTask->Result();
+	if(pResult->m_CompSize)
+	{
+		const int MaxSize = MAX_SNAPSHOT_PACKSIZE;
+		const int SnapshotSize = pResult->m_CompSize;
+		int NumPackets = (SnapshotSize + MaxSize - 1) / MaxSize;
+
+		for(int n = 0, Left = SnapshotSize; Left > 0; n++)
+		{
+			int Chunk = Left < MaxSize ? Left : MaxSize;
+			Left -= Chunk;
+
+			if(NumPackets == 1)
+			{
+				CMsgPacker Msg(NETMSG_SNAPSINGLE, true);
+				Msg.AddInt(m_CurrentGameTick);
+				Msg.AddInt(m_CurrentGameTick - pTask->m_DeltaTick);
+				Msg.AddInt(pTask->m_Crc);
+				Msg.AddInt(Chunk);
+				Msg.AddRaw(&pResult->m_aCompData[n * MaxSize], Chunk);
+				SendMsg(&Msg, MSGFLAG_FLUSH, ClientId);
+			}
+			else
+			{
+				CMsgPacker Msg(NETMSG_SNAP, true);
+				Msg.AddInt(m_CurrentGameTick);
+				Msg.AddInt(m_CurrentGameTick - pTask->m_DeltaTick);
+				Msg.AddInt(NumPackets);
+				Msg.AddInt(n);
+				Msg.AddInt(pTask->m_Crc);
+				Msg.AddInt(Chunk);
+				Msg.AddRaw(&pResult->m_aCompData[n * MaxSize], Chunk);
+				SendMsg(&Msg, MSGFLAG_FLUSH, ClientId);
+			}
+		}
+	}
+	else
+	{
+		CMsgPacker Msg(NETMSG_SNAPEMPTY, true);
+		Msg.AddInt(m_CurrentGameTick);
+		Msg.AddInt(m_CurrentGameTick - pTask->m_DeltaTick);
+		SendMsg(&Msg, MSGFLAG_FLUSH, ClientId);
+	}
+}
+
+#ifdef CONF_DEBUG
+bool CServer::CheckSnapCulling(int ClientId, const CSnapshot *pSnapshot, int SnapshotSize)
+{
+	char aData[CSnapshot::MAX_SIZE];
+	CSnapshot *pUnculled = (CSnapshot *)aData;
+
+	const int SnapCulling = Config()->m_SvSnapCulling;
+	Config()->m_SvSnapCulling = 0;
+	m_SnapshotBuilder.Init(m_aClients[ClientId].m_Sixup);
+	GameServer()->OnSnap(ClientId);
+	const int UnculledSize = m_SnapshotBuilder.Finish(pUnculled);
+	Config()->m_SvSnapCulling = SnapCulling;
+
+	// compare by item, the extended item type registrations can be ordered differently
+	bool Same = UnculledSize == SnapshotSize && pUnculled->NumItems() == pSnapshot->NumItems() && pUnculled->Crc() == pSnapshot->Crc();
+	for(int i = 0; Same && i < pSnapshot->NumItems(); i++)
+	{
+		const int Type = pSnapshot->GetItemType(i);
+		if(Type == 0) // extended item type registration
+			continue;
+		const void *pUnculledData = pUnculled->FindItem(Type, pSnapshot->GetItem(i)->Id());
+		Same = pUnculledData && mem_comp(pUnculledData, pSnapshot->GetItem(i)->Data(), pSnapshot->GetItemSize(i)) == 0;
+	}
+	if(!Same)
+	{
+		log_error("snapshot", "snap culling changed the snapshot of ClientId=%d size=%d/%d crc=%08x/%08x",
+			ClientId, SnapshotSize, UnculledSize, pSnapshot->Crc(), pUnculled->Crc());
+	}
+	return Same;
+}
+#endif
+
 void CServer::DoSnapshot()
 {
+	CTickProfiler::CScope ProfileScope(&m_TickProfiler, CTickProfiler::PHASE_SNAPSHOT);
 	GameServer()->OnPreSnap();
 
 	if(m_aDemoRecorder[RECORDER_MANUAL].IsRecording() || m_aDemoRecorder[RECORDER_AUTO].IsRecording())
@@ -899,6 +987,17 @@ void CServer::DoSnapshot()
 			m_aDemoRecorder[RECORDER_AUTO].RecordSnapshot(Tick(), aData, SnapshotSize);
 	}
 
+	// (re)start the worker threads if the configuration changed
+	if(m_SnapshotWorkers.NumThreads() != Config()->m_SvSnapshotThreads)
+	{
+		if(m_SnapshotWorkers.NumThreads())
+			m_SnapshotWorkers.Shutdown();
+		if(Config()->m_SvSnapshotThreads)
+			m_SnapshotWorkers.Init(Config()->m_SvSnapshotThreads, m_SnapshotDelta);
+	}
+
+	int NumTasks = 0;
+
 	// create snapshots for all clients
 	for(int i = 0; i < MaxClients(); i++)
 	{
@@ -924,28 +1023,39 @@ void CServer::DoSnapshot()
 			CSnapshot *pData = (CSnapshot *)aData; // Fix compiler warning for strict-aliasing
 			int SnapshotSize = m_SnapshotBuilder.Finish(pData);
 
+#ifdef CONF_DEBUG
+			if(Config()->m_DbgSnapCulling)
+				CheckSnapCulling(i, pData, SnapshotSize);
+#endif
+
 			if(m_aDemoRecorder[i].IsRecording())
 			{
 				// write snapshot
 				m_aDemoRecorder[i].RecordSnapshot(Tick(), aData, SnapshotSize);
 			}
 
-			int Crc = pData->Crc();
-
 			// remove old snapshots
 			// keep 3 seconds worth of snapshots
 			m_aClients[i].m_Snapshots.PurgeUntil(m_CurrentGameTick - TickSpeed() * 3);
 
-			// save the snapshot
+			// save the snapshot, the storage computes its crc
 			m_aClients[i].m_Snapshots.Add(m_CurrentGameTick, time_get(), SnapshotSize, pData, 0, nullptr);
+			const CSnapshotStorage::CHolder *pCurrent = m_aClients[i].m_Snapshots.m_pLast;
 
 			// find snapshot that we can perform delta against
 			int DeltaTick = -1;
 			const CSnapshot *pDeltashot = CSnapshot::EmptySnapshot();
+			int DeltashotSize = sizeof(CSnapshot);
+			unsigned DeltashotCrc = 0;
 			{
-				int DeltashotSize = m_aClients[i].m_Snapshots.Get(m_aClients[i].m_LastAckedSnapshot, nullptr, &pDeltashot, nullptr);
-				if(DeltashotSize >= 0)
+				const CSnapshotStorage::CHolder *pAcked = m_aClients[i].m_Snapshots.Find(m_aClients[i].m_LastAckedSnapshot);
+				if(pAcked)
+				{
 					DeltaTick = m_aClients[i].m_LastAckedSnapshot;
+					pDeltashot = pAcked->m_pSnap;
+					DeltashotSize = pAcked->m_SnapSize;
+					DeltashotCrc = pAcked->m_Crc;
+				}
 				else
 				{
 					// no acked package found, force client to recover rate
@@ -954,60 +1064,43 @@ void CServer::DoSnapshot()
 				}
 			}
 
-			// create delta
-			m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_SOUNDWORLD, m_aClients[i].m_Sixup);
-			m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_DAMAGE, m_aClients[i].m_Sixup);
-			char aDeltaData[CSnapshot::MAX_SIZE];
-			int DeltaSize = m_SnapshotDelta.CreateDelta(pDeltashot, pData, aDeltaData);
-
-			if(DeltaSize)
-			{
-				// compress it
-				const int MaxSize = MAX_SNAPSHOT_PACKSIZE;
-
-				char aCompData[CSnapshot::MAX_SIZE];
-				SnapshotSize = CVariableInt::Compress(aDeltaData, DeltaSize, aCompData, sizeof(aCompData));
-				int NumPackets = (SnapshotSize + MaxSize - 1) / MaxSize;
+			// the stored copy stays valid until the next snapshot tick
+			CSnapshotWorkers::CTask *pTask = m_SnapshotWorkers.Task(NumTasks);
+			pTask->m_ClientId = i;
+			pTask->m_Crc = pCurrent->m_Crc;
+			pTask->m_DeltaTick = DeltaTick;
+			pTask->m_Sixup = m_aClients[i].m_Sixup;
+			pTask->m_pFrom = pDeltashot;
+			pTask->m_FromSize = DeltashotSize;
+			pTask->m_FromCrc = DeltashotCrc;
+			pTask->m_pTo = pCurrent->m_pSnap;
+			pTask->m_ToSize = SnapshotSize;
+			pTask->m_MeasureDelta = Config()->m_SvSnapshotBandwidth;
+
+			// reuse the delta of clients with the same snapshot and delta base
+			m_SnapshotWorkers.Deduplicate(NumTasks);
+			NumTasks++;
+		}
+	}
 
-				for(int n = 0, Left = SnapshotSize; Left > 0; n++)
-				{
-					int Chunk = Left < MaxSize ? Left : MaxSize;
-					Left -= Chunk;
+	// create deltas, on the worker threads if enabled, the game world is not touched anymore
+	char aDeltaData[CSnapshot::MAX_SIZE];
+	m_SnapshotWorkers.Run(&m_SnapshotDelta, aDeltaData, NumTasks);
 
-					if(NumPackets == 1)
-					{
-						CMsgPacker Msg(NETMSG_SNAPSINGLE, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i);
-					}
-					else
-					{
-						CMsgPacker Msg(NETMSG_SNAP, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(NumPackets);
-						Msg.AddInt(n);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i);
-					}
-				}
-			}
-			else
-			{
-				CMsgPacker Msg(NETMSG_SNAPEMPTY, true);
-				Msg.AddInt(m_CurrentGameTick);
-				Msg.AddInt(m_CurrentGameTick - DeltaTick);
-				SendMsg(&Msg, MSGFLAG_FLUSH, i);
-			}
+	if(Config()->m_SvSnapshotBandwidth)
+	{
+		for(int i = 0; i < NumTasks; i++)
+		{
+			const CSnapshotWorkers::CTask *pTask = m_SnapshotWorkers.Task(i);
+			const CSnapshotWorkers::CTask *pResult = pTask->Result();
+			m_SnapshotBandwidth.AddSnapshot(pTask->m_ClientId, pTask->m_Sixup, pTask->m_pFrom, pTask->m_pTo, pTask->m_ToSize, pResult->m_DeltaSizes, pResult->m_CompSize);
 		}
 	}
 
+	// send in client order
+	for(int i = 0; i < NumTasks; i++)
+		SendSnapshot(m_SnapshotWorkers.Task(i));
+
 	GameServer()->OnPostSnap();
 }
 
@@ -1172,6 +1265,7 @@ int CServer::DelClientCallback(int ClientId, const char *pReason, void *pUser)
 	pThis->m_aClients[ClientId].m_Snapshots.PurgeAll();
 	pThis->m_aClients[ClientId].m_Sixup = false;
 	pThis->m_aClients[ClientId].m_RedirectDropTime = 0;
+	pThis->m_SnapshotBandwidth.ResetClient(ClientId);
 
 	pThis->GameServer()->TeehistorianRecordPlayerDrop(ClientId, pReason);
 	pThis->Antibot()->OnEngineClientDrop(ClientId, pReason);
@@ -2396,7 +2490,8 @@ void CServer::UpdateRegisterServerInfo()
 	JsonWriter.EndArray();
 	JsonWriter.EndObject();
 
-	m_pRegister->OnNewInfo(JsonWriter.GetOutputString().c_str());
+	if(m_pRegister)
+		m_pRegister->OnNewInfo(JsonWriter.GetOutputString().c_str());
 }
 
 void CServer::UpdateServerInfo(bool Resend)
@@ -2434,8 +2529,15 @@ void CServer::UpdateServerInfo(bool Resend)
 	m_ServerInfoNeedsUpdate = false;
 }
 
+void CServer::FlushNetwork()
+{
+	net_udp_set_send_batching(m_NetServer.Socket(), Config()->m_SvNetSendBatching);
+	net_udp_flush(m_NetServer.Socket());
+}
+
 void CServer::PumpNetwork(bool PacketWaiting)
 {
+	CTickProfiler::CScope ProfileScope(&m_TickProfiler, CTickProfiler::PHASE_NETWORK);
 	CNetChunk Packet;
 	SECURITY_TOKEN ResponseToken;
 
@@ -2675,6 +2777,61 @@ void CServer::UpdateDebugDummies(bool ForceDisconnect)
 }
 #endif
 
+void CServer::GameTick()
+{
+	GameServer()->OnPreTickTeehistorian();
+
+#ifdef CONF_DEBUG
+	UpdateDebugDummies(false);
+#endif
+
+	const int64_t InputStart = time_get_nanoseconds().count();
+
+	for(int c = 0; c < MAX_CLIENTS; c++)
+	{
+		if(m_aClients[c].m_State != CClient::STATE_INGAME)
+			continue;
+		bool ClientHadInput = false;
+		for(auto &Input : m_aClients[c].m_aInputs)
+		{
+			if(Input.m_GameTick == Tick() + 1)
+			{
+				GameServer()->OnClientPredictedEarlyInput(c, Input.m_aData);
+				ClientHadInput = true;
+			}
+		}
+		if(!ClientHadInput)
+			GameServer()->OnClientPredictedEarlyInput(c, nullptr);
+	}
+
+	m_CurrentGameTick++;
+
+	// apply new input
+	for(int c = 0; c < MAX_CLIENTS; c++)
+	{
+		if(m_aClients[c].m_State != CClient::STATE_INGAME)
+			continue;
+		bool ClientHadInput = false;
+		for(auto &Input : m_aClients[c].m_aInputs)
+		{
+			if(Input.m_GameTick == Tick())
+			{
+				GameServer()->OnClientPredictedInput(c, Input.m_aData);
+				ClientHadInput = true;
+				break;
+			}
+		}
+		if(!ClientHadInput)
+			GameServer()->OnClientPredictedInput(c, nullptr);
+	}
+	m_TickProfiler.Add(CTickProfiler::PHASE_INPUT, time_get_nanoseconds().count() - InputStart);
+
+	{
+		CTickProfiler::CScope ProfileScope(&m_TickProfiler, CTickProfiler::PHASE_GAME_TICK);
+		GameServer()->OnTick();
+	}
+}
+
 int CServer::Run()
 {
 	if(m_RunServer == UNINITIALIZED)
@@ -2880,54 +3037,11 @@ int CServer::Run()
 				}
 			}
 
+			const int64_t TickWorkStart = time_get_nanoseconds().count();
 			while(t > TickStartTime(m_CurrentGameTick + 1))
 			{
-				GameServer()->OnPreTickTeehistorian();
-
-#ifdef CONF_DEBUG
-				UpdateDebugDummies(false);
-#endif
-
-				for(int c = 0; c < MAX_CLIENTS; c++)
-				{
-					if(m_aClients[c].m_State != CClient::STATE_INGAME)
-						continue;
-					bool ClientHadInput = false;
-					for(auto &Input : m_aClients[c].m_aInputs)
-					{
-						if(Input.m_GameTick == Tick() + 1)
-						{
-							GameServer()->OnClientPredictedEarlyInput(c, Input.m_aData);
-							ClientHadInput = true;
-						}
-					}
-					if(!ClientHadInput)
-						GameServer()->OnClientPredictedEarlyInput(c, nullptr);
-				}
-
-				m_CurrentGameTick++;
+				GameTick();
 				NewTicks++;
-
-				// apply new input
-				for(int c = 0; c < MAX_CLIENTS; c++)
-				{
-					if(m_aClients[c].m_State != CClient::STATE_INGAME)
-						continue;
-					bool ClientHadInput = false;
-					for(auto &Input : m_aClients[c].m_aInputs)
-					{
-						if(Input.m_GameTick == Tick())
-						{
-							GameServer()->OnClientPredictedInput(c, Input.m_aData);
-							ClientHadInput = true;
-							break;
-						}
-					}
-					if(!ClientHadInput)
-						GameServer()->OnClientPredictedInput(c, nullptr);
-				}
-
-				GameServer()->OnTick();
 				if(ErrorShutdown())
 				{
 					break;
@@ -2940,21 +3054,26 @@ int CServer::Run()
 				if(Config()->m_SvHighBandwidth || (m_CurrentGameTick % 2) == 0)
 					DoSnapshot();
 
-				UpdateClientRconCommands();
+				{
+					CTickProfiler::CScope ProfileScope(&m_TickProfiler, CTickProfiler::PHASE_UPDATE);
+
+					UpdateClientRconCommands();
 
-				m_Fifo.Update();
+					m_Fifo.Update();
 
-				// master server stuff
-				m_pRegister->Update();
+					// master server stuff
+					m_pRegister->Update();
 
-				if(m_ServerInfoNeedsUpdate)
-					UpdateServerInfo();
+					if(m_ServerInfoNeedsUpdate)
+						UpdateServerInfo();
 
-				Antibot()->OnEngineTick();
+					Antibot()->OnEngineTick();
+				}
 
 				// handle dnsbl
 				if(Config()->m_SvDnsbl)
 				{
+					CTickProfiler::CScope ProfileScope(&m_TickProfiler, CTickProfiler::PHASE_DNSBL);
 					for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
 					{
 						if(m_aClients[ClientId].m_State == CClient::STATE_EMPTY)
@@ -3009,6 +3128,19 @@ int CServer::Run()
 						}
 					}
 				}
+
+				m_TickProfiler.AddTick(time_get_nanoseconds().count() - TickWorkStart, 1000000000 / TickSpeed(), NewTicks);
+				if(Config()->m_EcTickProfile && time_get() >= m_NextTickProfileEcon)
+				{
+					PrintTickProfile(true);
+					m_NextTickProfileEcon = time_get() + Config()->m_EcTickProfile * time_freq();
+				}
+				if(Config()->m_SvSnapshotBandwidth && Config()->m_SvSnapshotBandwidthDump && time_get() >= m_NextSnapshotBandwidthDump)
+				{
+					if(m_NextSnapshotBandwidthDump)
+						DumpSnapshotBandwidth();
+					m_NextSnapshotBandwidthDump = time_get() + Config()->m_SvSnapshotBandwidthDump * time_freq();
+				}
 			}
 
 			if(!NonActive)
@@ -3038,6 +3170,7 @@ int CServer::Run()
 					m_ReloadedWhenEmpty = true;
 				}
 
+				FlushNetwork();
 				if(Config()->m_SvShutdownWhenEmpty)
 					m_RunServer = STOPPING;
 				else
@@ -3051,6 +3184,7 @@ int CServer::Run()
 				t = time_get();
 				int x = (TickStartTime(m_CurrentGameTick + 1) - t) * 1000000 / time_freq() + 1;
 
+				FlushNetwork();
 				PacketWaiting = x > 0 ? net_socket_read_wait(m_NetServer.Socket(), x) : true;
 			}
 			if(IsInterrupted())
@@ -3079,6 +3213,13 @@ int CServer::Run()
 	m_pRegister->OnShutdown();
 	m_Econ.Shutdown();
 	m_Fifo.Shutdown();
+	if(m_SnapshotWorkers.NumThreads())
+		m_SnapshotWorkers.Shutdown();
+	if(m_SnapshotBandwidthFile)
+	{
+		io_close(m_SnapshotBandwidthFile);
+		m_SnapshotBandwidthFile = nullptr;
+	}
 	Engine()->ShutdownJobs();
 
 	GameServer()->OnShutdown(nullptr);
@@ -3162,6 +3303,194 @@ void CServer::ConStatus(IConsole::IResult *pResult, void *pUser)
 	}
 }
 
+void CServer::ConSnapshotStats(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+
+	int NumBlocks = 0;
+	int64_t NumAllocations = 0;
+	int64_t NumFrees = 0;
+	for(const auto &Client : pThis->m_aClients)
+	{
+		NumBlocks += Client.m_Snapshots.NumBlocks();
+		NumAllocations += Client.m_Snapshots.NumAllocations();
+		NumFrees += Client.m_Snapshots.NumFrees();
+	}
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "storage blocks=%d allocations=%" PRId64 " frees=%" PRId64, NumBlocks, NumAllocations, NumFrees);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", aBuf);
+	str_format(aBuf, sizeof(aBuf), "delta cache hits=%" PRId64 " misses=%" PRId64, pThis->m_SnapshotWorkers.NumCacheHits(), pThis->m_SnapshotWorkers.NumCacheMisses());
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", aBuf);
+}
+
+void CServer::ConSnapshotBandwidth(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	const CSnapshotBandwidth &Bandwidth = pThis->m_SnapshotBandwidth;
+	if(!pThis->Config()->m_SvSnapshotBandwidth)
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", "sv_snapshot_bandwidth is disabled, the statistics aren't updated");
+
+	const int ClientId = pResult->NumArguments() ? pResult->GetInteger(0) : -1;
+	if(ClientId < -1 || ClientId >= MAX_CLIENTS)
+	{
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", "invalid client id");
+		return;
+	}
+
+	// types with the most compressed bytes first
+	std::vector<std::pair<const CSnapshotBandwidth::CCounter *, int>> vTypes;
+	int64_t TotalCompBytes = 0;
+	for(int Slot = 0; Slot < Bandwidth.NumTypes(); Slot++)
+	{
+		const CSnapshotBandwidth::CCounter *pCounter = ClientId < 0 ? &Bandwidth.TypeTotal(Slot) : Bandwidth.ClientType(ClientId, Slot);
+		if(!pCounter)
+			continue;
+		vTypes.emplace_back(pCounter, Slot);
+		TotalCompBytes += pCounter->m_CompBytes;
+	}
+	std::stable_sort(vTypes.begin(), vTypes.end(), [](const auto &A, const auto &B) { return A.first->m_CompBytes > B.first->m_CompBytes; });
+
+	char aBuf[256];
+	char aName[64];
+	for(const auto &[pCounter, Slot] : vTypes)
+	{
+		CSnapshotBandwidth::TypeName(Bandwidth.TypeSixup(Slot), Bandwidth.Type(Slot), aName, sizeof(aName));
+		str_format(aBuf, sizeof(aBuf), "%s (%s): items=%" PRId64 " snap=%" PRId64 "B updates=%" PRId64 " delta=%" PRId64 "B comp=%" PRId64 "B (%.1f%%)",
+			aName, Bandwidth.TypeSixup(Slot) ? "0.7" : "0.6", pCounter->m_NumItems, pCounter->m_SnapBytes, pCounter->m_NumUpdates,
+			pCounter->m_DeltaBytes, pCounter->m_CompBytes, TotalCompBytes ? pCounter->m_CompBytes * 100.0f / TotalCompBytes : 0.0f);
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", aBuf);
+	}
+
+	// the client totals include the snapshot and delta headers
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		const CSnapshotBandwidth::CClientTotal &Total = Bandwidth.ClientTotal(i);
+		if((ClientId >= 0 && i != ClientId) || !Total.m_NumSnapshots)
+			continue;
+		str_format(aBuf, sizeof(aBuf), "id=%d name='%s' snapshots=%" PRId64 " empty=%" PRId64 " snap=%" PRId64 "B delta=%" PRId64 "B comp=%" PRId64 "B comp_per_snapshot=%.1fB",
+			i, pThis->ClientName(i), Total.m_NumSnapshots, Total.m_NumEmpty, Total.m_Counter.m_SnapBytes, Total.m_Counter.m_DeltaBytes,
+			Total.m_Counter.m_CompBytes, Total.m_Counter.m_CompBytes / (float)Total.m_NumSnapshots);
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "snapshot", aBuf);
+	}
+}
+
+void CServer::ConSnapshotBandwidthReset(IConsole::IResult *pResult, void *pUser)
+{
+	static_cast<CServer *>(pUser)->m_SnapshotBandwidth.Reset();
+}
+
+void CServer::DumpSnapshotBandwidth()
+{
+	char aTimestamp[64];
+	str_timestamp(aTimestamp, sizeof(aTimestamp));
+	const bool Header = !m_SnapshotBandwidthFile;
+	if(!m_SnapshotBandwidthFile)
+	{
+		char aFilename[IO_MAX_PATH_LENGTH];
+		str_format(aFilename, sizeof(aFilename), "dumps/snapshot_bandwidth_%s.csv", aTimestamp);
+		m_SnapshotBandwidthFile = Storage()->OpenFile(aFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
+		if(!m_SnapshotBandwidthFile)
+		{
+			log_error("snapshot", "failed to open '%s' for writing, disabling the bandwidth dump", aFilename);
+			Config()->m_SvSnapshotBandwidthDump = 0;
+			return;
+		}
+		log_info("snapshot", "writing the snapshot bandwidth to '%s'", aFilename);
+	}
+	m_SnapshotBandwidth.WriteCsv(m_SnapshotBandwidthFile, aTimestamp, Header);
+	io_flush(m_SnapshotBandwidthFile);
+}
+
+void CServer::ConNetStats(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+
+	NETSTATS Current;
+	net_stats(&Current);
+	const NETSTATS &Last = pThis->m_LastNetStats;
+	const uint64_t Packets = Current.sent_packets - Last.sent_packets;
+	const uint64_t Syscalls = Current.sent_syscalls - Last.sent_syscalls;
+	const int Ticks = maximum(pThis->m_CurrentGameTick - pThis->m_LastNetStatsTick, 1);
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "since last call: ticks=%d sent packets=%" PRIu64 " send syscalls=%" PRIu64, Ticks, Packets, Syscalls);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "net", aBuf);
+	str_format(aBuf, sizeof(aBuf), "per tick: packets=%.2f syscalls=%.2f saved=%.2f", Packets / (double)Ticks, Syscalls / (double)Ticks, (Packets - minimum(Syscalls, Packets)) / (double)Ticks);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "net", aBuf);
+
+	pThis->m_LastNetStats = Current;
+	pThis->m_LastNetStatsTick = pThis->m_CurrentGameTick;
+}
+
+void CServer::PrintTickProfile(bool ToEcon)
+{
+	char aBuf[256];
+	for(int Phase = 0; Phase < CTickProfiler::NUM_PHASES; Phase++)
+	{
+		const CTickProfiler::CStats Stats = m_TickProfiler.Stats(Phase);
+		str_format(aBuf, sizeof(aBuf), "%s: p50=%.1fus p99=%.1fus max=%.1fus samples=%d",
+			CTickProfiler::PhaseName(Phase), Stats.m_P50 / 1000.0f, Stats.m_P99 / 1000.0f, Stats.m_Max / 1000.0f, Stats.m_NumSamples);
+		if(ToEcon)
+			m_Econ.Send(-1, aBuf);
+		else
+			Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "tick_profile", aBuf);
+	}
+	str_format(aBuf, sizeof(aBuf), "ticks=%" PRId64 " overruns=%" PRId64 " late_ticks=%" PRId64,
+		m_TickProfiler.NumTicks(), m_TickProfiler.NumOverruns(), m_TickProfiler.NumLateTicks());
+	if(ToEcon)
+		m_Econ.Send(-1, aBuf);
+	else
+		Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "tick_profile", aBuf);
+}
+
+void CServer::ConTickProfile(IConsole::IResult *pResult, void *pUser)
+{
+	static_cast<CServer *>(pUser)->PrintTickProfile(false);
+}
+
+void CServer::ConTickProfileHistogram(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+
+	int FirstPhase = 0;
+	int LastPhase = CTickProfiler::NUM_PHASES - 1;
+	if(pResult->NumArguments())
+	{
+		FirstPhase = LastPhase = CTickProfiler::FindPhase(pResult->GetString(0));
+		if(FirstPhase < 0)
+		{
+			pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "tick_profile", "unknown phase");
+			return;
+		}
+	}
+
+	// one line per phase, the counts of the power of two microsecond buckets
+	for(int Phase = FirstPhase; Phase <= LastPhase; Phase++)
+	{
+		int aBuckets[CTickProfiler::NUM_BUCKETS];
+		pThis->m_TickProfiler.Histogram(Phase, aBuckets);
+
+		char aBuf[512];
+		str_format(aBuf, sizeof(aBuf), "%s:", CTickProfiler::PhaseName(Phase));
+		for(int i = 0; i < CTickProfiler::NUM_BUCKETS; i++)
+		{
+			char aBucket[32];
+			if(i == CTickProfiler::NUM_BUCKETS - 1)
+				str_format(aBucket, sizeof(aBucket), " >=%dus=%d", 1 << i, aBuckets[i]);
+			else
+				str_format(aBucket, sizeof(aBucket), " <%dus=%d", 1 << (i + 1), aBuckets[i]);
+			str_append(aBuf, aBucket);
+		}
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "tick_profile", aBuf);
+	}
+}
+
+void CServer::ConTickProfileReset(IConsole::IResult *pResult, void *pUser)
+{
+	static_cast<CServer *>(pUser)->m_TickProfiler.Reset();
+}
+
 static int GetAuthLevel(const char *pLevel)
 {
 	int Level = -1;
@@ -3865,6 +4194,13 @@ void CServer::RegisterCommands()
 	Console()->Register("shutdown", "?r[reason]", CFGFLAG_SERVER, ConShutdown, this, "Shut down");
 	Console()->Register("logout", "", CFGFLAG_SERVER, ConLogout, this, "Logout of rcon");
 	Console()->Register("show_ips", "?i[show]", CFGFLAG_SERVER, ConShowIps, this, "Show IP addresses in rcon commands (1 = on, 0 = off)");
+	Console()->Register("snapshot_stats", "", CFGFLAG_SERVER, ConSnapshotStats, this, "Show snapshot memory and delta cache statistics");
+	Console()->Register("snapshot_bandwidth", "?i[client_id]", CFGFLAG_SERVER, ConSnapshotBandwidth, this, "Show the snapshot bytes per item type of all or one client and the totals of the clients (see sv_snapshot_bandwidth)");
+	Console()->Register("snapshot_bandwidth_reset", "", CFGFLAG_SERVER, ConSnapshotBandwidthReset, this, "Reset the snapshot bandwidth statistics");
+	Console()->Register("net_stats", "", CFGFLAG_SERVER, ConNetStats, this, "Show sent packets and send syscalls since the last call");
+	Console()->Register("tick_profile", "", CFGFLAG_SERVER, ConTickProfile, this, "Show the durations of the main loop phases over the last ticks and the tick overrun counters");
+	Console()->Register("tick_profile_histogram", "?s[phase]", CFGFLAG_SERVER, ConTickProfileHistogram, this, "Show histograms of the durations of the main loop phases over the last ticks");
+	Console()->Register("tick_profile_reset", "", CFGFLAG_SERVER, ConTickProfileReset, this, "Reset the tick profile");
 
 	Console()->Register("record", "?s[file]", CFGFLAG_SERVER | CFGFLAG_STORE, ConRecord, this, "Record to a file");
 	Console()->Register("stoprecord", "", CFGFLAG_SERVER, ConStopRecord, this, "Stop recording");
@@ -27,6 +27,8 @@
 #include "authmanager.h"
 #include "name_ban.h"
 #include "snap_id_pool.h"
+#include "snapshot_workers.h"
+#include "tick_profiler.h"
 
 #if defined(CONF_UPNP)
 #include "upnp.h"
@@ -64,6 +66,7 @@ public:
 class CServer : public IServer
 {
 	friend class CServerLogger;
+	friend class CTeeHistorianReplay;
 
 	class IGameServer *m_pGameServer;
 	class CConfig *m_pConfig;
@@ -197,8 +200,16 @@ public:
 
 	CSnapshotDelta m_SnapshotDelta;
 	CSnapshotBuilder m_SnapshotBuilder;
+	CSnapshotWorkers m_SnapshotWorkers;
 	CSnapIdPool m_IdPool;
 	CNetServer m_NetServer;
+	NETSTATS m_LastNetStats;
+	int m_LastNetStatsTick;
+	CTickProfiler m_TickProfiler;
+	int64_t m_NextTickProfileEcon;
+	CSnapshotBandwidth m_SnapshotBandwidth;
+	IOHANDLE m_SnapshotBandwidthFile;
+	int64_t m_NextSnapshotBandwidthDump;
 	CEcon m_Econ;
 	CFifo m_Fifo;
 	CServerBan m_ServerBan;
@@ -312,6 +323,11 @@ public:
 	int GetClientVersion(int ClientId) const override;
 	int SendMsg(CMsgPacker *pMsg, int Flags, int ClientId) override;
 
+	void SendSnapshot(const CSnapshotWorkers::CTask *pTask);
+#ifdef CONF_DEBUG
+	// returns whether the snapshot is the same when it's built without snap culling
+	bool CheckSnapCulling(int ClientId, const CSnapshot *pSnapshot, int SnapshotSize);
+#endif
 	void DoSnapshot();
 
 	static int NewClientCallback(int ClientId, void *pUser, bool Sixup);
@@ -376,6 +392,7 @@ public:
 	void UpdateRegisterServerInfo();
 	void UpdateServerInfo(bool Resend = false);
 
+	void FlushNetwork();
 	void PumpNetwork(bool PacketWaiting);
 
 	void ChangeMap(const char *pMap) override;
@@ -389,6 +406,8 @@ public:
 	bool IsRecording(int ClientId) override;
 	void StopDemos() override;
 
+	// runs a single game tick with the buffered inputs of the clients
+	void GameTick();
 	int Run();
 
 	static void ConKick(IConsole::IResult *pResult, void *pUser);
@@ -399,6 +418,15 @@ public:
 	static void ConMapReload(IConsole::IResult *pResult, void *pUser);
 	static void ConLogout(IConsole::IResult *pResult, void *pUser);
 	static void ConShowIps(IConsole::IResult *pResult, void *pUser);
+	static void ConSnapshotStats(IConsole::IResult *pResult, void *pUser);
+	static void ConSnapshotBandwidth(IConsole::IResult *pResult, void *pUser);
+	static void ConSnapshotBandwidthReset(IConsole::IResult *pResult, void *pUser);
+	void DumpSnapshotBandwidth();
+	static void ConNetStats(IConsole::IResult *pResult, void *pUser);
+	void PrintTickProfile(bool ToEcon);
+	static void ConTickProfile(IConsole::IResult *pResult, void *pUser);
+	static void ConTickProfileHistogram(IConsole::IResult *pResult, void *pUser);
+	static void ConTickProfileReset(IConsole::IResult *pResult, void *pUser);
 
 	static void ConAuthAdd(IConsole::IResult *pResult, void *pUser);
 	static void ConAuthAddHashed(IConsole::IResult *pResult, void *pUser);
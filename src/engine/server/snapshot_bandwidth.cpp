@@ -0,0 +1,294 @@
+#include "snapshot_bandwidth.h"
+
+#include <engine/shared/compression.h>
+#include <engine/shared/csv.h>
+#include <engine/shared/snapshot.h>
+#include <engine/shared/uuid_manager.h>
+
+#include <game/generated/protocol.h>
+#include <game/generated/protocol7.h>
+
+#include <iterator>
+
+static int PackedSize(const int *pData, int NumInts)
+{
+	int Size = 0;
+	unsigned char aBuf[CVariableInt::MAX_BYTES_PACKED];
+	for(int i = 0; i < NumInts; i++)
+		Size += CVariableInt::Pack(aBuf, pData[i], sizeof(aBuf)) - aBuf;
+	return Size;
+}
+
+void CSnapshotBandwidth::CCounter::Add(const CCounter &Other)
+{
+	m_NumItems += Other.m_NumItems;
+	m_SnapBytes += Other.m_SnapBytes;
+	m_NumUpdates += Other.m_NumUpdates;
+	m_DeltaBytes += Other.m_DeltaBytes;
+	m_CompBytes += Other.m_CompBytes;
+}
+
+void CSnapshotBandwidth::CDeltaSizes::Clear()
+{
+	m_HeaderDeltaBytes = 0;
+	m_HeaderCompBytes = 0;
+	m_vEntries.clear();
+}
+
+void CSnapshotBandwidth::CDeltaSizes::Add(int InternalType, bool Deleted, const int *pData, int NumInts)
+{
+	// items of the same type are usually next to each other
+	CEntry *pEntry = nullptr;
+	for(auto It = m_vEntries.rbegin(); It != m_vEntries.rend(); ++It)
+	{
+		if(It->m_InternalType == InternalType && It->m_Deleted == Deleted)
+		{
+			pEntry = &*It;
+			break;
+		}
+	}
+	if(!pEntry)
+	{
+		m_vEntries.push_back({InternalType, Deleted, 0, 0, 0});
+		pEntry = &m_vEntries.back();
+	}
+	pEntry->m_NumUpdates++;
+	pEntry->m_DeltaBytes += NumInts * sizeof(int32_t);
+	pEntry->m_CompBytes += PackedSize(pData, NumInts);
+}
+
+void CSnapshotBandwidth::MeasureDelta(const CSnapshotDelta &Delta, const CSnapshot *pTo, const void *pDeltaData, int DeltaSize, CDeltaSizes *pSizes)
+{
+	pSizes->Clear();
+	if(!DeltaSize)
+		return;
+
+	const CSnapshotDelta::CData *pDelta = (const CSnapshotDelta::CData *)pDeltaData;
+	const int *pData = pDelta->m_aData;
+	const int *pEnd = (const int *)((const char *)pDeltaData + DeltaSize);
+	pSizes->m_HeaderDeltaBytes = (const char *)pData - (const char *)pDeltaData;
+	pSizes->m_HeaderCompBytes = PackedSize((const int *)pDeltaData, pData - (const int *)pDeltaData);
+
+	for(int i = 0; i < pDelta->m_NumDeletedItems; i++, pData++)
+		pSizes->Add(*pData >> 16, true, pData, 1);
+
+	// only needed for the sizes of items that aren't part of the delta
+	CSnapshotItemIndex ItemIndex;
+	bool IndexBuilt = false;
+	for(int i = 0; i < pDelta->m_NumUpdateItems && pData < pEnd; i++)
+	{
+		const int Type = pData[0];
+		int NumInts;
+		if(Delta.IncludesSize(Type))
+		{
+			NumInts = 3 + pData[2];
+		}
+		else
+		{
+			if(!IndexBuilt)
+			{
+				ItemIndex.Build(pTo);
+				IndexBuilt = true;
+			}
+			const int Index = ItemIndex.Find((Type << 16) | pData[1]);
+			dbg_assert(Index >= 0, "delta item not in snapshot");
+			NumInts = 2 + pTo->GetItemSize(Index) / sizeof(int32_t);
+		}
+		pSizes->Add(Type, false, pData, NumInts);
+		pData += NumInts;
+	}
+}
+
+CSnapshotBandwidth::CSnapshotBandwidth()
+{
+	Reset();
+}
+
+void CSnapshotBandwidth::Reset()
+{
+	m_vTypes.clear();
+	for(int Sixup = 0; Sixup < 2; Sixup++)
+	{
+		m_avBaseSlots[Sixup].assign(CSnapshot::OFFSET_UUID_TYPE, -1);
+		m_aUuidSlots[Sixup].clear();
+	}
+	for(int i = 0; i < MAX_CLIENTS; i++)
+		ResetClient(i);
+}
+
+void CSnapshotBandwidth::ResetClient(int ClientId)
+{
+	m_avClientTypes[ClientId].clear();
+	mem_zero(&m_aClientTotals[ClientId], sizeof(m_aClientTotals[ClientId]));
+}
+
+int CSnapshotBandwidth::Slot(bool Sixup, int Type)
+{
+	int *pSlot;
+	if(Type < CSnapshot::OFFSET_UUID_TYPE)
+	{
+		pSlot = &m_avBaseSlots[Sixup][Type];
+	}
+	else
+	{
+		auto Result = m_aUuidSlots[Sixup].emplace(Type, -1);
+		pSlot = &Result.first->second;
+	}
+	if(*pSlot < 0)
+	{
+		*pSlot = m_vTypes.size();
+		m_vTypes.push_back({Sixup, Type, {}});
+	}
+	return *pSlot;
+}
+
+int CSnapshotBandwidth::ItemSlot(bool Sixup, const CSnapshot *pSnap, int InternalType, CTypeCache *pCache)
+{
+	if(InternalType < CSnapshot::OFFSET_UUID_TYPE)
+		return Slot(Sixup, InternalType);
+
+	for(int i = 0; i < pCache->m_NumEntries; i++)
+	{
+		if(pCache->m_aInternalTypes[i] == InternalType)
+			return pCache->m_aSlots[i];
+	}
+	// keep the internal type if the registration of the type is missing
+	const int ExternalType = pSnap->GetExternalItemType(InternalType);
+	const int Result = Slot(Sixup, ExternalType >= 0 ? ExternalType : InternalType);
+	if(pCache->m_NumEntries < CTypeCache::MAX_ENTRIES)
+	{
+		pCache->m_aInternalTypes[pCache->m_NumEntries] = InternalType;
+		pCache->m_aSlots[pCache->m_NumEntries] = Result;
+		pCache->m_NumEntries++;
+	}
+	return Result;
+}
+
+CSnapshotBandwidth::CCounter *CSnapshotBandwidth::ClientCounter(int ClientId, int Slot)
+{
+	std::vector<CCounter> &vCounters = m_avClientTypes[ClientId];
+	if((int)vCounters.size() <= Slot)
+		vCounters.resize(m_vTypes.size(), CCounter{});
+	return &vCounters[Slot];
+}
+
+const CSnapshotBandwidth::CCounter *CSnapshotBandwidth::ClientType(int ClientId, int Slot) const
+{
+	const std::vector<CCounter> &vCounters = m_avClientTypes[ClientId];
+	if(Slot >= (int)vCounters.size() || (!vCounters[Slot].m_NumItems && !vCounters[Slot].m_NumUpdates))
+		return nullptr;
+	return &vCounters[Slot];
+}
+
+void CSnapshotBandwidth::AddSnapshot(int ClientId, bool Sixup, const CSnapshot *pFrom, const CSnapshot *pTo, int ToSize, const CDeltaSizes &Sizes, int CompSize)
+{
+	CClientTotal &Total = m_aClientTotals[ClientId];
+	Total.m_NumSnapshots++;
+	if(!CompSize)
+		Total.m_NumEmpty++;
+
+	CTypeCache ToCache;
+	ToCache.m_NumEntries = 0;
+	for(int i = 0; i < pTo->NumItems(); i++)
+	{
+		const int Slot = ItemSlot(Sixup, pTo, pTo->GetItem(i)->Type(), &ToCache);
+		const int Bytes = sizeof(CSnapshotItem) + pTo->GetItemSize(i);
+		CCounter *pClient = ClientCounter(ClientId, Slot);
+		CCounter &Type = m_vTypes[Slot].m_Total;
+		pClient->m_NumItems++;
+		pClient->m_SnapBytes += Bytes;
+		Type.m_NumItems++;
+		Type.m_SnapBytes += Bytes;
+	}
+	Total.m_Counter.m_NumItems += pTo->NumItems();
+	Total.m_Counter.m_SnapBytes += ToSize;
+
+	CTypeCache FromCache;
+	FromCache.m_NumEntries = 0;
+	Total.m_Counter.m_DeltaBytes += Sizes.m_HeaderDeltaBytes;
+	for(const auto &Entry : Sizes.m_vEntries)
+	{
+		const int Slot = Entry.m_Deleted ? ItemSlot(Sixup, pFrom, Entry.m_InternalType, &FromCache) : ItemSlot(Sixup, pTo, Entry.m_InternalType, &ToCache);
+		CCounter Counter = {0, 0, Entry.m_NumUpdates, Entry.m_DeltaBytes, Entry.m_CompBytes};
+		ClientCounter(ClientId, Slot)->Add(Counter);
+		m_vTypes[Slot].m_Total.Add(Counter);
+		Total.m_Counter.m_NumUpdates += Entry.m_NumUpdates;
+		Total.m_Counter.m_DeltaBytes += Entry.m_DeltaBytes;
+	}
+	Total.m_Counter.m_CompBytes += CompSize;
+}
+
+void CSnapshotBandwidth::TypeName(bool Sixup, int Type, char *pBuf, int BufSize)
+{
+	static const CNetObjHandler s_NetObjHandler;
+	static const protocol7::CNetObjHandler s_NetObjHandler7;
+
+	// extended types are the same in both protocols
+	const char *pName;
+	if(Type >= OFFSET_UUID)
+		pName = s_NetObjHandler.GetObjName(Type);
+	else if(Sixup)
+		pName = s_NetObjHandler7.GetObjName(Type);
+	else
+		pName = s_NetObjHandler.GetObjName(Type);
+
+	if(str_comp(pName, "(out of range)") != 0)
+		str_copy(pBuf, pName, BufSize);
+	else if(Type >= OFFSET_UUID)
+		str_copy(pBuf, g_UuidManager.GetName(Type), BufSize);
+	else
+		str_format(pBuf, BufSize, "type %d", Type);
+}
+
+void CSnapshotBandwidth::WriteCsv(IOHANDLE File, const char *pTimestamp, bool Header) const
+{
+	if(Header)
+	{
+		const char *apHeader[] = {"timestamp", "client_id", "protocol", "type", "name", "snapshots", "items", "snap_bytes", "updates", "delta_bytes", "comp_bytes"};
+		CsvWrite(File, std::size(apHeader), apHeader);
+	}
+
+	char aaColumns[11][64];
+	const char *apColumns[11];
+	for(int i = 0; i < (int)std::size(apColumns); i++)
+		apColumns[i] = aaColumns[i];
+	auto WriteRow = [&](int ClientId, const char *pProtocol, int Type, const char *pName, int64_t NumSnapshots, const CCounter &Counter) {
+		str_copy(aaColumns[0], pTimestamp);
+		str_format(aaColumns[1], sizeof(aaColumns[1]), "%d", ClientId);
+		str_copy(aaColumns[2], pProtocol);
+		str_format(aaColumns[3], sizeof(aaColumns[3]), "%d", Type);
+		str_copy(aaColumns[4], pName);
+		str_format(aaColumns[5], sizeof(aaColumns[5]), "%" PRId64, NumSnapshots);
+		str_format(aaColumns[6], sizeof(aaColumns[6]), "%" PRId64, Counter.m_NumItems);
+		str_format(aaColumns[7], sizeof(aaColumns[7]), "%" PRId64, Counter.m_SnapBytes);
+		str_format(aaColumns[8], sizeof(aaColumns[8]), "%" PRId64, Counter.m_NumUpdates);
+		str_format(aaColumns[9], sizeof(aaColumns[9]), "%" PRId64, Counter.m_DeltaBytes);
+		str_format(aaColumns[10], sizeof(aaColumns[10]), "%" PRId64, Counter.m_CompBytes);
+		CsvWrite(File, std::size(apColumns), apColumns);
+	};
+
+	// totals of the types over all clients, client id -1
+	char aName[64];
+	for(int Slot = 0; Slot < NumTypes(); Slot++)
+	{
+		TypeName(TypeSixup(Slot), Type(Slot), aName, sizeof(aName));
+		WriteRow(-1, TypeSixup(Slot) ? "0.7" : "0.6", Type(Slot), aName, 0, TypeTotal(Slot));
+	}
+
+	// totals of the clients including the delta headers, type -1
+	for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+	{
+		const CClientTotal &Total = ClientTotal(ClientId);
+		if(!Total.m_NumSnapshots)
+			continue;
+		WriteRow(ClientId, "", -1, "total", Total.m_NumSnapshots, Total.m_Counter);
+		for(int Slot = 0; Slot < NumTypes(); Slot++)
+		{
+			const CCounter *pCounter = ClientType(ClientId, Slot);
+			if(!pCounter)
+				continue;
+			TypeName(TypeSixup(Slot), Type(Slot), aName, sizeof(aName));
+			WriteRow(ClientId, TypeSixup(Slot) ? "0.7" : "0.6", Type(Slot), aName, 0, *pCounter);
+		}
+	}
+}
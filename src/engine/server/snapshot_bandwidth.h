@@ -0,0 +1,163 @@
+#ifndef ENGINE_SERVER_SNAPSHOT_BANDWIDTH_H
+#define ENGINE_SERVER_SNAPSHOT_BANDWIDTH_H
+
+#include <base/system.h>
+
+#include <engine/shared/protocol.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class CSnapshot;
+class CSnapshotDelta;
+
+/**
+ * Attributes the snapshot bandwidth to item types and clients.
+ *
+ * For every item type, the items and bytes in the snapshots are counted,
+ * as well as the bytes of the items in the deltas before and after
+ * compression. The delta compression packs every integer on its own, so
+ * the compressed bytes of an item are exact, not estimated. The header of
+ * a delta is only part of the client totals.
+ *
+ * Types of the 0.6 and the 0.7 protocol are counted separately, extended
+ * item types are counted by their UUID type.
+ */
+class CSnapshotBandwidth
+{
+public:
+	class CCounter
+	{
+	public:
+		// items in the snapshots and their bytes, including the item keys
+		int64_t m_NumItems;
+		int64_t m_SnapBytes;
+		// items added, changed or removed by the deltas
+		int64_t m_NumUpdates;
+		int64_t m_DeltaBytes;
+		int64_t m_CompBytes;
+
+		void Add(const CCounter &Other);
+	};
+
+	/**
+	 * Sizes of the items of one delta by type, measured on the snapshot
+	 * worker threads and added on the main thread.
+	 */
+	class CDeltaSizes
+	{
+	public:
+		class CEntry
+		{
+		public:
+			int m_InternalType;
+			// removed items, their types refer to the delta base
+			bool m_Deleted;
+			int m_NumUpdates;
+			int m_DeltaBytes;
+			int m_CompBytes;
+		};
+
+		int m_HeaderDeltaBytes;
+		int m_HeaderCompBytes;
+		std::vector<CEntry> m_vEntries;
+
+		void Clear();
+		void Add(int InternalType, bool Deleted, const int *pData, int NumInts);
+	};
+
+	class CClientTotal
+	{
+	public:
+		int64_t m_NumSnapshots;
+		// snapshots that didn't change anything for the client
+		int64_t m_NumEmpty;
+		CCounter m_Counter;
+	};
+
+	/**
+	 * Measures a delta created by `CSnapshotDelta::CreateDelta`.
+	 *
+	 * @param Delta The delta that created the data.
+	 * @param pTo The snapshot the delta was created for.
+	 * @param pDeltaData The delta data.
+	 * @param DeltaSize Size of the delta data, `0` for empty deltas.
+	 * @param pSizes Receives the sizes.
+	 */
+	static void MeasureDelta(const CSnapshotDelta &Delta, const CSnapshot *pTo, const void *pDeltaData, int DeltaSize, CDeltaSizes *pSizes);
+
+private:
+	class CType
+	{
+	public:
+		bool m_Sixup;
+		int m_Type;
+		CCounter m_Total;
+	};
+
+	// maps internal extended item types of one snapshot to slots
+	class CTypeCache
+	{
+	public:
+		enum
+		{
+			MAX_ENTRIES = 32,
+		};
+		int m_aInternalTypes[MAX_ENTRIES];
+		int m_aSlots[MAX_ENTRIES];
+		int m_NumEntries;
+	};
+
+	std::vector<CType> m_vTypes;
+	// slots of the types below `CSnapshot::OFFSET_UUID_TYPE` per protocol
+	std::vector<int> m_avBaseSlots[2];
+	std::map<int, int> m_aUuidSlots[2];
+	std::vector<CCounter> m_avClientTypes[MAX_CLIENTS];
+	CClientTotal m_aClientTotals[MAX_CLIENTS];
+
+	int Slot(bool Sixup, int Type);
+	int ItemSlot(bool Sixup, const CSnapshot *pSnap, int InternalType, CTypeCache *pCache);
+	CCounter *ClientCounter(int ClientId, int Slot);
+
+public:
+	CSnapshotBandwidth();
+
+	void Reset();
+	void ResetClient(int ClientId);
+
+	/**
+	 * Adds a snapshot sent to a client and the delta it was sent as.
+	 *
+	 * @param ClientId The client.
+	 * @param Sixup Whether the client uses the 0.7 protocol.
+	 * @param pFrom The delta base.
+	 * @param pTo The snapshot.
+	 * @param ToSize Size of the snapshot.
+	 * @param Sizes The sizes of the delta, measured by `MeasureDelta`.
+	 * @param CompSize Size of the compressed delta, `0` if it's empty.
+	 */
+	void AddSnapshot(int ClientId, bool Sixup, const CSnapshot *pFrom, const CSnapshot *pTo, int ToSize, const CDeltaSizes &Sizes, int CompSize);
+
+	int NumTypes() const { return m_vTypes.size(); }
+	bool TypeSixup(int Slot) const { return m_vTypes[Slot].m_Sixup; }
+	int Type(int Slot) const { return m_vTypes[Slot].m_Type; }
+	const CCounter &TypeTotal(int Slot) const { return m_vTypes[Slot].m_Total; }
+	// `nullptr` if the client didn't receive items of the type
+	const CCounter *ClientType(int ClientId, int Slot) const;
+	const CClientTotal &ClientTotal(int ClientId) const { return m_aClientTotals[ClientId]; }
+
+	static void TypeName(bool Sixup, int Type, char *pBuf, int BufSize);
+
+	/**
+	 * Writes the counters as CSV, one row for the totals of every type and
+	 * client and one row per client and type.
+	 *
+	 * @param File The file.
+	 * @param pTimestamp Written into the first column of every row.
+	 * @param Header Whether to write the column names first.
+	 */
+	void WriteCsv(IOHANDLE File, const char *pTimestamp, bool Header) const;
+};
+
+#endif
@@ -0,0 +1,146 @@
+#include "snapshot_workers.h"
+
+#include <engine/shared/compression.h>
+
+#include <game/generated/protocol7.h>
+
+CSnapshotWorkers::CSnapshotWorkers() :
+	m_Shutdown(true),
+	m_NextTask(0),
+	m_NumTasks(0),
+	m_NumCacheHits(0),
+	m_NumCacheMisses(0)
+{
+}
+
+CSnapshotWorkers::~CSnapshotWorkers()
+{
+	if(!m_Shutdown)
+	{
+		Shutdown();
+	}
+}
+
+void CSnapshotWorkers::Process(CSnapshotDelta *pDelta, char *pDeltaData, CTask *pTask)
+{
+	pDelta->SetStaticsize(protocol7::NETEVENTTYPE_SOUNDWORLD, pTask->m_Sixup);
+	pDelta->SetStaticsize(protocol7::NETEVENTTYPE_DAMAGE, pTask->m_Sixup);
+	const int DeltaSize = pDelta->CreateDelta(pTask->m_pFrom, pTask->m_pTo, pDeltaData);
+	if(DeltaSize)
+		pTask->m_CompSize = CVariableInt::Compress(pDeltaData, DeltaSize, pTask->m_aCompData, sizeof(pTask->m_aCompData));
+	else
+		pTask->m_CompSize = 0;
+	if(pTask->m_MeasureDelta)
+		CSnapshotBandwidth::MeasureDelta(*pDelta, pTask->m_pTo, pDeltaData, DeltaSize, &pTask->m_DeltaSizes);
+}
+
+void CSnapshotWorkers::WorkerThread(void *pUser)
+{
+	CWorker *pWorker = static_cast<CWorker *>(pUser);
+	CSnapshotWorkers *pPool = pWorker->m_pPool;
+	while(true)
+	{
+		sphore_wait(&pWorker->m_Start);
+		if(pPool->m_Shutdown)
+			break;
+		pPool->RunTasks(&pWorker->m_Delta, pWorker->m_aDeltaData);
+		sphore_signal(&pPool->m_Done);
+	}
+}
+
+void CSnapshotWorkers::RunTasks(CSnapshotDelta *pDelta, char *pDeltaData)
+{
+	while(true)
+	{
+		const int Index = m_NextTask.fetch_add(1);
+		if(Index >= m_NumTasks)
+			break;
+		if(!m_vpTasks[Index]->m_pSource)
+			Process(pDelta, pDeltaData, m_vpTasks[Index].get());
+	}
+}
+
+void CSnapshotWorkers::Init(int NumThreads, const CSnapshotDelta &Delta)
+{
+	dbg_assert(m_Shutdown, "Snapshot workers already running");
+	m_Shutdown = false;
+
+	sphore_init(&m_Done);
+
+	char aName[16]; // unix kernel length limit
+	m_vpWorkers.reserve(NumThreads);
+	for(int i = 0; i < NumThreads; i++)
+	{
+		m_vpWorkers.push_back(std::make_unique<CWorker>(this, Delta));
+		CWorker *pWorker = m_vpWorkers.back().get();
+		sphore_init(&pWorker->m_Start);
+		str_format(aName, sizeof(aName), "snap worker %d", i);
+		pWorker->m_pThread = thread_init(WorkerThread, pWorker, aName);
+	}
+}
+
+void CSnapshotWorkers::Shutdown()
+{
+	dbg_assert(!m_Shutdown, "Snapshot workers already shut down");
+	m_Shutdown = true;
+
+	for(auto &pWorker : m_vpWorkers)
+		sphore_signal(&pWorker->m_Start);
+	for(auto &pWorker : m_vpWorkers)
+	{
+		thread_wait(pWorker->m_pThread);
+		sphore_destroy(&pWorker->m_Start);
+	}
+	m_vpWorkers.clear();
+
+	sphore_destroy(&m_Done);
+}
+
+CSnapshotWorkers::CTask *CSnapshotWorkers::Task(int Index)
+{
+	while((int)m_vpTasks.size() <= Index)
+		m_vpTasks.push_back(std::make_unique<CTask>());
+	return m_vpTasks[Index].get();
+}
+
+bool CSnapshotWorkers::Deduplicate(int Index)
+{
+	if(Index == 0)
+		m_vpUniqueTasks.clear();
+
+	CTask *pTask = m_vpTasks[Index].get();
+	pTask->m_pSource = nullptr;
+	for(const CTask *pOther : m_vpUniqueTasks)
+	{
+		// cheap checks first, the snapshot contents must match exactly though
+		if(pOther->m_Crc == pTask->m_Crc && pOther->m_ToSize == pTask->m_ToSize &&
+			pOther->m_FromCrc == pTask->m_FromCrc && pOther->m_FromSize == pTask->m_FromSize &&
+			pOther->m_Sixup == pTask->m_Sixup &&
+			mem_comp(pOther->m_pTo, pTask->m_pTo, pTask->m_ToSize) == 0 &&
+			mem_comp(pOther->m_pFrom, pTask->m_pFrom, pTask->m_FromSize) == 0)
+		{
+			pTask->m_pSource = pOther;
+			m_NumCacheHits++;
+			return true;
+		}
+	}
+	m_vpUniqueTasks.push_back(pTask);
+	m_NumCacheMisses++;
+	return false;
+}
+
+void CSnapshotWorkers::Run(CSnapshotDelta *pDelta, char *pDeltaData, int NumTasks)
+{
+	dbg_assert(NumTasks <= (int)m_vpTasks.size(), "Too many snapshot tasks");
+	m_NumTasks = NumTasks;
+	m_NextTask = 0;
+
+	for(auto &pWorker : m_vpWorkers)
+		sphore_signal(&pWorker->m_Start);
+
+	// help out instead of idling
+	RunTasks(pDelta, pDeltaData);
+
+	for(size_t i = 0; i < m_vpWorkers.size(); i++)
+		sphore_wait(&m_Done);
+}
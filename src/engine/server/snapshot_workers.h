@@ -0,0 +1,134 @@
+#ifndef ENGINE_SERVER_SNAPSHOT_WORKERS_H
+#define ENGINE_SERVER_SNAPSHOT_WORKERS_H
+
+#include "snapshot_bandwidth.h"
+
+#include <base/system.h>
+
+#include <engine/shared/snapshot.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * Creates and compresses the snapshot deltas of all clients of one tick,
+ * optionally spread over a number of worker threads.
+ *
+ * The snapshots themselves are built beforehand on the main thread, as the
+ * game world must not be touched by the workers. Only the delta creation and
+ * compression, which solely read the finished snapshots, run in parallel.
+ *
+ * Clients that get the same snapshot and acked the same snapshot content,
+ * e.g. spectators following the same player, share a single delta.
+ */
+class CSnapshotWorkers
+{
+public:
+	class CTask
+	{
+	public:
+		int m_ClientId;
+		int m_Crc;
+		int m_DeltaTick;
+		bool m_Sixup;
+		const CSnapshot *m_pFrom;
+		int m_FromSize;
+		unsigned m_FromCrc;
+		const CSnapshot *m_pTo;
+		int m_ToSize;
+		// whether to measure the delta for the bandwidth statistics
+		bool m_MeasureDelta;
+
+		// task with the same delta, whose result is used instead
+		const CTask *m_pSource;
+
+		// result: size of the compressed delta, 0 if the delta is empty
+		int m_CompSize;
+		char m_aCompData[CSnapshot::MAX_SIZE];
+		CSnapshotBandwidth::CDeltaSizes m_DeltaSizes;
+
+		const CTask *Result() const { return m_pSource ? m_pSource : this; }
+	};
+
+	/**
+	 * Creates and compresses the delta of a single task.
+	 *
+	 * @param pDelta The delta to use, must not be shared with other threads.
+	 * @param pDeltaData Scratch buffer of at least `CSnapshot::MAX_SIZE` bytes.
+	 * @param pTask The task to process.
+	 */
+	static void Process(CSnapshotDelta *pDelta, char *pDeltaData, CTask *pTask);
+
+private:
+	class CWorker
+	{
+	public:
+		CSnapshotWorkers *m_pPool;
+		void *m_pThread;
+		SEMAPHORE m_Start;
+		CSnapshotDelta m_Delta;
+		char m_aDeltaData[CSnapshot::MAX_SIZE];
+
+		CWorker(CSnapshotWorkers *pPool, const CSnapshotDelta &Delta) :
+			m_pPool(pPool), m_pThread(nullptr), m_Delta(Delta) {}
+	};
+
+	std::vector<std::unique_ptr<CWorker>> m_vpWorkers;
+	std::vector<std::unique_ptr<CTask>> m_vpTasks;
+	std::vector<CTask *> m_vpUniqueTasks;
+	SEMAPHORE m_Done;
+	std::atomic<bool> m_Shutdown;
+	std::atomic<int> m_NextTask;
+	int m_NumTasks;
+
+	int64_t m_NumCacheHits;
+	int64_t m_NumCacheMisses;
+
+	static void WorkerThread(void *pUser);
+	void RunTasks(CSnapshotDelta *pDelta, char *pDeltaData);
+
+public:
+	CSnapshotWorkers();
+	~CSnapshotWorkers();
+
+	/**
+	 * Starts the worker threads.
+	 *
+	 * @param NumThreads Number of worker threads, the calling thread helps out as well.
+	 * @param Delta Delta with the static item sizes set, copied for every worker.
+	 */
+	void Init(int NumThreads, const CSnapshotDelta &Delta);
+	void Shutdown();
+	int NumThreads() const { return m_vpWorkers.size(); }
+
+	/**
+	 * Returns the task with the given index, creating it if needed.
+	 */
+	CTask *Task(int Index);
+
+	/**
+	 * Marks the task as sharing the delta of an earlier task with the same
+	 * snapshot, delta base and protocol, if there is one.
+	 *
+	 * @param Index Index of the task, all earlier tasks must be filled in.
+	 *
+	 * @return `true` if an earlier task with the same delta was found.
+	 */
+	bool Deduplicate(int Index);
+
+	int64_t NumCacheHits() const { return m_NumCacheHits; }
+	int64_t NumCacheMisses() const { return m_NumCacheMisses; }
+
+	/**
+	 * Processes the first `NumTasks` tasks and blocks until all of them are done.
+	 * Runs on the calling thread only if no worker threads were started.
+	 *
+	 * @param pDelta The delta used by the calling thread.
+	 * @param pDeltaData Scratch buffer of the calling thread.
+	 * @param NumTasks Number of tasks to process.
+	 */
+	void Run(CSnapshotDelta *pDelta, char *pDeltaData, int NumTasks);
+};
+
+#endif
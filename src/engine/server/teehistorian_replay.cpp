@@ -0,0 +1,602 @@
+#include "teehistorian_replay.h"
+
+#include "databases/connection_pool.h"
+#include "server.h"
+
+#include <base/hash.h>
+#include <base/log.h>
+#include <base/system.h>
+
+#include <engine/console.h>
+#include <engine/engine.h>
+#include <engine/external/json-parser/json.h>
+#include <engine/shared/config.h>
+#include <engine/shared/json.h>
+#include <engine/shared/protocol_ex.h>
+#include <engine/shared/snapshot.h>
+#include <engine/shared/teehistorian_ex.h>
+#include <engine/shared/uuid_manager.h>
+#include <engine/storage.h>
+
+#include <algorithm>
+#include <iterator>
+
+extern bool IsInterrupted();
+
+// frees the persistent data allocated for the replay when `Run` returns,
+// `CServer`'s destructor only sees null pointers afterwards
+class CPersistentDataGuard
+{
+	CServer *m_pServer;
+
+public:
+	CPersistentDataGuard(CServer *pServer) :
+		m_pServer(pServer)
+	{
+		const int Size = m_pServer->GameServer()->PersistentClientDataSize();
+		for(auto &Client : m_pServer->m_aClients)
+		{
+			Client.m_HasPersistentData = false;
+			Client.m_pPersistentData = malloc(Size);
+		}
+		m_pServer->m_pPersistentData = malloc(m_pServer->GameServer()->PersistentDataSize());
+	}
+
+	~CPersistentDataGuard()
+	{
+		for(auto &Client : m_pServer->m_aClients)
+		{
+			free(Client.m_pPersistentData);
+			Client.m_pPersistentData = nullptr;
+		}
+		free(m_pServer->m_pPersistentData);
+		m_pServer->m_pPersistentData = nullptr;
+	}
+};
+
+// config variables that would make the replay touch files of the recorded server
+static const char *const s_apSkippedConfig[] = {
+	"logfile",
+	"sv_input_fifo",
+	"sv_sqlite_file",
+};
+
+// quotes only the arguments that need it, the console ignores quoted
+// victims, e.g. the `v[id]` of `set_team_ddr`
+static void AppendArgument(char *pLine, int LineSize, const char *pArgument)
+{
+	bool Plain = pArgument[0] != '\0';
+	for(const char *p = pArgument; *p && Plain; p++)
+		Plain = !str_isspace(*p) && *p != '"' && *p != '\\' && *p != ';' && *p != '#';
+	if(Plain)
+	{
+		str_append(pLine, " ", LineSize);
+		str_append(pLine, pArgument, LineSize);
+		return;
+	}
+
+	str_append(pLine, " \"", LineSize);
+	char *pDst = pLine + str_length(pLine);
+	// leave space for the closing quote
+	str_escape(&pDst, pArgument, pLine + LineSize - 1);
+	str_append(pLine, "\"", LineSize);
+}
+
+CTeeHistorianReplay::CTeeHistorianReplay(CServer *pServer) :
+	m_pServer(pServer),
+	m_RecordedDirectInputs(false),
+	m_CheckPending(false),
+	m_NumChecked(0),
+	m_NumMismatches(0),
+	m_NumSnapshotsChecked(0),
+	m_NumSnapshotMismatches(0),
+	m_TickDuration(0)
+{
+	m_aFilename[0] = '\0';
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		m_aSixup[i] = false;
+		m_aEnterPending[i] = false;
+		m_aInputTick[i] = -1;
+		mem_zero(&m_aDirectInputs[i], sizeof(m_aDirectInputs[i]));
+		m_aExpectedAlive[i] = false;
+		m_aExpectedX[i] = 0;
+		m_aExpectedY[i] = 0;
+		m_aReportedMismatch[i] = false;
+	}
+	sha256_init(&m_PositionHash);
+}
+
+bool CTeeHistorianReplay::Load(IStorage *pStorage, const char *pFilename)
+{
+	str_copy(m_aFilename, pFilename);
+	if(!m_Reader.Open(pStorage, pFilename, IStorage::TYPE_ALL_OR_ABSOLUTE))
+	{
+		log_error("replay", "failed to load teehistorian file '%s': %s", pFilename, m_Reader.Error());
+		return false;
+	}
+	m_RecordedDirectInputs = str_toint(m_Reader.HeaderString("version_minor")) >= 9;
+	log_info("replay", "loaded teehistorian file '%s', game_uuid=%s map=%s server_version='%s'",
+		pFilename, m_Reader.HeaderString("game_uuid"), m_Reader.HeaderString("map_name"), m_Reader.HeaderString("server_version"));
+	return true;
+}
+
+void CTeeHistorianReplay::ApplyConfig(IConsole *pConsole)
+{
+	char aLine[IConsole::CMDLINE_LENGTH];
+	const json_value *pConfig = json_object_get(m_Reader.Header(), "config");
+	if(pConfig->type == json_object)
+	{
+		for(unsigned i = 0; i < pConfig->u.object.length; i++)
+		{
+			const char *pName = pConfig->u.object.values[i].name;
+			const json_value *pValue = pConfig->u.object.values[i].value;
+			if(pValue->type != json_string)
+				continue;
+			bool Skip = false;
+			for(const char *pSkipped : s_apSkippedConfig)
+				Skip |= str_comp(pName, pSkipped) == 0;
+			if(Skip)
+				continue;
+			str_copy(aLine, pName);
+			AppendArgument(aLine, sizeof(aLine), json_string_get(pValue));
+			pConsole->ExecuteLine(aLine);
+		}
+	}
+
+	// don't record the replay, use the map and the random numbers of the
+	// recording
+	pConsole->ExecuteLine("sv_tee_historian 0");
+	str_copy(aLine, "sv_prng_seed");
+	AppendArgument(aLine, sizeof(aLine), m_Reader.HeaderString("prng_description"));
+	pConsole->ExecuteLine(aLine);
+	str_copy(aLine, "sv_map");
+	AppendArgument(aLine, sizeof(aLine), m_Reader.HeaderString("map_name"));
+	pConsole->ExecuteLine(aLine);
+}
+
+void CTeeHistorianReplay::ConnectClient(int ClientId)
+{
+	// `NETMSG_READY` isn't recorded, it's sent before the first game message
+	CServer::CClient &Client = m_pServer->m_aClients[ClientId];
+	if(Client.m_State != CServer::CClient::STATE_CONNECTING)
+		return;
+	Client.m_State = CServer::CClient::STATE_READY;
+	m_pServer->GameServer()->OnClientConnected(ClientId, nullptr);
+}
+
+void CTeeHistorianReplay::EnterPendingClients()
+{
+	for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+	{
+		if(!m_aEnterPending[ClientId])
+			continue;
+		m_aEnterPending[ClientId] = false;
+		ConnectClient(ClientId);
+		CServer::CClient &Client = m_pServer->m_aClients[ClientId];
+		if(Client.m_State != CServer::CClient::STATE_READY)
+			continue;
+		Client.m_State = CServer::CClient::STATE_INGAME;
+		m_pServer->GameServer()->OnClientEnter(ClientId);
+	}
+}
+
+void CTeeHistorianReplay::AdvanceTo(int Tick)
+{
+	while(m_pServer->Tick() < Tick && !m_pServer->ErrorShutdown())
+	{
+		EnterPendingClients();
+		CheckPositions();
+
+		const int64_t Start = time_get_nanoseconds().count();
+		m_pServer->GameTick();
+		const int64_t Duration = time_get_nanoseconds().count() - Start;
+		m_TickDuration += Duration;
+		m_vTickDurations.push_back(Duration);
+		m_CheckPending = true;
+
+#ifdef CONF_DEBUG
+		// like `CServer::Run`, not counted as tick duration
+		if(m_pServer->Config()->m_DbgSnapCulling && (m_pServer->Config()->m_SvHighBandwidth || m_pServer->Tick() % 2 == 0))
+			CheckSnapshots();
+#endif
+	}
+}
+
+#ifdef CONF_DEBUG
+void CTeeHistorianReplay::CheckSnapshots()
+{
+	CServer *pServer = m_pServer;
+	pServer->GameServer()->OnPreSnap();
+	for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+	{
+		if(pServer->m_aClients[ClientId].m_State != CServer::CClient::STATE_INGAME)
+			continue;
+		pServer->m_SnapshotBuilder.Init(pServer->m_aClients[ClientId].m_Sixup);
+		pServer->GameServer()->OnSnap(ClientId);
+		char aData[CSnapshot::MAX_SIZE];
+		CSnapshot *pSnapshot = (CSnapshot *)aData;
+		const int SnapshotSize = pServer->m_SnapshotBuilder.Finish(pSnapshot);
+		m_NumSnapshotsChecked++;
+		if(!pServer->CheckSnapCulling(ClientId, pSnapshot, SnapshotSize))
+			m_NumSnapshotMismatches++;
+	}
+	pServer->GameServer()->OnPostSnap();
+}
+#endif
+
+void CTeeHistorianReplay::CheckPositions()
+{
+	if(!m_CheckPending)
+		return;
+	m_CheckPending = false;
+
+	const int Tick = m_pServer->Tick();
+	for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+	{
+		int X = 0;
+		int Y = 0;
+		const bool Alive = m_pServer->GameServer()->CharacterPos(ClientId, &X, &Y);
+		if(Alive)
+		{
+			const int32_t aData[] = {Tick, ClientId, X, Y};
+			sha256_update(&m_PositionHash, aData, sizeof(aData));
+		}
+		if(!Alive && !m_aExpectedAlive[ClientId])
+			continue;
+
+		m_NumChecked++;
+		if(Alive == m_aExpectedAlive[ClientId] && (!Alive || (X == m_aExpectedX[ClientId] && Y == m_aExpectedY[ClientId])))
+			continue;
+
+		m_NumMismatches++;
+		if(m_aReportedMismatch[ClientId])
+			continue;
+		m_aReportedMismatch[ClientId] = true;
+		if(Alive && m_aExpectedAlive[ClientId])
+			log_warn("replay", "first mismatch of cid=%d at tick=%d: position (%d, %d), recorded (%d, %d)", ClientId, Tick, X, Y, m_aExpectedX[ClientId], m_aExpectedY[ClientId]);
+		else
+			log_warn("replay", "first mismatch of cid=%d at tick=%d: character %s, recorded %s", ClientId, Tick, Alive ? "alive" : "dead", Alive ? "dead" : "alive");
+	}
+}
+
+void CTeeHistorianReplay::OnJoin(int ClientId)
+{
+	if(m_pServer->m_aClients[ClientId].m_State != CServer::CClient::STATE_EMPTY)
+		CServer::DelClientCallback(ClientId, "replaced by a new client", m_pServer);
+
+	CServer::NewClientCallback(ClientId, m_pServer, m_aSixup[ClientId]);
+	m_pServer->m_aClients[ClientId].m_State = CServer::CClient::STATE_CONNECTING;
+	m_aSixup[ClientId] = false;
+}
+
+void CTeeHistorianReplay::OnDrop(int ClientId, const char *pReason)
+{
+	m_aEnterPending[ClientId] = false;
+	// the game might have kicked the client already
+	if(m_pServer->m_aClients[ClientId].m_State != CServer::CClient::STATE_EMPTY)
+		CServer::DelClientCallback(ClientId, pReason, m_pServer);
+}
+
+void CTeeHistorianReplay::OnInput(int ClientId, const CNetObj_PlayerInput *pInput)
+{
+	// the recorded input is the one applied in the next tick, queue it like
+	// `NETMSG_INPUT` does
+	CServer::CClient &Client = m_pServer->m_aClients[ClientId];
+	// the first queued input of the tick is applied, keep them in order
+	// by starting at the first slot for every tick
+	if(m_aInputTick[ClientId] != m_pServer->Tick())
+	{
+		m_aInputTick[ClientId] = m_pServer->Tick();
+		Client.m_CurrentInput = 0;
+	}
+	CServer::CClient::CInput *pClientInput = &Client.m_aInputs[Client.m_CurrentInput];
+	pClientInput->m_GameTick = m_pServer->Tick() + 1;
+	mem_zero(pClientInput->m_aData, sizeof(pClientInput->m_aData));
+	mem_copy(pClientInput->m_aData, pInput, sizeof(*pInput));
+	Client.m_CurrentInput = (Client.m_CurrentInput + 1) % std::size(Client.m_aInputs);
+
+	if(!m_RecordedDirectInputs)
+		OnDirectInput(ClientId, pInput);
+}
+
+void CTeeHistorianReplay::OnDirectInput(int ClientId, const CNetObj_PlayerInput *pInput)
+{
+	CServer::CClient &Client = m_pServer->m_aClients[ClientId];
+	mem_zero(Client.m_LatestInput.m_aData, sizeof(Client.m_LatestInput.m_aData));
+	mem_copy(Client.m_LatestInput.m_aData, pInput, sizeof(*pInput));
+	if(Client.m_State == CServer::CClient::STATE_INGAME)
+		m_pServer->GameServer()->OnClientDirectInput(ClientId, Client.m_LatestInput.m_aData);
+}
+
+void CTeeHistorianReplay::OnMessage(int ClientId, const unsigned char *pData, int DataSize)
+{
+	if(m_pServer->m_aClients[ClientId].m_State == CServer::CClient::STATE_EMPTY)
+		return;
+	ConnectClient(ClientId);
+
+	CUnpacker Unpacker;
+	Unpacker.Reset(pData, DataSize);
+	CMsgPacker Packer(NETMSG_EX, true);
+	int Msg;
+	bool Sys;
+	CUuid Uuid;
+	// only game messages are recorded, they're the same for both protocols
+	if(UnpackMessageId(&Msg, &Sys, &Uuid, &Unpacker, &Packer) == UNPACKMESSAGE_ERROR || Sys)
+		return;
+	if(m_pServer->m_aClients[ClientId].m_State >= CServer::CClient::STATE_READY)
+		m_pServer->GameServer()->OnMessage(Msg, &Unpacker, ClientId);
+}
+
+void CTeeHistorianReplay::OnConsoleCommand(const CTeeHistorianReader::CChunk *pChunk)
+{
+	char aLine[IConsole::CMDLINE_LENGTH];
+	str_copy(aLine, pChunk->m_pString);
+	for(int i = 0; i < pChunk->m_NumArgs; i++)
+		AppendArgument(aLine, sizeof(aLine), pChunk->m_ppArgs[i]);
+	m_pServer->Console()->ExecuteLineFlag(aLine, pChunk->m_FlagMask, pChunk->m_ClientId, false);
+}
+
+void CTeeHistorianReplay::OnEx(const CTeeHistorianReader::CChunk *pChunk)
+{
+	const int Type = g_UuidManager.LookupUuid(pChunk->m_Uuid);
+	if(Type != TEEHISTORIAN_JOINVER6 && Type != TEEHISTORIAN_JOINVER7 &&
+		Type != TEEHISTORIAN_PLAYER_READY && Type != TEEHISTORIAN_PLAYER_REJOIN &&
+		Type != TEEHISTORIAN_DDNETVER && Type != TEEHISTORIAN_DDNETVER_OLD &&
+		Type != TEEHISTORIAN_AUTH_INIT && Type != TEEHISTORIAN_AUTH_LOGIN && Type != TEEHISTORIAN_AUTH_LOGOUT &&
+		Type != TEEHISTORIAN_PLAYER_DIRECT_INPUT)
+	{
+		// the rest records results of the game (finishes, teams, saves)
+		return;
+	}
+
+	CUnpacker Unpacker;
+	Unpacker.Reset(pChunk->m_pData, pChunk->m_DataSize);
+	const int ClientId = Unpacker.GetInt();
+	if(Unpacker.Error() || ClientId < 0 || ClientId >= MAX_CLIENTS)
+		return;
+	CServer::CClient &Client = m_pServer->m_aClients[ClientId];
+
+	switch(Type)
+	{
+	case TEEHISTORIAN_JOINVER6:
+	case TEEHISTORIAN_JOINVER7:
+		m_aSixup[ClientId] = Type == TEEHISTORIAN_JOINVER7;
+		break;
+	case TEEHISTORIAN_PLAYER_READY:
+		if(Client.m_State != CServer::CClient::STATE_EMPTY)
+			m_aEnterPending[ClientId] = true;
+		break;
+	case TEEHISTORIAN_PLAYER_REJOIN:
+		if(Client.m_State != CServer::CClient::STATE_EMPTY)
+			CServer::ClientRejoinCallback(ClientId, m_pServer);
+		break;
+	case TEEHISTORIAN_DDNETVER:
+	{
+		const CUuid *pConnectionId = (const CUuid *)Unpacker.GetRaw(sizeof(CUuid));
+		const int DDNetVersion = Unpacker.GetInt();
+		const char *pDDNetVersionStr = Unpacker.GetString(CUnpacker::SANITIZE_CC);
+		if(Unpacker.Error())
+			break;
+		Client.m_ConnectionId = *pConnectionId;
+		Client.m_DDNetVersion = DDNetVersion;
+		str_copy(Client.m_aDDNetVersionStr, pDDNetVersionStr);
+		Client.m_DDNetVersionSettled = true;
+		Client.m_GotDDNetVersionPacket = true;
+		break;
+	}
+	case TEEHISTORIAN_DDNETVER_OLD:
+	{
+		const int DDNetVersion = Unpacker.GetInt();
+		if(Unpacker.Error())
+			break;
+		Client.m_DDNetVersion = DDNetVersion;
+		Client.m_DDNetVersionSettled = true;
+		break;
+	}
+	case TEEHISTORIAN_AUTH_INIT:
+	case TEEHISTORIAN_AUTH_LOGIN:
+	{
+		const int Level = Unpacker.GetInt();
+		if(Unpacker.Error())
+			break;
+		Client.m_Authed = Level;
+		m_pServer->GameServer()->OnSetAuthed(ClientId, Level);
+		break;
+	}
+	case TEEHISTORIAN_AUTH_LOGOUT:
+		Client.m_Authed = AUTHED_NO;
+		m_pServer->GameServer()->OnSetAuthed(ClientId, AUTHED_NO);
+		break;
+	case TEEHISTORIAN_PLAYER_DIRECT_INPUT:
+	{
+		const bool New = Unpacker.GetInt() != 0;
+		int aData[sizeof(CNetObj_PlayerInput) / sizeof(int32_t)];
+		for(int &Data : aData)
+			Data = Unpacker.GetInt();
+		if(Unpacker.Error())
+			break;
+		if(New)
+		{
+			mem_copy(&m_aDirectInputs[ClientId], aData, sizeof(aData));
+		}
+		else
+		{
+			int DataRate = 0;
+			CSnapshotDelta::UndiffItem((const int *)&m_aDirectInputs[ClientId], aData, (int *)&m_aDirectInputs[ClientId], std::size(aData), &DataRate);
+		}
+		OnDirectInput(ClientId, &m_aDirectInputs[ClientId]);
+		break;
+	}
+	}
+}
+
+int CTeeHistorianReplay::Run()
+{
+	CServer *pServer = m_pServer;
+	pServer->m_RunServer = CServer::RUNNING;
+	pServer->m_AuthManager.Init();
+	CPersistentDataGuard PersistentData(pServer);
+
+	if(!pServer->LoadMap(pServer->Config()->m_SvMap))
+	{
+		log_error("replay", "failed to load map. mapname='%s'", pServer->Config()->m_SvMap);
+		return -1;
+	}
+	char aMapSha256[SHA256_MAXSTRSIZE];
+	sha256_str(pServer->m_aCurrentMapSha256[CServer::MAP_TYPE_SIX], aMapSha256, sizeof(aMapSha256));
+	if(str_comp(aMapSha256, m_Reader.HeaderString("map_sha256")) != 0)
+		log_warn("replay", "the map differs from the recorded one, sha256=%s recorded=%s", aMapSha256, m_Reader.HeaderString("map_sha256"));
+
+	// nothing is received, but the client slots are used for sending
+	NETADDR BindAddr = NETADDR_ZEROED;
+	BindAddr.type = NETTYPE_IPV4;
+	BindAddr.ip[0] = 127;
+	BindAddr.ip[3] = 1;
+	if(!pServer->m_NetServer.Open(BindAddr, &pServer->m_ServerBan, pServer->Config()->m_SvMaxClients, pServer->Config()->m_SvMaxClientsPerIp))
+	{
+		log_error("replay", "couldn't open socket");
+		return -1;
+	}
+	pServer->m_NetServer.SetCallbacks(CServer::NewClientCallback, CServer::NewClientNoAuthCallback, CServer::ClientRejoinCallback, CServer::DelClientCallback, pServer);
+	pServer->m_pEngine = pServer->Kernel()->RequestInterface<IEngine>();
+
+	pServer->Antibot()->Init();
+	pServer->GameServer()->OnInit(nullptr);
+	pServer->GameServer()->EnableEntityTickStats();
+	pServer->Console()->StoreCommands(false);
+
+	const json_value *pTuning = json_object_get(m_Reader.Header(), "tuning");
+	if(pTuning->type == json_object)
+	{
+		for(unsigned i = 0; i < pTuning->u.object.length; i++)
+		{
+			const json_value *pValue = pTuning->u.object.values[i].value;
+			if(pValue->type != json_string)
+				continue;
+			// stored multiplied by 100, round so that the console's
+			// conversion back truncates to the same value
+			const int Value = str_toint(json_string_get(pValue));
+			char aLine[IConsole::CMDLINE_LENGTH];
+			str_format(aLine, sizeof(aLine), "tune %s %.4f", pTuning->u.object.values[i].name, (Value + (Value < 0 ? -0.5 : 0.5)) / 100.0);
+			pServer->Console()->ExecuteLine(aLine);
+		}
+	}
+
+	pServer->m_GameStartTime = time_get();
+
+	bool Finished = false;
+	CTeeHistorianReader::CChunk Chunk;
+	while(!pServer->ErrorShutdown() && !IsInterrupted() && m_Reader.NextChunk(&Chunk))
+	{
+		if(Chunk.m_Type == CTeeHistorianReader::CHUNK_FINISH)
+		{
+			Finished = true;
+			break;
+		}
+		if(Chunk.m_Type == CTeeHistorianReader::CHUNK_TICK_SKIP)
+			continue;
+
+		if(Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_NEW ||
+			Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_DIFF ||
+			Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_OLD)
+		{
+			// recorded at the end of the tick, compared before anything
+			// else happens
+			AdvanceTo(Chunk.m_Tick);
+			m_aExpectedAlive[Chunk.m_ClientId] = Chunk.m_Type != CTeeHistorianReader::CHUNK_PLAYER_OLD;
+			m_aExpectedX[Chunk.m_ClientId] = Chunk.m_X;
+			m_aExpectedY[Chunk.m_ClientId] = Chunk.m_Y;
+			continue;
+		}
+
+		const bool VersionChunk = Chunk.m_Type == CTeeHistorianReader::CHUNK_EX &&
+					  (g_UuidManager.LookupUuid(Chunk.m_Uuid) == TEEHISTORIAN_DDNETVER || g_UuidManager.LookupUuid(Chunk.m_Uuid) == TEEHISTORIAN_DDNETVER_OLD);
+		if(!VersionChunk)
+			EnterPendingClients();
+		AdvanceTo(Chunk.m_Tick);
+		CheckPositions();
+
+		switch(Chunk.m_Type)
+		{
+		case CTeeHistorianReader::CHUNK_INPUT_NEW:
+		case CTeeHistorianReader::CHUNK_INPUT_DIFF:
+			OnInput(Chunk.m_ClientId, &Chunk.m_Input);
+			break;
+		case CTeeHistorianReader::CHUNK_MESSAGE:
+			OnMessage(Chunk.m_ClientId, Chunk.m_pData, Chunk.m_DataSize);
+			break;
+		case CTeeHistorianReader::CHUNK_JOIN:
+			OnJoin(Chunk.m_ClientId);
+			break;
+		case CTeeHistorianReader::CHUNK_DROP:
+			OnDrop(Chunk.m_ClientId, Chunk.m_pString);
+			break;
+		case CTeeHistorianReader::CHUNK_CONSOLE_COMMAND:
+			OnConsoleCommand(&Chunk);
+			break;
+		case CTeeHistorianReader::CHUNK_EX:
+			OnEx(&Chunk);
+			break;
+		}
+	}
+	EnterPendingClients();
+	CheckPositions();
+
+	PrintReport(Finished);
+
+	for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+	{
+		if(pServer->m_aClients[ClientId].m_State != CServer::CClient::STATE_EMPTY)
+			pServer->m_NetServer.Drop(ClientId, "Replay finished");
+	}
+	pServer->Engine()->ShutdownJobs();
+	pServer->GameServer()->OnShutdown(nullptr);
+	pServer->m_pMap->Unload();
+	pServer->DbPool()->OnShutdown();
+	pServer->m_NetServer.Close();
+
+	if(m_Reader.Error()[0])
+		return -1;
+	return m_NumMismatches > 0 || m_NumSnapshotMismatches > 0 ? 1 : 0;
+}
+
+void CTeeHistorianReplay::PrintReport(bool Finished)
+{
+	if(m_Reader.Error()[0])
+		log_error("replay", "failed to read '%s': %s", m_aFilename, m_Reader.Error());
+	else if(!Finished)
+		log_warn("replay", "'%s' ends without the finish chunk, the recording server didn't shut down cleanly", m_aFilename);
+
+	const int64_t NumTicks = m_vTickDurations.size();
+	const double Seconds = m_TickDuration / 1e9;
+	log_info("replay", "ticks=%" PRId64 " time=%.3fs ticks_per_second=%.0f realtime_factor=%.1f",
+		NumTicks, Seconds, Seconds > 0.0 ? NumTicks / Seconds : 0.0, Seconds > 0.0 ? NumTicks / Seconds / SERVER_TICK_SPEED : 0.0);
+
+	// over all ticks, the server's profiler only keeps the last ones
+	if(NumTicks)
+	{
+		std::vector<int64_t> vSorted = m_vTickDurations;
+		std::sort(vSorted.begin(), vSorted.end());
+		log_info("replay", "game_tick: p50=%.1fus p99=%.1fus max=%.1fus",
+			vSorted[(NumTicks - 1) * 50 / 100] / 1000.0, vSorted[(NumTicks - 1) * 99 / 100] / 1000.0, vSorted.back() / 1000.0);
+	}
+
+	IGameServer::CEntityTickStats aStats[16];
+	const int NumStats = m_pServer->GameServer()->EntityTickStats(aStats, std::size(aStats));
+	for(int i = 0; i < NumStats; i++)
+	{
+		log_info("replay", "%s: %.2fus/tick entity_ticks=%" PRId64 " %.0fns/entity_tick",
+			aStats[i].m_pName,
+			NumTicks ? aStats[i].m_Duration / 1000.0 / NumTicks : 0.0,
+			aStats[i].m_NumTicked,
+			aStats[i].m_NumTicked ? (double)aStats[i].m_Duration / aStats[i].m_NumTicked : 0.0);
+	}
+
+	SHA256_CTX PositionHash = m_PositionHash;
+	char aPositionHash[SHA256_MAXSTRSIZE];
+	sha256_str(sha256_finish(&PositionHash), aPositionHash, sizeof(aPositionHash));
+	log_info("replay", "positions=%" PRId64 " mismatches=%" PRId64 " sha256=%s", m_NumChecked, m_NumMismatches, aPositionHash);
+	if(m_NumSnapshotsChecked)
+		log_info("replay", "snap_culling: snapshots=%" PRId64 " mismatches=%" PRId64, m_NumSnapshotsChecked, m_NumSnapshotMismatches);
+}
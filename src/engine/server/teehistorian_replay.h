@@ -0,0 +1,108 @@
+#ifndef ENGINE_SERVER_TEEHISTORIAN_REPLAY_H
+#define ENGINE_SERVER_TEEHISTORIAN_REPLAY_H
+
+#include <base/hash_ctxt.h>
+#include <engine/shared/protocol.h>
+#include <engine/shared/teehistorian_reader.h>
+
+#include <vector>
+
+class CServer;
+class IConsole;
+class IStorage;
+
+/**
+ * Replays a teehistorian file on the server without network and without
+ * waiting for the tick times, `DDNet-Server --replay <file>`.
+ *
+ * The recorded joins, drops, game messages, console commands and inputs
+ * are fed to the game server like they arrived over the network and the
+ * game ticks as fast as possible. The character positions after every
+ * tick are compared to the recorded ones, which makes the replay a
+ * regression test for the physics, and the time spent in the game ticks
+ * is reported as a benchmark.
+ *
+ * The direct inputs, given to the game as soon as they're received, are
+ * replayed where they were recorded. Recordings from before they were
+ * recorded (`version_minor` below 9) use the tick inputs in their place
+ * once before the tick they're applied in.
+ *
+ * Snapshots aren't built unless `dbg_snap_culling 1` is set in a debug
+ * build, then the snapshots of all clients are built after the ticks the
+ * server would send them and compared to the ones built without snap
+ * culling.
+ */
+class CTeeHistorianReplay
+{
+	CServer *m_pServer;
+	CTeeHistorianReader m_Reader;
+	char m_aFilename[IO_MAX_PATH_LENGTH];
+
+	bool m_aSixup[MAX_CLIENTS];
+	// `CGameContext::OnClientEnter` records the version of the client after
+	// the ready chunk, enter the game once it's read
+	bool m_aEnterPending[MAX_CLIENTS];
+
+	// the tick the last input was queued in
+	int m_aInputTick[MAX_CLIENTS];
+	// whether the recording has the direct inputs
+	bool m_RecordedDirectInputs;
+	CNetObj_PlayerInput m_aDirectInputs[MAX_CLIENTS];
+
+	bool m_aExpectedAlive[MAX_CLIENTS];
+	int m_aExpectedX[MAX_CLIENTS];
+	int m_aExpectedY[MAX_CLIENTS];
+	bool m_aReportedMismatch[MAX_CLIENTS];
+	// the positions of the last tick haven't been compared yet
+	bool m_CheckPending;
+	int64_t m_NumChecked;
+	int64_t m_NumMismatches;
+	SHA256_CTX m_PositionHash;
+
+	// with `dbg_snap_culling 1` in debug builds
+	int64_t m_NumSnapshotsChecked;
+	int64_t m_NumSnapshotMismatches;
+
+	int64_t m_TickDuration;
+	// of every replayed tick, in nanoseconds
+	std::vector<int64_t> m_vTickDurations;
+
+	void ConnectClient(int ClientId);
+	void EnterPendingClients();
+	void AdvanceTo(int Tick);
+	void CheckPositions();
+#ifdef CONF_DEBUG
+	void CheckSnapshots();
+#endif
+
+	void OnJoin(int ClientId);
+	void OnDrop(int ClientId, const char *pReason);
+	void OnInput(int ClientId, const CNetObj_PlayerInput *pInput);
+	void OnDirectInput(int ClientId, const CNetObj_PlayerInput *pInput);
+	void OnMessage(int ClientId, const unsigned char *pData, int DataSize);
+	void OnConsoleCommand(const CTeeHistorianReader::CChunk *pChunk);
+	void OnEx(const CTeeHistorianReader::CChunk *pChunk);
+
+	void PrintReport(bool Finished);
+
+public:
+	CTeeHistorianReplay(CServer *pServer);
+
+	bool Load(IStorage *pStorage, const char *pFilename);
+	/**
+	 * Executes the configuration of the recorded server, must be called
+	 * before the command line arguments are parsed so they can override
+	 * it.
+	 */
+	void ApplyConfig(IConsole *pConsole);
+
+	/**
+	 * Replays the file, replaces `CServer::Run`.
+	 *
+	 * @return `0` if the character positions matched the recorded ones and
+	 * snap culling didn't change any snapshot.
+	 */
+	int Run();
+};
+
+#endif // ENGINE_SERVER_TEEHISTORIAN_REPLAY_H
@@ -0,0 +1,94 @@
+#include "tick_profiler.h"
+
+#include <algorithm>
+
+static const char *const s_apPhaseNames[] = {
+	"input",
+	"game_tick",
+	"snapshot",
+	"network",
+	"update",
+	"dnsbl",
+	"tick",
+};
+static_assert(std::size(s_apPhaseNames) == CTickProfiler::NUM_PHASES);
+
+CTickProfiler::CTickProfiler()
+{
+	Reset();
+}
+
+const char *CTickProfiler::PhaseName(int Phase)
+{
+	dbg_assert(Phase >= 0 && Phase < NUM_PHASES, "invalid phase");
+	return s_apPhaseNames[Phase];
+}
+
+int CTickProfiler::FindPhase(const char *pName)
+{
+	for(int Phase = 0; Phase < NUM_PHASES; Phase++)
+	{
+		if(str_comp_nocase(pName, s_apPhaseNames[Phase]) == 0)
+			return Phase;
+	}
+	return -1;
+}
+
+void CTickProfiler::Reset()
+{
+	for(auto &Phase : m_aPhases)
+	{
+		Phase.m_NumSamples = 0;
+		Phase.m_Next = 0;
+	}
+	m_NumTicks = 0;
+	m_NumOverruns = 0;
+	m_NumLateTicks = 0;
+}
+
+void CTickProfiler::AddTick(int64_t Duration, int64_t TickDuration, int NumTicks)
+{
+	Add(PHASE_TICK, Duration);
+	m_NumTicks += NumTicks;
+	m_NumLateTicks += NumTicks - 1;
+	if(Duration > TickDuration)
+		m_NumOverruns++;
+}
+
+CTickProfiler::CStats CTickProfiler::Stats(int Phase) const
+{
+	const CPhase &Current = m_aPhases[Phase];
+
+	CStats Stats;
+	Stats.m_NumSamples = Current.m_NumSamples;
+	Stats.m_P50 = 0;
+	Stats.m_P99 = 0;
+	Stats.m_Max = 0;
+	if(!Current.m_NumSamples)
+		return Stats;
+
+	int64_t aSorted[WINDOW_SIZE];
+	std::copy(Current.m_aSamples, Current.m_aSamples + Current.m_NumSamples, aSorted);
+	std::sort(aSorted, aSorted + Current.m_NumSamples);
+	Stats.m_P50 = aSorted[(Current.m_NumSamples - 1) / 2];
+	Stats.m_P99 = aSorted[(Current.m_NumSamples - 1) * 99 / 100];
+	Stats.m_Max = aSorted[Current.m_NumSamples - 1];
+	return Stats;
+}
+
+void CTickProfiler::Histogram(int Phase, int *pBuckets) const
+{
+	const CPhase &Current = m_aPhases[Phase];
+	std::fill(pBuckets, pBuckets + NUM_BUCKETS, 0);
+	for(int i = 0; i < Current.m_NumSamples; i++)
+	{
+		int64_t Microseconds = Current.m_aSamples[i] / 1000;
+		int Bucket = 0;
+		while(Microseconds >= 2 && Bucket < NUM_BUCKETS - 1)
+		{
+			Microseconds /= 2;
+			Bucket++;
+		}
+		pBuckets[Bucket]++;
+	}
+}
@@ -0,0 +1,112 @@
+#ifndef ENGINE_SERVER_TICK_PROFILER_H
+#define ENGINE_SERVER_TICK_PROFILER_H
+
+#include <base/system.h>
+
+#include <cstdint>
+
+/**
+ * Measures how long the phases of the server's main loop take.
+ *
+ * Keeps the durations of the last `WINDOW_SIZE` runs of every phase, from
+ * which percentiles and histograms are computed on request. Recording a
+ * sample only stores a number, so the profiler can stay enabled.
+ */
+class CTickProfiler
+{
+public:
+	enum
+	{
+		PHASE_INPUT = 0,
+		PHASE_GAME_TICK,
+		PHASE_SNAPSHOT,
+		PHASE_NETWORK,
+		PHASE_UPDATE,
+		PHASE_DNSBL,
+		PHASE_TICK, // all of the above done for new ticks in one loop iteration
+		NUM_PHASES,
+
+		WINDOW_SIZE = 512,
+
+		// bucket i counts durations below 2^(i+1) microseconds, the last one all remaining
+		NUM_BUCKETS = 16,
+	};
+
+	class CScope
+	{
+		CTickProfiler *m_pProfiler;
+		int m_Phase;
+		int64_t m_Start;
+
+	public:
+		CScope(CTickProfiler *pProfiler, int Phase) :
+			m_pProfiler(pProfiler), m_Phase(Phase), m_Start(time_get_nanoseconds().count()) {}
+		~CScope() { m_pProfiler->Add(m_Phase, time_get_nanoseconds().count() - m_Start); }
+	};
+
+	class CStats
+	{
+	public:
+		int m_NumSamples;
+		int64_t m_P50;
+		int64_t m_P99;
+		int64_t m_Max;
+	};
+
+private:
+	class CPhase
+	{
+	public:
+		int64_t m_aSamples[WINDOW_SIZE];
+		int m_NumSamples;
+		int m_Next;
+	};
+	CPhase m_aPhases[NUM_PHASES];
+
+	int64_t m_NumTicks;
+	int64_t m_NumOverruns;
+	int64_t m_NumLateTicks;
+
+public:
+	CTickProfiler();
+
+	static const char *PhaseName(int Phase);
+	static int FindPhase(const char *pName);
+
+	void Reset();
+
+	/**
+	 * Records one run of a phase.
+	 *
+	 * @param Phase The phase.
+	 * @param Duration Duration in nanoseconds.
+	 */
+	void Add(int Phase, int64_t Duration)
+	{
+		CPhase &Current = m_aPhases[Phase];
+		Current.m_aSamples[Current.m_Next] = Duration;
+		Current.m_Next = (Current.m_Next + 1) % WINDOW_SIZE;
+		if(Current.m_NumSamples < WINDOW_SIZE)
+			Current.m_NumSamples++;
+	}
+
+	/**
+	 * Records the work done for new ticks in one loop iteration.
+	 *
+	 * @param Duration Duration in nanoseconds.
+	 * @param TickDuration Duration of one tick in nanoseconds.
+	 * @param NumTicks Number of ticks that were done.
+	 */
+	void AddTick(int64_t Duration, int64_t TickDuration, int NumTicks);
+
+	CStats Stats(int Phase) const;
+	void Histogram(int Phase, int *pBuckets) const;
+
+	int64_t NumTicks() const { return m_NumTicks; }
+	// loop iterations that took longer than a tick
+	int64_t NumOverruns() const { return m_NumOverruns; }
+	// ticks that had to be caught up because the server fell behind
+	int64_t NumLateTicks() const { return m_NumLateTicks; }
+};
+
+#endif
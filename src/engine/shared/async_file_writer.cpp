@@ -0,0 +1,195 @@
+#include "async_file_writer.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+
+static const int COMPRESSED_BUFFER_SIZE = 64 * 1024;
+
+CAsyncFileWriter::CAsyncFileWriter() :
+	m_File(nullptr),
+	m_pThread(nullptr),
+	m_CompressionLevel(COMPRESSION_NONE),
+	m_MaxBufferSize(0),
+	m_QueuedFlushPoint(-1),
+	m_WritingSize(0),
+	m_Closing(false),
+	m_Error(0),
+	m_pZStream(nullptr)
+{
+	mem_zero(&m_Stats, sizeof(m_Stats));
+}
+
+CAsyncFileWriter::~CAsyncFileWriter()
+{
+	if(IsOpen())
+	{
+		Close();
+	}
+}
+
+void CAsyncFileWriter::Open(IOHANDLE File, int CompressionLevel, int MaxBufferSize)
+{
+	dbg_assert(!IsOpen(), "async file writer already open");
+	dbg_assert(CompressionLevel >= COMPRESSION_NONE && CompressionLevel <= Z_BEST_COMPRESSION, "invalid compression level");
+	m_File = File;
+	m_CompressionLevel = CompressionLevel;
+	m_MaxBufferSize = MaxBufferSize;
+	m_QueuedFlushPoint = -1;
+	m_WritingSize = 0;
+	m_Closing = false;
+	m_Error = 0;
+	mem_zero(&m_Stats, sizeof(m_Stats));
+
+	if(m_CompressionLevel != COMPRESSION_NONE)
+	{
+		m_pZStream = new z_stream;
+		mem_zero(m_pZStream, sizeof(*m_pZStream));
+		// 16 added to the window bits selects the gzip format
+		const int Result = deflateInit2(m_pZStream, m_CompressionLevel, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+		dbg_assert(Result == Z_OK, "deflateInit2 failed");
+		m_vCompressed.resize(COMPRESSED_BUFFER_SIZE);
+	}
+
+	m_pThread = thread_init(WriterThread, this, "async writer");
+}
+
+void CAsyncFileWriter::WriterThread(void *pUser)
+{
+	static_cast<CAsyncFileWriter *>(pUser)->Run();
+}
+
+void CAsyncFileWriter::Run()
+{
+	std::unique_lock<std::mutex> Lock(m_Lock);
+	while(true)
+	{
+		m_QueuedCv.wait(Lock, [this]() { return !m_vQueued.empty() || m_QueuedFlushPoint >= 0 || m_Closing; });
+
+		// nothing can be queued after closing, this is the last batch
+		const bool Finish = m_Closing;
+		const int FlushPoint = m_QueuedFlushPoint;
+		m_QueuedFlushPoint = -1;
+		m_vWriting.swap(m_vQueued);
+		m_WritingSize = m_vWriting.size();
+		Lock.unlock();
+
+		const int LastFlush = Finish ? Z_FINISH : Z_NO_FLUSH;
+		int64_t BytesOut = 0;
+		int Error;
+		if(FlushPoint >= 0)
+		{
+			Error = WriteData(m_vWriting.data(), FlushPoint, Z_FULL_FLUSH, &BytesOut);
+			if(!Error)
+				Error = WriteData(m_vWriting.data() + FlushPoint, m_vWriting.size() - FlushPoint, LastFlush, &BytesOut);
+		}
+		else
+		{
+			Error = WriteData(m_vWriting.data(), m_vWriting.size(), LastFlush, &BytesOut);
+		}
+		io_flush(m_File);
+		if(!Error)
+			Error = io_error(m_File);
+		m_vWriting.clear();
+
+		Lock.lock();
+		m_WritingSize = 0;
+		if(Error)
+			m_Error = Error;
+		m_Stats.m_BytesOut += BytesOut;
+		m_WrittenCv.notify_all();
+		if(Finish)
+			break;
+	}
+}
+
+int CAsyncFileWriter::WriteData(const unsigned char *pData, int Size, int Flush, int64_t *pBytesOut)
+{
+	if(!m_pZStream)
+	{
+		if(Size > 0 && io_write(m_File, pData, Size) != (unsigned)Size)
+			return -1;
+		*pBytesOut += Size;
+		return 0;
+	}
+
+	m_pZStream->next_in = (Bytef *)pData;
+	m_pZStream->avail_in = Size;
+	do
+	{
+		m_pZStream->next_out = m_vCompressed.data();
+		m_pZStream->avail_out = m_vCompressed.size();
+		if(deflate(m_pZStream, Flush) == Z_STREAM_ERROR)
+			return -1;
+		const unsigned Have = m_vCompressed.size() - m_pZStream->avail_out;
+		if(Have > 0 && io_write(m_File, m_vCompressed.data(), Have) != Have)
+			return -1;
+		*pBytesOut += Have;
+	} while(m_pZStream->avail_out == 0);
+	return 0;
+}
+
+void CAsyncFileWriter::Write(const void *pData, int Size)
+{
+	dbg_assert(IsOpen(), "async file writer not open");
+	{
+		std::unique_lock<std::mutex> Lock(m_Lock);
+		auto Buffered = [this]() { return (int64_t)m_vQueued.size() + m_WritingSize; };
+		if(m_MaxBufferSize > 0 && Buffered() > 0 && Buffered() + Size > m_MaxBufferSize)
+		{
+			const int64_t StallStart = time_get_nanoseconds().count();
+			m_WrittenCv.wait(Lock, [&]() { return Buffered() == 0 || Buffered() + Size <= m_MaxBufferSize; });
+			m_Stats.m_NumStalls++;
+			m_Stats.m_StallTimeNs += time_get_nanoseconds().count() - StallStart;
+		}
+		m_vQueued.insert(m_vQueued.end(), (const unsigned char *)pData, (const unsigned char *)pData + Size);
+		m_Stats.m_BytesIn += Size;
+		m_Stats.m_BufferPeak = std::max(m_Stats.m_BufferPeak, Buffered());
+	}
+	m_QueuedCv.notify_one();
+}
+
+void CAsyncFileWriter::FlushPoint()
+{
+	dbg_assert(IsOpen(), "async file writer not open");
+	{
+		std::unique_lock<std::mutex> Lock(m_Lock);
+		m_QueuedFlushPoint = m_vQueued.size();
+		m_Stats.m_NumFlushPoints++;
+	}
+	m_QueuedCv.notify_one();
+}
+
+void CAsyncFileWriter::Close()
+{
+	dbg_assert(IsOpen(), "async file writer not open");
+	{
+		std::unique_lock<std::mutex> Lock(m_Lock);
+		m_Closing = true;
+	}
+	m_QueuedCv.notify_one();
+	thread_wait(m_pThread);
+	m_pThread = nullptr;
+
+	if(m_pZStream)
+	{
+		deflateEnd(m_pZStream);
+		delete m_pZStream;
+		m_pZStream = nullptr;
+	}
+	if(io_close(m_File) != 0 && !m_Error)
+		m_Error = -1;
+	m_File = nullptr;
+}
+
+int CAsyncFileWriter::Error()
+{
+	std::unique_lock<std::mutex> Lock(m_Lock);
+	return m_Error;
+}
+
+CAsyncFileWriter::CStats CAsyncFileWriter::Stats()
+{
+	std::unique_lock<std::mutex> Lock(m_Lock);
+	return m_Stats;
+}
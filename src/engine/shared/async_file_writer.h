@@ -0,0 +1,112 @@
+#ifndef ENGINE_SHARED_ASYNC_FILE_WRITER_H
+#define ENGINE_SHARED_ASYNC_FILE_WRITER_H
+
+#include <base/system.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+typedef struct z_stream_s z_stream;
+
+/**
+ * Writes a file on a separate thread, optionally compressing it with
+ * zlib on that thread.
+ *
+ * Compressed files are written in the gzip format. The compressor is
+ * fully flushed at every flush point, so the data up to the last flush
+ * point can be recovered from a file that wasn't closed, and reading can
+ * start at any flush point without the data before it.
+ *
+ * With a maximum buffer size, writing blocks until the writer thread
+ * caught up instead of buffering more data, the time spent waiting is
+ * reported in the statistics.
+ */
+class CAsyncFileWriter
+{
+public:
+	enum
+	{
+		COMPRESSION_NONE = 0,
+	};
+
+	class CStats
+	{
+	public:
+		// bytes passed to `Write`
+		int64_t m_BytesIn;
+		// bytes written to the file
+		int64_t m_BytesOut;
+		int64_t m_NumFlushPoints;
+		// highest amount of buffered bytes not written to the file yet
+		int64_t m_BufferPeak;
+		// number of writes that had to wait for the writer thread
+		int64_t m_NumStalls;
+		int64_t m_StallTimeNs;
+	};
+
+private:
+	IOHANDLE m_File;
+	void *m_pThread;
+	int m_CompressionLevel;
+	int m_MaxBufferSize;
+
+	std::mutex m_Lock;
+	// signaled when data is queued and when the writer should exit
+	std::condition_variable m_QueuedCv;
+	// signaled when the writer thread finished writing a batch
+	std::condition_variable m_WrittenCv;
+	std::vector<unsigned char> m_vQueued;
+	// size of `m_vQueued` at the last flush point, -1 if there's none
+	int m_QueuedFlushPoint;
+	// bytes the writer thread is currently working on
+	int m_WritingSize;
+	bool m_Closing;
+	int m_Error;
+	CStats m_Stats;
+
+	// only used by the writer thread
+	std::vector<unsigned char> m_vWriting;
+	z_stream *m_pZStream;
+	std::vector<unsigned char> m_vCompressed;
+
+	static void WriterThread(void *pUser);
+	void Run();
+	// called on the writer thread without the lock
+	int WriteData(const unsigned char *pData, int Size, int Flush, int64_t *pBytesOut);
+
+public:
+	CAsyncFileWriter();
+	~CAsyncFileWriter();
+
+	/**
+	 * Starts writing to the file, takes ownership of it.
+	 *
+	 * @param File The file to write to.
+	 * @param CompressionLevel `COMPRESSION_NONE` or a zlib compression level
+	 * from 1 to 9.
+	 * @param MaxBufferSize Maximum number of bytes to buffer before `Write`
+	 * blocks, `0` for no limit.
+	 */
+	void Open(IOHANDLE File, int CompressionLevel, int MaxBufferSize);
+	bool IsOpen() const { return m_pThread != nullptr; }
+
+	void Write(const void *pData, int Size);
+	/**
+	 * Marks the data written so far as a flush point, the writer thread
+	 * writes it out completely to the file.
+	 */
+	void FlushPoint();
+	/**
+	 * Finishes writing all queued data, closes the file and waits for the
+	 * writer thread to exit.
+	 */
+	void Close();
+
+	// the last error of the writer thread, `0` if there was none
+	int Error();
+	CStats Stats();
+};
+
+#endif
@@ -24,6 +24,8 @@ MACRO_CONFIG_INT(ClAntiPingSmooth, cl_antiping_smooth, 0, 0, 1, CFGFLAG_CLIENT |
 MACRO_CONFIG_INT(ClAntiPingGunfire, cl_antiping_gunfire, 1, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Predict gunfire and show predicted weapon physics (with cl_antiping_grenade 1 and cl_antiping_weapons 1)")
 MACRO_CONFIG_INT(ClPredictionMargin, cl_prediction_margin, 10, 1, 300, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Prediction margin in ms (adds latency, can reduce lag from ping jumps)")
 MACRO_CONFIG_INT(ClSubTickAiming, cl_sub_tick_aiming, 0, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Send aiming data at sub-tick accuracy")
+MACRO_CONFIG_INT(ClSnapshotThread, cl_snapshot_thread, 0, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Decompress and unpack received snapshots on a separate thread")
+MACRO_CONFIG_INT(ClNetThread, cl_net_thread, 0, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Receive packets on a separate thread to take their arrival times more accurately")
 
 MACRO_CONFIG_INT(ClNameplates, cl_nameplates, 1, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Show name plates")
 MACRO_CONFIG_INT(ClAfkEmote, cl_afk_emote, 1, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SAVE, "Show zzz emote next to afk players")
@@ -277,6 +279,8 @@ MACRO_CONFIG_INT(ClVideoX264Preset, cl_video_preset, 5, 0, 9, CFGFLAG_CLIENT | C
 // debug
 #ifdef CONF_DEBUG
 MACRO_CONFIG_INT(DbgDummies, dbg_dummies, 0, 0, MAX_CLIENTS, CFGFLAG_SERVER, "Add debug dummies to server (Debug build only)")
+MACRO_CONFIG_INT(DbgSnapCulling, dbg_snap_culling, 0, 0, 1, CFGFLAG_SERVER, "Build every snapshot a second time without snap culling and report differences (Debug build only)")
+MACRO_CONFIG_INT(DbgWorldGrid, dbg_world_grid, 0, 0, 1, CFGFLAG_SERVER, "Run the entity queries of the game world a second time without the grid and compare the results (Debug build only)")
 #endif
 
 MACRO_CONFIG_INT(DbgTuning, dbg_tuning, 0, 0, 2, CFGFLAG_CLIENT, "Display information about the tuning parameters that affect the own player (0 = off, 1 = show changed, 2 = show all)")
@@ -430,6 +434,11 @@ MACRO_CONFIG_STR(SvHostname, sv_hostname, 128, "", CFGFLAG_SERVER, "Server hostn
 MACRO_CONFIG_STR(SvMap, sv_map, 128, "Sunny Side Up", CFGFLAG_SERVER, "Map to use on the server")
 MACRO_CONFIG_INT(SvMaxClients, sv_max_clients, MAX_CLIENTS, 1, MAX_CLIENTS, CFGFLAG_SERVER, "Maximum number of clients that are allowed on a server")
 MACRO_CONFIG_INT(SvMaxClientsPerIp, sv_max_clients_per_ip, 4, 1, MAX_CLIENTS, CFGFLAG_SERVER, "Maximum number of clients with the same IP that can connect to the server")
+MACRO_CONFIG_INT(SvSnapshotThreads, sv_snapshot_threads, 0, 0, 16, CFGFLAG_SERVER, "Number of worker threads that create and compress snapshot deltas (0 for the main thread only)")
+MACRO_CONFIG_INT(SvSnapshotBandwidth, sv_snapshot_bandwidth, 0, 0, 1, CFGFLAG_SERVER, "Count the snapshot bytes before and after delta and compression per item type and client (see snapshot_bandwidth)")
+MACRO_CONFIG_INT(SvSnapshotBandwidthDump, sv_snapshot_bandwidth_dump, 0, 0, 3600, CFGFLAG_SERVER, "Interval in seconds to append the snapshot bandwidth statistics to a CSV file in dumps/ (0 = off)")
+MACRO_CONFIG_INT(SvSnapCulling, sv_snap_culling, 1, 0, 1, CFGFLAG_SERVER, "Only ask entities close to a client's view to snap")
+MACRO_CONFIG_INT(SvNetSendBatching, sv_net_send_batching, 0, 0, 1, CFGFLAG_SERVER, "Queue outgoing packets and send them in batches once per loop iteration (Linux only)")
 MACRO_CONFIG_INT(SvHighBandwidth, sv_high_bandwidth, 0, 0, 1, CFGFLAG_SERVER, "Use high bandwidth mode. Doubles the bandwidth required for the server. LAN use only")
 MACRO_CONFIG_STR(SvRegister, sv_register, 16, "1", CFGFLAG_SERVER, "Register server with master server for public listing, can also accept a comma-separated list of protocols to register on, like 'ipv4,ipv6'")
 MACRO_CONFIG_STR(SvRegisterExtra, sv_register_extra, 256, "", CFGFLAG_SERVER, "Extra headers to send to the register endpoint, comma separated 'Header: Value' pairs")
@@ -442,6 +451,10 @@ MACRO_CONFIG_INT(SvRconBantime, sv_rcon_bantime, 5, 0, 1440, CFGFLAG_SERVER, "Th
 MACRO_CONFIG_INT(SvAutoDemoRecord, sv_auto_demo_record, 0, 0, 1, CFGFLAG_SERVER, "Automatically record demos")
 MACRO_CONFIG_INT(SvAutoDemoMax, sv_auto_demo_max, 10, 0, 1000, CFGFLAG_SERVER, "Maximum number of automatically recorded demos (0 = no limit)")
 MACRO_CONFIG_INT(SvTeeHistorian, sv_tee_historian, 0, 0, 1, CFGFLAG_SERVER, "Activate the tee historian that writes complete gameplay data to disk (WARNING: This will use a lot of disk space)")
+MACRO_CONFIG_INT(SvTeeHistorianCompression, sv_tee_historian_compression, 0, 0, 9, CFGFLAG_SERVER, "Compress the tee historian files with gzip at this level (0 = uncompressed, 1 = fastest, 9 = smallest)")
+MACRO_CONFIG_INT(SvTeeHistorianFlushInterval, sv_tee_historian_flush_interval, 1, 1, 60, CFGFLAG_SERVER, "Seconds between the points up to which the tee historian file is completely written out, compressed files are only recoverable up to the last one")
+MACRO_CONFIG_INT(SvTeeHistorianMaxBuffer, sv_tee_historian_max_buffer, 0, 0, 1048576, CFGFLAG_SERVER, "Maximum KiB of tee historian data waiting to be written before the server waits for the disk (0 = no limit)")
+MACRO_CONFIG_STR(SvPrngSeed, sv_prng_seed, 64, "", CFGFLAG_SERVER, "Seed the game's random number generator like the given prng_description of a teehistorian file instead of randomly (used for replays)")
 MACRO_CONFIG_INT(SvVanillaAntiSpoof, sv_vanilla_antispoof, 1, 0, 1, CFGFLAG_SERVER, "Enable vanilla Antispoof")
 MACRO_CONFIG_INT(SvDnsbl, sv_dnsbl, 0, 0, 1, CFGFLAG_SERVER, "Enable DNSBL (DNS-based Blackhole List)")
 MACRO_CONFIG_STR(SvDnsblHost, sv_dnsbl_host, 128, "", CFGFLAG_SERVER, "Hostname of DNSBL provider to use for IP Verification")
@@ -464,6 +477,7 @@ MACRO_CONFIG_INT(EcPort, ec_port, 0, 0, 65535, CFGFLAG_ECON, "Port to use for th
 MACRO_CONFIG_STR(EcPassword, ec_password, 128, "", CFGFLAG_ECON, "External console password. This option is required to be set for econ to be enabled.")
 MACRO_CONFIG_INT(EcBantime, ec_bantime, 0, 0, 1440, CFGFLAG_ECON, "The time a client gets banned if econ authentication fails. 0 just closes the connection")
 MACRO_CONFIG_INT(EcAuthTimeout, ec_auth_timeout, 30, 1, 120, CFGFLAG_ECON, "Time in seconds before the the econ authentication times out")
+MACRO_CONFIG_INT(EcTickProfile, ec_tick_profile, 0, 0, 3600, CFGFLAG_ECON, "Interval in seconds to send the tick profile to the external console (0 = off)")
 MACRO_CONFIG_INT(EcOutputLevel, ec_output_level, 0, -3, 2, CFGFLAG_ECON, "Adjusts the amount of information in the external console (-3 = none, -2 = error only, -1 = warn, 0 = info, 1 = debug, 2 = trace)")
 
 MACRO_CONFIG_INT(Debug, debug, 0, 0, 1, CFGFLAG_CLIENT | CFGFLAG_SERVER, "Debug mode")
@@ -472,6 +486,7 @@ MACRO_CONFIG_INT(DbgGraphs, dbg_graphs, 0, 0, 1, CFGFLAG_CLIENT, "Performance gr
 MACRO_CONFIG_INT(DbgGfx, dbg_gfx, 0, 0, 4, CFGFLAG_CLIENT, "Show graphic library warnings and errors, if the GPU supports it (0: none, 1: minimal, 2: affects performance, 3: verbose, 4: all)")
 #ifdef CONF_DEBUG
 MACRO_CONFIG_INT(DbgStress, dbg_stress, 0, 0, 1, CFGFLAG_CLIENT, "Stress systems (Debug build only)")
+MACRO_CONFIG_INT(DbgPredictionCache, dbg_prediction_cache, 0, 0, 1, CFGFLAG_CLIENT, "Predict every frame a second time without the prediction cache and report differences (Debug build only)")
 MACRO_CONFIG_STR(DbgStressServer, dbg_stress_server, 32, "localhost", CFGFLAG_CLIENT, "Server to stress (Debug build only)")
 #endif
 
@@ -562,6 +577,8 @@ MACRO_CONFIG_INT(SvOldLaser, sv_old_laser, 0, 0, 1, CFGFLAG_SERVER | CFGFLAG_GAM
 MACRO_CONFIG_INT(SvSlashMe, sv_slash_me, 0, 0, 1, CFGFLAG_SERVER, "Whether /me is active on the server or not")
 MACRO_CONFIG_INT(SvRejoinTeam0, sv_rejoin_team_0, 1, 0, 1, CFGFLAG_SERVER, "Make a team automatically rejoin team 0 after finish (only if not locked)")
 
+MACRO_CONFIG_INT(SvCoreBroadphase, sv_core_broadphase, 1, 0, 1, CFGFLAG_SERVER, "Only check nearby characters for collisions and hook hits, the results are the same")
+MACRO_CONFIG_INT(SvTeamThreads, sv_team_threads, 0, 0, 16, CFGFLAG_SERVER, "Number of worker threads that move the cores of characters in different teams, the rest of the tick stays on the main thread (0 for the main thread only)")
 MACRO_CONFIG_INT(SvNoWeakHook, sv_no_weak_hook, 0, 0, 1, CFGFLAG_SERVER | CFGFLAG_GAME, "Whether to use an alternative calculation for world ticks, that makes the hook behave like all players have strong.")
 
 MACRO_CONFIG_INT(ClReconnectTimeout, cl_reconnect_timeout, 120, 0, 600, CFGFLAG_CLIENT | CFGFLAG_SAVE, "How many seconds to wait before reconnecting (after timeout, 0 for off)")
@@ -11,6 +11,7 @@
 
 class CHuffman;
 class CNetBan;
+class CNetRecvThread;
 class CPacker;
 
 /*
@@ -382,10 +383,27 @@ class CNetServer
 	struct CSpamConn
 	{
 		NETADDR m_Addr;
+		unsigned m_AddrHash;
 		int64_t m_Time;
 		int m_Conns;
 	};
 
+	enum
+	{
+		NUM_ADDR_BUCKETS = 2 * NET_MAX_CLIENTS, // power of two
+	};
+
+	// Hash chains of slots by their full address and by their IP only.
+	// Every slot is indexed under the address it was last given. Entries are
+	// checked against the slot's current state and address on lookup, so
+	// stale entries of slots that went offline are harmless.
+	struct CAddrIndex
+	{
+		int m_aBuckets[NUM_ADDR_BUCKETS];
+		int m_aNext[NET_MAX_CLIENTS];
+		int m_aBucket[NET_MAX_CLIENTS];
+	};
+
 	NETADDR m_Address;
 	NETSOCKET m_Socket;
 	CNetBan *m_pNetBan;
@@ -393,6 +411,9 @@ class CNetServer
 	int m_MaxClients;
 	int m_MaxClientsPerIp;
 
+	CAddrIndex m_AddrIndex;
+	CAddrIndex m_IpIndex;
+
 	NETFUNC_NEWCLIENT m_pfnNewClient;
 	NETFUNC_NEWCLIENT_NOAUTH m_pfnNewClientNoAuth;
 	NETFUNC_DELCLIENT m_pfnDelClient;
@@ -415,6 +436,11 @@ class CNetServer
 	int OnSixupCtrlMsg(NETADDR &Addr, CNetChunk *pChunk, int ControlMsg, const CNetPacketConstruct &Packet, SECURITY_TOKEN &ResponseToken, SECURITY_TOKEN Token);
 	void OnPreConnMsg(NETADDR &Addr, CNetPacketConstruct &Packet);
 	void OnConnCtrlMsg(NETADDR &Addr, int ClientId, int ControlMsg, const CNetPacketConstruct &Packet);
+	static unsigned AddrHash(const NETADDR &Addr, bool WithPort);
+	static void IndexInit(CAddrIndex *pIndex);
+	static void IndexRemove(CAddrIndex *pIndex, int Slot);
+	static void IndexAdd(CAddrIndex *pIndex, int Slot, unsigned Hash);
+	void IndexSlot(int Slot);
 	bool ClientExists(const NETADDR &Addr) { return GetClientSlot(Addr) != -1; }
 	int GetClientSlot(const NETADDR &Addr);
 	void SendControl(NETADDR &Addr, int ControlMsg, const void *pExtra, int ExtraSize, SECURITY_TOKEN SecurityToken);
@@ -511,8 +537,13 @@ class CNetClient
 {
 	CNetConnection m_Connection;
 	CNetRecvUnpacker m_RecvUnpacker;
+	// arrival time of the packet the chunks are unpacked from
+	int64_t m_RecvTime = 0;
 
 	CStun *m_pStun = nullptr;
+	CNetRecvThread *m_pRecvThread = nullptr;
+
+	int RecvDatagram(NETADDR *pAddr, unsigned char **ppData);
 
 public:
 	NETSOCKET m_Socket;
@@ -528,11 +559,21 @@ public:
 	// communication
 	int Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken, bool Sixup);
 	int Send(CNetChunk *pChunk);
+	// arrival time of the packet of the last chunk returned by `Recv`
+	int64_t RecvTime() const { return m_RecvTime; }
 
 	// pumping
 	int Update();
 	int Flush();
 
+	// reads the socket on a separate thread, so the packets are stamped with
+	// their arrival time instead of the time they are polled at
+	void StartRecvThread();
+	void StopRecvThread();
+	bool RecvThreadRunning() const;
+	// waits until the receive thread queued a datagram, returns whether it did
+	bool RecvThreadWait(std::chrono::nanoseconds Timeout);
+
 	int ResetErrorString();
 
 	// error and state
@@ -1,6 +1,8 @@
 /* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
 /* If you are missing that file, acquire a complete release at teeworlds.com.                */
 #include "network.h"
+#include "network_recv_thread.h"
+
 #include <base/system.h>
 
 bool CNetClient::Open(NETADDR BindAddr)
@@ -26,6 +28,11 @@ int CNetClient::Close()
 {
 	if(!m_Socket)
 		return 0;
+	if(m_pRecvThread)
+	{
+		delete m_pRecvThread;
+		m_pRecvThread = nullptr;
+	}
 	if(m_pStun)
 	{
 		delete m_pStun;
@@ -68,6 +75,46 @@ int CNetClient::ResetErrorString()
 	return 0;
 }
 
+void CNetClient::StartRecvThread()
+{
+	dbg_assert(!RecvThreadRunning(), "Receive thread already running");
+	// datagrams left over from a stopped thread have to be taken first
+	if(!m_pRecvThread)
+		m_pRecvThread = new CNetRecvThread(m_Socket);
+}
+
+void CNetClient::StopRecvThread()
+{
+	dbg_assert(RecvThreadRunning(), "Receive thread not running");
+	m_pRecvThread->Stop();
+}
+
+bool CNetClient::RecvThreadRunning() const
+{
+	return m_pRecvThread && m_pRecvThread->IsRunning();
+}
+
+bool CNetClient::RecvThreadWait(std::chrono::nanoseconds Timeout)
+{
+	dbg_assert(RecvThreadRunning(), "Receive thread not running");
+	return m_pRecvThread->Wait(Timeout);
+}
+
+int CNetClient::RecvDatagram(NETADDR *pAddr, unsigned char **ppData)
+{
+	if(m_pRecvThread)
+	{
+		const int Bytes = m_pRecvThread->Recv(pAddr, ppData, &m_RecvTime);
+		if(Bytes > 0 || m_pRecvThread->IsRunning())
+			return Bytes;
+		// the thread was stopped and everything it read is taken
+		delete m_pRecvThread;
+		m_pRecvThread = nullptr;
+	}
+	m_RecvTime = time_get();
+	return net_udp_recv(m_Socket, pAddr, ppData);
+}
+
 int CNetClient::Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken, bool Sixup)
 {
 	while(true)
@@ -79,7 +126,7 @@ int CNetClient::Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken, bool Six
 		// TODO: empty the recvinfo
 		NETADDR Addr;
 		unsigned char *pData;
-		int Bytes = net_udp_recv(m_Socket, &Addr, &pData);
+		int Bytes = RecvDatagram(&Addr, &pData);
 
 		// no more packets for now
 		if(Bytes <= 0)
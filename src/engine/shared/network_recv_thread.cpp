@@ -0,0 +1,93 @@
+#include "network_recv_thread.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+CNetRecvThread::CNetRecvThread(NETSOCKET Socket) :
+	m_Socket(Socket),
+	m_pQueue(std::make_unique<CPacket[]>(QUEUE_SIZE)),
+	m_NumPushed(0),
+	m_NumPopped(0),
+	m_NumTaken(0),
+	m_Shutdown(false)
+{
+	m_pThread = thread_init(Thread, this, "net recv");
+}
+
+CNetRecvThread::~CNetRecvThread()
+{
+	if(IsRunning())
+	{
+		Stop();
+	}
+}
+
+void CNetRecvThread::Thread(void *pUser)
+{
+	CNetRecvThread *pSelf = static_cast<CNetRecvThread *>(pUser);
+	while(!pSelf->m_Shutdown.load(std::memory_order_relaxed))
+	{
+		const unsigned Index = pSelf->m_NumPushed.load(std::memory_order_relaxed);
+		if(Index - pSelf->m_NumPopped.load(std::memory_order_acquire) == QUEUE_SIZE)
+		{
+			std::this_thread::sleep_for(1ms);
+			continue;
+		}
+
+		NETADDR Addr;
+		unsigned char *pData;
+		const int Bytes = net_udp_recv(pSelf->m_Socket, &Addr, &pData);
+		if(Bytes <= 0)
+		{
+			// wake up regularly to notice the shutdown
+			net_socket_read_wait(pSelf->m_Socket, 100000);
+			continue;
+		}
+		if(Bytes > NET_MAX_PACKETSIZE)
+			continue;
+
+		CPacket *pPacket = &pSelf->m_pQueue[Index % QUEUE_SIZE];
+		pPacket->m_Addr = Addr;
+		pPacket->m_RecvTime = time_get();
+		pPacket->m_DataSize = Bytes;
+		mem_copy(pPacket->m_aData, pData, Bytes);
+		pSelf->m_NumPushed.store(Index + 1, std::memory_order_release);
+		{
+			// the owner checks the queue under the lock before waiting,
+			// so the notification can't get lost in between
+			std::unique_lock<std::mutex> Lock(pSelf->m_QueuedLock);
+		}
+		pSelf->m_QueuedCv.notify_one();
+	}
+}
+
+void CNetRecvThread::Stop()
+{
+	dbg_assert(IsRunning(), "Receive thread not running");
+	m_Shutdown.store(true, std::memory_order_relaxed);
+	thread_wait(m_pThread);
+	m_pThread = nullptr;
+}
+
+int CNetRecvThread::Recv(NETADDR *pAddr, unsigned char **ppData, int64_t *pRecvTime)
+{
+	// release the datagram returned by the last call
+	m_NumPopped.store(m_NumTaken, std::memory_order_release);
+	if(m_NumPushed.load(std::memory_order_acquire) == m_NumTaken)
+		return 0;
+
+	CPacket *pPacket = &m_pQueue[m_NumTaken % QUEUE_SIZE];
+	m_NumTaken++;
+	*pAddr = pPacket->m_Addr;
+	*ppData = pPacket->m_aData;
+	*pRecvTime = pPacket->m_RecvTime;
+	return pPacket->m_DataSize;
+}
+
+bool CNetRecvThread::Wait(std::chrono::nanoseconds Timeout)
+{
+	std::unique_lock<std::mutex> Lock(m_QueuedLock);
+	return m_QueuedCv.wait_for(Lock, Timeout, [this]() { return m_NumPushed.load(std::memory_order_acquire) != m_NumTaken; });
+}
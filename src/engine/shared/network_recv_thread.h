@@ -0,0 +1,90 @@
+#ifndef ENGINE_SHARED_NETWORK_RECV_THREAD_H
+#define ENGINE_SHARED_NETWORK_RECV_THREAD_H
+
+#include "network.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+/**
+ * Reads the datagrams of a socket on a separate thread.
+ *
+ * The thread blocks on the socket and stamps every datagram with the time it
+ * was read, so the arrival times don't depend on how often the owner gets to
+ * poll the socket. The datagrams are handed over through a single producer,
+ * single consumer queue. If the queue is full, the thread stops reading and
+ * the datagrams are left to the socket buffer.
+ */
+class CNetRecvThread
+{
+	class CPacket
+	{
+	public:
+		NETADDR m_Addr;
+		int64_t m_RecvTime;
+		int m_DataSize;
+		unsigned char m_aData[NET_MAX_PACKETSIZE];
+	};
+
+	enum
+	{
+		QUEUE_SIZE = 256,
+	};
+
+	NETSOCKET m_Socket;
+	std::unique_ptr<CPacket[]> m_pQueue;
+	// advanced by the receive thread
+	std::atomic<unsigned> m_NumPushed;
+	// advanced by the owner, `m_NumTaken` can be one ahead of `m_NumPopped`
+	// while the data of the last returned datagram is still in use
+	std::atomic<unsigned> m_NumPopped;
+	unsigned m_NumTaken;
+
+	// only taken to wake up the owner waiting in `Wait`
+	std::mutex m_QueuedLock;
+	std::condition_variable m_QueuedCv;
+
+	void *m_pThread;
+	std::atomic<bool> m_Shutdown;
+
+	static void Thread(void *pUser);
+
+public:
+	CNetRecvThread(NETSOCKET Socket);
+	~CNetRecvThread();
+	CNetRecvThread(const CNetRecvThread &) = delete;
+	CNetRecvThread &operator=(const CNetRecvThread &) = delete;
+
+	/**
+	 * Stops the thread. The datagrams that were already read can still be
+	 * taken with `Recv`, the remaining ones are left to the socket.
+	 */
+	void Stop();
+	bool IsRunning() const { return m_pThread != nullptr; }
+
+	/**
+	 * Works like `net_udp_recv`, but takes the datagrams from the queue.
+	 *
+	 * @param pAddr Receives the sender of the datagram.
+	 * @param ppData Receives the datagram, valid until the next call.
+	 * @param pRecvTime Receives the time the datagram was read.
+	 *
+	 * @return The size of the datagram, 0 if the queue is empty.
+	 */
+	int Recv(NETADDR *pAddr, unsigned char **ppData, int64_t *pRecvTime);
+
+	/**
+	 * Waits until a datagram is queued, like `net_socket_read_wait` does
+	 * for the socket.
+	 *
+	 * @param Timeout The longest time to wait.
+	 *
+	 * @return `true` if a datagram can be taken with `Recv`.
+	 */
+	bool Wait(std::chrono::nanoseconds Timeout);
+};
+
+#endif
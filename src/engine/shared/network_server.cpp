@@ -64,6 +64,9 @@ bool CNetServer::Open(NETADDR BindAddr, CNetBan *pNetBan, int MaxClients, int Ma
 	for(auto &Slot : m_aSlots)
 		Slot.m_Connection.Init(m_Socket, true);
 
+	IndexInit(&m_AddrIndex);
+	IndexInit(&m_IpIndex);
+
 	return true;
 }
 
@@ -146,11 +149,73 @@ void CNetServer::SendControl(NETADDR &Addr, int ControlMsg, const void *pExtra,
 	CNetBase::SendControlMsg(m_Socket, &Addr, 0, ControlMsg, pExtra, ExtraSize, SecurityToken);
 }
 
+unsigned CNetServer::AddrHash(const NETADDR &Addr, bool WithPort)
+{
+	// FNV-1a, covers every field compared by net_addr_comp
+	unsigned Hash = 2166136261u;
+	const auto &&Add = [&Hash](unsigned char Byte) {
+		Hash = (Hash ^ Byte) * 16777619u;
+	};
+	for(int i = 0; i < 4; i++)
+		Add((Addr.type >> (i * 8)) & 0xff);
+	for(unsigned char Byte : Addr.ip)
+		Add(Byte);
+	if(WithPort)
+	{
+		Add(Addr.port & 0xff);
+		Add(Addr.port >> 8);
+	}
+	return Hash;
+}
+
+void CNetServer::IndexInit(CAddrIndex *pIndex)
+{
+	for(int &Bucket : pIndex->m_aBuckets)
+		Bucket = -1;
+	for(int i = 0; i < NET_MAX_CLIENTS; i++)
+	{
+		pIndex->m_aNext[i] = -1;
+		pIndex->m_aBucket[i] = -1;
+	}
+}
+
+void CNetServer::IndexRemove(CAddrIndex *pIndex, int Slot)
+{
+	if(pIndex->m_aBucket[Slot] == -1)
+		return;
+	int *pLink = &pIndex->m_aBuckets[pIndex->m_aBucket[Slot]];
+	while(*pLink != Slot)
+		pLink = &pIndex->m_aNext[*pLink];
+	*pLink = pIndex->m_aNext[Slot];
+	pIndex->m_aNext[Slot] = -1;
+	pIndex->m_aBucket[Slot] = -1;
+}
+
+void CNetServer::IndexAdd(CAddrIndex *pIndex, int Slot, unsigned Hash)
+{
+	IndexRemove(pIndex, Slot);
+	const int Bucket = Hash & (NUM_ADDR_BUCKETS - 1);
+	pIndex->m_aNext[Slot] = pIndex->m_aBuckets[Bucket];
+	pIndex->m_aBuckets[Bucket] = Slot;
+	pIndex->m_aBucket[Slot] = Bucket;
+}
+
+void CNetServer::IndexSlot(int Slot)
+{
+	// must be called whenever the peer address of a slot is set
+	const NETADDR *pAddr = m_aSlots[Slot].m_Connection.PeerAddress();
+	IndexAdd(&m_AddrIndex, Slot, AddrHash(*pAddr, true));
+	IndexAdd(&m_IpIndex, Slot, AddrHash(*pAddr, false));
+}
+
 int CNetServer::NumClientsWithAddr(NETADDR Addr)
 {
 	int FoundAddr = 0;
-	for(int i = 0; i < MaxClients(); ++i)
+	for(int i = m_IpIndex.m_aBuckets[AddrHash(Addr, false) & (NUM_ADDR_BUCKETS - 1)]; i != -1; i = m_IpIndex.m_aNext[i])
 	{
+		if(i >= MaxClients())
+			continue;
+
 		if(m_aSlots[i].m_Connection.State() == NET_CONNSTATE_OFFLINE ||
 			(m_aSlots[i].m_Connection.State() == NET_CONNSTATE_ERROR &&
 				(!m_aSlots[i].m_Connection.m_TimeoutProtected ||
@@ -168,10 +233,11 @@ bool CNetServer::Connlimit(NETADDR Addr)
 {
 	int64_t Now = time_get();
 	int Oldest = 0;
+	const unsigned Hash = AddrHash(Addr, true);
 
 	for(int i = 0; i < NET_CONNLIMIT_IPS; ++i)
 	{
-		if(!net_addr_comp(&m_aSpamConns[i].m_Addr, &Addr))
+		if(m_aSpamConns[i].m_AddrHash == Hash && !net_addr_comp(&m_aSpamConns[i].m_Addr, &Addr))
 		{
 			if(m_aSpamConns[i].m_Time > Now - time_freq() * g_Config.m_SvConnlimitTime)
 			{
@@ -192,6 +258,7 @@ bool CNetServer::Connlimit(NETADDR Addr)
 	}
 
 	m_aSpamConns[Oldest].m_Addr = Addr;
+	m_aSpamConns[Oldest].m_AddrHash = Hash;
 	m_aSpamConns[Oldest].m_Time = Now;
 	m_aSpamConns[Oldest].m_Conns = 1;
 	return false;
@@ -242,6 +309,7 @@ int CNetServer::TryAcceptClient(NETADDR &Addr, SECURITY_TOKEN SecurityToken, boo
 
 	// init connection slot
 	m_aSlots[Slot].m_Connection.DirectInit(Addr, SecurityToken, Token, Sixup);
+	IndexSlot(Slot);
 
 	if(VanillaAuth)
 	{
@@ -575,16 +643,31 @@ int CNetServer::GetClientSlot(const NETADDR &Addr)
 {
 	int Slot = -1;
 
+	for(int i = m_AddrIndex.m_aBuckets[AddrHash(Addr, true) & (NUM_ADDR_BUCKETS - 1)]; i != -1; i = m_AddrIndex.m_aNext[i])
+	{
+		if(i < MaxClients() &&
+			m_aSlots[i].m_Connection.State() != NET_CONNSTATE_OFFLINE &&
+			m_aSlots[i].m_Connection.State() != NET_CONNSTATE_ERROR &&
+			net_addr_comp(m_aSlots[i].m_Connection.PeerAddress(), &Addr) == 0)
+		{
+			// prefer the highest slot like the linear search did
+			Slot = maximum(Slot, i);
+		}
+	}
+
+#ifdef CONF_DEBUG
+	int LinearSlot = -1;
 	for(int i = 0; i < MaxClients(); i++)
 	{
 		if(m_aSlots[i].m_Connection.State() != NET_CONNSTATE_OFFLINE &&
 			m_aSlots[i].m_Connection.State() != NET_CONNSTATE_ERROR &&
 			net_addr_comp(m_aSlots[i].m_Connection.PeerAddress(), &Addr) == 0)
-
 		{
-			Slot = i;
+			LinearSlot = i;
 		}
 	}
+	dbg_assert(Slot == LinearSlot, "address index out of sync");
+#endif
 
 	return Slot;
 }
@@ -796,6 +879,8 @@ bool CNetServer::SetTimedOut(int ClientId, int OrigId)
 
 	m_aSlots[ClientId].m_Connection.SetTimedOut(ClientAddr(OrigId), m_aSlots[OrigId].m_Connection.SeqSequence(), m_aSlots[OrigId].m_Connection.AckSequence(), m_aSlots[OrigId].m_Connection.SecurityToken(), m_aSlots[OrigId].m_Connection.ResendBuffer(), m_aSlots[OrigId].m_Connection.m_Sixup);
 	m_aSlots[OrigId].m_Connection.Reset();
+	IndexSlot(ClientId);
+	IndexSlot(OrigId);
 	return true;
 }
 
@@ -12,4 +12,8 @@ void CSnapshotBuilder::Init7(const CSnapshot *pSnapshot)
 	m_NumItems = pSnapshot->m_NumItems;
 	mem_copy(m_aOffsets, pSnapshot->Offsets(), sizeof(int) * m_NumItems);
 	mem_copy(m_aData, pSnapshot->DataStart(), m_DataSize);
+
+	m_ItemIndex.Clear(CSnapshot::MAX_ITEMS);
+	for(int i = 0; i < m_NumItems; i++)
+		m_ItemIndex.Add(GetItem(i)->Key(), i);
 }
@@ -13,6 +13,15 @@
 #include <game/generated/protocol7.h>
 #include <game/generated/protocolglue.h>
 
+// both are part of the baseline of the respective architectures
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SNAPSHOT_DELTA_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SNAPSHOT_DELTA_NEON
+#include <arm_neon.h>
+#endif
+
 // CSnapshot
 
 const CSnapshotItem *CSnapshot::GetItem(int Index) const
@@ -57,7 +66,7 @@ int CSnapshot::GetExternalItemType(int InternalType) const
 
 int CSnapshot::GetItemIndex(int Key) const
 {
-	// TODO: OPT: this should not be a linear search. very bad
+	// linear search, use CSnapshotItemIndex for repeated lookups
 	for(int i = 0; i < m_NumItems; i++)
 	{
 		if(GetItem(i)->Key() == Key)
@@ -72,6 +81,11 @@ void CSnapshot::InvalidateItem(int Index)
 }
 
 const void *CSnapshot::FindItem(int Type, int Id) const
+{
+	return FindItem(Type, Id, nullptr);
+}
+
+const void *CSnapshot::FindItem(int Type, int Id, const CSnapshotItemIndex *pIndex) const
 {
 	int InternalType = Type;
 	if(Type >= OFFSET_UUID)
@@ -100,7 +114,8 @@ const void *CSnapshot::FindItem(int Type, int Id) const
 			return nullptr;
 		}
 	}
-	int Index = GetItemIndex((InternalType << 16) | Id);
+	const int Key = (InternalType << 16) | Id;
+	int Index = pIndex ? pIndex->Find(Key) : GetItemIndex(Key);
 	return Index < 0 ? nullptr : GetItem(Index)->Data();
 }
 
@@ -159,61 +174,56 @@ bool CSnapshot::IsValid(size_t ActualSize) const
 	return true;
 }
 
-// CSnapshotDelta
-
-enum
-{
-	HASHLIST_SIZE = 256,
-	HASHLIST_BUCKET_SIZE = 64,
-};
+// CSnapshotItemIndex
 
-struct CItemList
+void CSnapshotItemIndex::Clear(int MaxItems)
 {
-	int m_Num;
-	int m_aKeys[HASHLIST_BUCKET_SIZE];
-	int m_aIndex[HASHLIST_BUCKET_SIZE];
-};
+	int Bits = 4;
+	while((1 << Bits) < MIN_SLOTS || (1 << Bits) < 2 * MaxItems)
+		Bits++;
+	dbg_assert((1 << Bits) <= MAX_SLOTS, "Too many items for snapshot item index");
+	m_Mask = (1u << Bits) - 1;
+	m_Shift = 32 - Bits;
+	for(unsigned i = 0; i <= m_Mask; i++)
+		m_aIndices[i] = -1;
+}
 
-inline size_t CalcHashId(int Key)
+void CSnapshotItemIndex::Build(const CSnapshot *pSnapshot)
 {
-	// djb2 (http://www.cse.yorku.ca/~oz/hash.html)
-	unsigned Hash = 5381;
-	for(unsigned Shift = 0; Shift < sizeof(int); Shift++)
-		Hash = ((Hash << 5) + Hash) + ((Key >> (Shift * 8)) & 0xFF);
-	return Hash % HASHLIST_SIZE;
+	Clear(pSnapshot->NumItems());
+	for(int i = 0; i < pSnapshot->NumItems(); i++)
+		Add(pSnapshot->GetItem(i)->Key(), i);
 }
 
-static void GenerateHash(CItemList *pHashlist, const CSnapshot *pSnapshot)
+void CSnapshotItemIndex::Add(int Key, int Index)
 {
-	for(int i = 0; i < HASHLIST_SIZE; i++)
-		pHashlist[i].m_Num = 0;
-
-	for(int i = 0; i < pSnapshot->NumItems(); i++)
+	for(unsigned Slot = CSnapshotItemIndex::Slot(Key);; Slot = (Slot + 1) & m_Mask)
 	{
-		int Key = pSnapshot->GetItem(i)->Key();
-		size_t HashId = CalcHashId(Key);
-		if(pHashlist[HashId].m_Num < HASHLIST_BUCKET_SIZE)
+		if(m_aIndices[Slot] == -1)
 		{
-			pHashlist[HashId].m_aIndex[pHashlist[HashId].m_Num] = i;
-			pHashlist[HashId].m_aKeys[pHashlist[HashId].m_Num] = Key;
-			pHashlist[HashId].m_Num++;
+			m_aKeys[Slot] = Key;
+			m_aIndices[Slot] = Index;
+			return;
 		}
+		if(m_aKeys[Slot] == Key)
+			return;
 	}
 }
 
-static int GetItemIndexHashed(int Key, const CItemList *pHashlist)
+int CSnapshotItemIndex::Find(int Key) const
 {
-	size_t HashId = CalcHashId(Key);
-	for(int i = 0; i < pHashlist[HashId].m_Num; i++)
+	for(unsigned Slot = CSnapshotItemIndex::Slot(Key);; Slot = (Slot + 1) & m_Mask)
 	{
-		if(pHashlist[HashId].m_aKeys[i] == Key)
-			return pHashlist[HashId].m_aIndex[i];
+		if(m_aIndices[Slot] == -1)
+			return -1;
+		if(m_aKeys[Slot] == Key)
+			return m_aIndices[Slot];
 	}
-
-	return -1;
 }
 
-int CSnapshotDelta::DiffItem(const int *pPast, const int *pCurrent, int *pOut, int Size)
+// CSnapshotDelta
+
+int CSnapshotDelta::DiffItemScalar(const int *pPast, const int *pCurrent, int *pOut, int Size)
 {
 	int Needed = 0;
 	while(Size)
@@ -230,7 +240,7 @@ int CSnapshotDelta::DiffItem(const int *pPast, const int *pCurrent, int *pOut, i
 	return Needed;
 }
 
-void CSnapshotDelta::UndiffItem(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate)
+void CSnapshotDelta::UndiffItemScalar(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate)
 {
 	while(Size)
 	{
@@ -253,6 +263,80 @@ void CSnapshotDelta::UndiffItem(const int *pPast, const int *pDiff, int *pOut, i
 	}
 }
 
+int CSnapshotDelta::DiffItem(const int *pPast, const int *pCurrent, int *pOut, int Size)
+{
+	int Needed = 0;
+#if defined(SNAPSHOT_DELTA_SSE2)
+	__m128i NeededVec = _mm_setzero_si128();
+	for(; Size >= 4; Size -= 4, pPast += 4, pCurrent += 4, pOut += 4)
+	{
+		const __m128i Diff = _mm_sub_epi32(_mm_loadu_si128((const __m128i *)pCurrent), _mm_loadu_si128((const __m128i *)pPast));
+		_mm_storeu_si128((__m128i *)pOut, Diff);
+		NeededVec = _mm_or_si128(NeededVec, Diff);
+	}
+	NeededVec = _mm_or_si128(NeededVec, _mm_shuffle_epi32(NeededVec, _MM_SHUFFLE(1, 0, 3, 2)));
+	NeededVec = _mm_or_si128(NeededVec, _mm_shuffle_epi32(NeededVec, _MM_SHUFFLE(2, 3, 0, 1)));
+	Needed = _mm_cvtsi128_si32(NeededVec);
+#elif defined(SNAPSHOT_DELTA_NEON)
+	int32x4_t NeededVec = vdupq_n_s32(0);
+	for(; Size >= 4; Size -= 4, pPast += 4, pCurrent += 4, pOut += 4)
+	{
+		const int32x4_t Diff = vsubq_s32(vld1q_s32(pCurrent), vld1q_s32(pPast));
+		vst1q_s32(pOut, Diff);
+		NeededVec = vorrq_s32(NeededVec, Diff);
+	}
+	Needed = vgetq_lane_s32(NeededVec, 0) | vgetq_lane_s32(NeededVec, 1) | vgetq_lane_s32(NeededVec, 2) | vgetq_lane_s32(NeededVec, 3);
+#endif
+	return Needed | DiffItemScalar(pPast, pCurrent, pOut, Size);
+}
+
+void CSnapshotDelta::UndiffItem(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate)
+{
+	// the data rate counts the bits of the packed diffs without packing
+	// them: 1 bit for unchanged ints, otherwise 8 bits per byte, which is
+	// one more for every 6 + 7 * n bits of the diff, excluding the sign
+#if defined(SNAPSHOT_DELTA_SSE2)
+	__m128i Rate = _mm_setzero_si128();
+	for(; Size >= 4; Size -= 4, pPast += 4, pDiff += 4, pOut += 4)
+	{
+		const __m128i Diff = _mm_loadu_si128((const __m128i *)pDiff);
+		_mm_storeu_si128((__m128i *)pOut, _mm_add_epi32(_mm_loadu_si128((const __m128i *)pPast), Diff));
+
+		// the comparisons are -1 where true
+		const __m128i Abs = _mm_xor_si128(Diff, _mm_srai_epi32(Diff, 31));
+		__m128i Bytes = _mm_set1_epi32(1);
+		Bytes = _mm_sub_epi32(Bytes, _mm_cmpgt_epi32(Abs, _mm_set1_epi32((1 << 6) - 1)));
+		Bytes = _mm_sub_epi32(Bytes, _mm_cmpgt_epi32(Abs, _mm_set1_epi32((1 << 13) - 1)));
+		Bytes = _mm_sub_epi32(Bytes, _mm_cmpgt_epi32(Abs, _mm_set1_epi32((1 << 20) - 1)));
+		Bytes = _mm_sub_epi32(Bytes, _mm_cmpgt_epi32(Abs, _mm_set1_epi32((1 << 27) - 1)));
+		const __m128i Unchanged = _mm_and_si128(_mm_cmpeq_epi32(Diff, _mm_setzero_si128()), _mm_set1_epi32(7));
+		Rate = _mm_add_epi32(Rate, _mm_sub_epi32(_mm_slli_epi32(Bytes, 3), Unchanged));
+	}
+	Rate = _mm_add_epi32(Rate, _mm_shuffle_epi32(Rate, _MM_SHUFFLE(1, 0, 3, 2)));
+	Rate = _mm_add_epi32(Rate, _mm_shuffle_epi32(Rate, _MM_SHUFFLE(2, 3, 0, 1)));
+	*pDataRate += _mm_cvtsi128_si32(Rate);
+#elif defined(SNAPSHOT_DELTA_NEON)
+	int32x4_t Rate = vdupq_n_s32(0);
+	for(; Size >= 4; Size -= 4, pPast += 4, pDiff += 4, pOut += 4)
+	{
+		const int32x4_t Diff = vld1q_s32(pDiff);
+		vst1q_s32(pOut, vaddq_s32(vld1q_s32(pPast), Diff));
+
+		// the comparisons are -1 where true
+		const int32x4_t Abs = veorq_s32(Diff, vshrq_n_s32(Diff, 31));
+		int32x4_t Bytes = vdupq_n_s32(1);
+		Bytes = vsubq_s32(Bytes, vreinterpretq_s32_u32(vcgtq_s32(Abs, vdupq_n_s32((1 << 6) - 1))));
+		Bytes = vsubq_s32(Bytes, vreinterpretq_s32_u32(vcgtq_s32(Abs, vdupq_n_s32((1 << 13) - 1))));
+		Bytes = vsubq_s32(Bytes, vreinterpretq_s32_u32(vcgtq_s32(Abs, vdupq_n_s32((1 << 20) - 1))));
+		Bytes = vsubq_s32(Bytes, vreinterpretq_s32_u32(vcgtq_s32(Abs, vdupq_n_s32((1 << 27) - 1))));
+		const int32x4_t Unchanged = vandq_s32(vreinterpretq_s32_u32(vceqq_s32(Diff, vdupq_n_s32(0))), vdupq_n_s32(7));
+		Rate = vaddq_s32(Rate, vsubq_s32(vshlq_n_s32(Bytes, 3), Unchanged));
+	}
+	*pDataRate += vgetq_lane_s32(Rate, 0) + vgetq_lane_s32(Rate, 1) + vgetq_lane_s32(Rate, 2) + vgetq_lane_s32(Rate, 3);
+#endif
+	UndiffItemScalar(pPast, pDiff, pOut, Size, pDataRate);
+}
+
 CSnapshotDelta::CSnapshotDelta()
 {
 	mem_zero(m_aItemSizes, sizeof(m_aItemSizes));
@@ -290,7 +374,6 @@ const CSnapshotDelta::CData *CSnapshotDelta::EmptyDelta() const
 	return &m_Empty;
 }
 
-// TODO: OPT: this should be made much faster
 int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, const CSnapshot *pTo, void *pDstData)
 {
 	CData *pDelta = (CData *)pDstData;
@@ -300,14 +383,14 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, const CSnapshot *pTo, vo
 	pDelta->m_NumUpdateItems = 0;
 	pDelta->m_NumTempItems = 0;
 
-	CItemList aHashlist[HASHLIST_SIZE];
-	GenerateHash(aHashlist, pTo);
+	CSnapshotItemIndex ItemIndex;
+	ItemIndex.Build(pTo);
 
 	// pack deleted stuff
 	for(int i = 0; i < pFrom->NumItems(); i++)
 	{
 		const CSnapshotItem *pFromItem = pFrom->GetItem(i);
-		if(GetItemIndexHashed(pFromItem->Key(), aHashlist) == -1)
+		if(ItemIndex.Find(pFromItem->Key()) == -1)
 		{
 			// deleted
 			pDelta->m_NumDeletedItems++;
@@ -316,7 +399,7 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, const CSnapshot *pTo, vo
 		}
 	}
 
-	GenerateHash(aHashlist, pFrom);
+	ItemIndex.Build(pFrom);
 
 	// fetch previous indices
 	// we do this as a separate pass because it helps the cache
@@ -324,17 +407,17 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, const CSnapshot *pTo, vo
 	const int NumItems = pTo->NumItems();
 	for(int i = 0; i < NumItems; i++)
 	{
-		const CSnapshotItem *pCurItem = pTo->GetItem(i); // O(1) .. O(n)
-		aPastIndices[i] = GetItemIndexHashed(pCurItem->Key(), aHashlist); // O(n) .. O(n^n)
+		const CSnapshotItem *pCurItem = pTo->GetItem(i);
+		aPastIndices[i] = ItemIndex.Find(pCurItem->Key());
 	}
 
 	for(int i = 0; i < NumItems; i++)
 	{
 		// do delta
-		const int ItemSize = pTo->GetItemSize(i); // O(1) .. O(n)
-		const CSnapshotItem *pCurItem = pTo->GetItem(i); // O(1) .. O(n)
+		const int ItemSize = pTo->GetItemSize(i);
+		const CSnapshotItem *pCurItem = pTo->GetItem(i);
 		const int PastIndex = aPastIndices[i];
-		const bool IncludeSize = pCurItem->Type() >= MAX_NETOBJSIZES || !m_aItemSizes[pCurItem->Type()];
+		const bool IncludeSize = IncludesSize(pCurItem->Type());
 
 		if(PastIndex != -1)
 		{
@@ -523,20 +606,24 @@ int CSnapshotDelta::UnpackDelta(const CSnapshot *pFrom, CSnapshot *pTo, const vo
 	if(pData > pEnd)
 		return -101;
 
+	CSnapshotItemIndex FromIndex;
+	FromIndex.Build(pFrom);
+
+	// mark deleted keys at the index of the first item with that key
+	bool aDeleted[CSnapshot::MAX_ITEMS] = {false};
+	for(int d = 0; d < pDelta->m_NumDeletedItems; d++)
+	{
+		const int Index = FromIndex.Find(pDeleted[d]);
+		if(Index != -1)
+			aDeleted[Index] = true;
+	}
+
 	// copy all non deleted stuff
 	for(int i = 0; i < pFrom->NumItems(); i++)
 	{
 		const CSnapshotItem *pFromItem = pFrom->GetItem(i);
 		const int ItemSize = pFrom->GetItemSize(i);
-		bool Keep = true;
-		for(int d = 0; d < pDelta->m_NumDeletedItems; d++)
-		{
-			if(pDeleted[d] == pFromItem->Key())
-			{
-				Keep = false;
-				break;
-			}
-		}
+		const bool Keep = !aDeleted[FromIndex.Find(pFromItem->Key())];
 
 		if(Keep)
 		{
@@ -589,11 +676,11 @@ int CSnapshotDelta::UnpackDelta(const CSnapshot *pFrom, CSnapshot *pTo, const vo
 		if(!pNewData)
 			return -302;
 
-		const int FromIndex = pFrom->GetItemIndex(Key);
-		if(FromIndex != -1)
+		const int PastIndex = FromIndex.Find(Key);
+		if(PastIndex != -1)
 		{
 			// we got an update so we need to apply the diff
-			UndiffItem(pFrom->GetItem(FromIndex)->Data(), pData, pNewData, ItemSize / sizeof(int32_t), &m_aSnapshotDataRate[Type]);
+			UndiffItem(pFrom->GetItem(PastIndex)->Data(), pData, pNewData, ItemSize / sizeof(int32_t), &m_aSnapshotDataRate[Type]);
 		}
 		else // no previous, just copy the pData
 		{
@@ -615,19 +702,113 @@ void CSnapshotStorage::Init()
 {
 	m_pFirst = nullptr;
 	m_pLast = nullptr;
+	m_pFirstBlock = nullptr;
+	m_pLastBlock = nullptr;
+	m_pFreeBlocks = nullptr;
+	m_NumBlocks = 0;
+	m_NumFreeBlocks = 0;
+	m_NumAllocations = 0;
+	m_NumFrees = 0;
 }
 
-void CSnapshotStorage::PurgeAll()
+void *CSnapshotStorage::Allocate(size_t Size, CBlock **ppBlock)
 {
-	while(m_pFirst)
+	Size = (Size + alignof(CHolder) - 1) & ~(alignof(CHolder) - 1);
+	dbg_assert(Size <= (size_t)BLOCK_SIZE, "Snapshot holder too large");
+
+	if(!m_pLastBlock || m_pLastBlock->m_Used + Size > (size_t)BLOCK_SIZE)
 	{
-		CHolder *pNext = m_pFirst->m_pNext;
-		free(m_pFirst->m_pSnap);
-		free(m_pFirst->m_pAltSnap);
-		free(m_pFirst);
-		m_pFirst = pNext;
+		CBlock *pBlock;
+		if(m_pFreeBlocks)
+		{
+			pBlock = m_pFreeBlocks;
+			m_pFreeBlocks = pBlock->m_pNext;
+			m_NumFreeBlocks--;
+		}
+		else
+		{
+			pBlock = static_cast<CBlock *>(malloc(sizeof(CBlock) + BLOCK_SIZE));
+			m_NumBlocks++;
+			m_NumAllocations++;
+		}
+		pBlock->m_pNext = nullptr;
+		pBlock->m_Used = 0;
+		pBlock->m_NumHolders = 0;
+
+		if(m_pLastBlock)
+			m_pLastBlock->m_pNext = pBlock;
+		else
+			m_pFirstBlock = pBlock;
+		m_pLastBlock = pBlock;
 	}
+
+	CBlock *pBlock = m_pLastBlock;
+	void *pData = (char *)(pBlock + 1) + pBlock->m_Used;
+	pBlock->m_Used += Size;
+	pBlock->m_NumHolders++;
+	*ppBlock = pBlock;
+	return pData;
+}
+
+void CSnapshotStorage::Release(CBlock *pBlock)
+{
+	pBlock->m_NumHolders--;
+	if(pBlock->m_NumHolders > 0)
+		return;
+
+	if(pBlock == m_pLastBlock)
+	{
+		// keep filling the current block from the start
+		pBlock->m_Used = 0;
+		return;
+	}
+
+	// holders are purged in order, so this is usually the first block
+	CBlock **ppBlock = &m_pFirstBlock;
+	while(*ppBlock != pBlock)
+		ppBlock = &(*ppBlock)->m_pNext;
+	*ppBlock = pBlock->m_pNext;
+
+	// keep as many spare blocks as are in use, so that fluctuating
+	// snapshot sizes do not cause allocations
+	const int NumUsedBlocks = m_NumBlocks - m_NumFreeBlocks - 1;
+	if(m_NumFreeBlocks < maximum(NumUsedBlocks, 1))
+	{
+		pBlock->m_pNext = m_pFreeBlocks;
+		m_pFreeBlocks = pBlock;
+		m_NumFreeBlocks++;
+	}
+	else
+		FreeBlock(pBlock);
+}
+
+void CSnapshotStorage::FreeBlock(CBlock *pBlock)
+{
+	free(pBlock);
+	m_NumBlocks--;
+	m_NumFrees++;
+}
+
+void CSnapshotStorage::PurgeAll()
+{
+	m_pFirst = nullptr;
 	m_pLast = nullptr;
+
+	while(m_pFirstBlock)
+	{
+		CBlock *pNext = m_pFirstBlock->m_pNext;
+		FreeBlock(m_pFirstBlock);
+		m_pFirstBlock = pNext;
+	}
+	m_pLastBlock = nullptr;
+
+	while(m_pFreeBlocks)
+	{
+		CBlock *pNext = m_pFreeBlocks->m_pNext;
+		FreeBlock(m_pFreeBlocks);
+		m_pFreeBlocks = pNext;
+	}
+	m_NumFreeBlocks = 0;
 }
 
 void CSnapshotStorage::PurgeUntil(int Tick)
@@ -639,9 +820,7 @@ void CSnapshotStorage::PurgeUntil(int Tick)
 		CHolder *pNext = pHolder->m_pNext;
 		if(pHolder->m_Tick >= Tick)
 			return; // no more to remove
-		free(pHolder->m_pSnap);
-		free(pHolder->m_pAltSnap);
-		free(pHolder);
+		Release(pHolder->m_pBlock);
 
 		// did we come to the end of the list?
 		if(!pNext)
@@ -662,17 +841,25 @@ void CSnapshotStorage::Add(int Tick, int64_t Tagtime, size_t DataSize, const voi
 	dbg_assert(DataSize <= (size_t)CSnapshot::MAX_SIZE, "Snapshot data size invalid");
 	dbg_assert(AltDataSize <= (size_t)CSnapshot::MAX_SIZE, "Alt snapshot data size invalid");
 
-	CHolder *pHolder = static_cast<CHolder *>(malloc(sizeof(CHolder)));
+	// place holder and snapshots into one allocation
+	const size_t SnapOffset = (sizeof(CHolder) + alignof(CHolder) - 1) & ~(alignof(CHolder) - 1);
+	const size_t AltSnapOffset = SnapOffset + ((DataSize + alignof(CHolder) - 1) & ~(alignof(CHolder) - 1));
+	CBlock *pBlock;
+	char *pMemory = static_cast<char *>(Allocate(AltSnapOffset + AltDataSize, &pBlock));
+
+	CHolder *pHolder = reinterpret_cast<CHolder *>(pMemory);
+	pHolder->m_pBlock = pBlock;
 	pHolder->m_Tick = Tick;
 	pHolder->m_Tagtime = Tagtime;
 
-	pHolder->m_pSnap = static_cast<CSnapshot *>(malloc(DataSize));
+	pHolder->m_pSnap = reinterpret_cast<CSnapshot *>(pMemory + SnapOffset);
 	mem_copy(pHolder->m_pSnap, pData, DataSize);
 	pHolder->m_SnapSize = DataSize;
+	pHolder->m_Crc = pHolder->m_pSnap->Crc();
 
 	if(AltDataSize) // create alternative if wanted
 	{
-		pHolder->m_pAltSnap = static_cast<CSnapshot *>(malloc(AltDataSize));
+		pHolder->m_pAltSnap = reinterpret_cast<CSnapshot *>(pMemory + AltSnapOffset);
 		mem_copy(pHolder->m_pAltSnap, pAltData, AltDataSize);
 		pHolder->m_AltSnapSize = AltDataSize;
 	}
@@ -694,25 +881,27 @@ void CSnapshotStorage::Add(int Tick, int64_t Tagtime, size_t DataSize, const voi
 
 int CSnapshotStorage::Get(int Tick, int64_t *pTagtime, const CSnapshot **ppData, const CSnapshot **ppAltData) const
 {
-	CHolder *pHolder = m_pFirst;
+	const CHolder *pHolder = Find(Tick);
+	if(!pHolder)
+		return -1;
+
+	if(pTagtime)
+		*pTagtime = pHolder->m_Tagtime;
+	if(ppData)
+		*ppData = pHolder->m_pSnap;
+	if(ppAltData)
+		*ppAltData = pHolder->m_pAltSnap;
+	return pHolder->m_SnapSize;
+}
 
-	while(pHolder)
+const CSnapshotStorage::CHolder *CSnapshotStorage::Find(int Tick) const
+{
+	for(const CHolder *pHolder = m_pFirst; pHolder; pHolder = pHolder->m_pNext)
 	{
 		if(pHolder->m_Tick == Tick)
-		{
-			if(pTagtime)
-				*pTagtime = pHolder->m_Tagtime;
-			if(ppData)
-				*ppData = pHolder->m_pSnap;
-			if(ppAltData)
-				*ppAltData = pHolder->m_pAltSnap;
-			return pHolder->m_SnapSize;
-		}
-
-		pHolder = pHolder->m_pNext;
+			return pHolder;
 	}
-
-	return -1;
+	return nullptr;
 }
 
 // CSnapshotBuilder
@@ -726,6 +915,7 @@ void CSnapshotBuilder::Init(bool Sixup)
 	m_DataSize = 0;
 	m_NumItems = 0;
 	m_Sixup = Sixup;
+	m_ItemIndex.Clear(CSnapshot::MAX_ITEMS);
 
 	for(int i = 0; i < m_NumExtendedItemTypes; i++)
 	{
@@ -740,15 +930,10 @@ CSnapshotItem *CSnapshotBuilder::GetItem(int Index)
 
 int *CSnapshotBuilder::GetItemData(int Key)
 {
-	for(int i = 0; i < m_NumItems; i++)
-	{
-		CSnapshotItem *pItem = GetItem(i);
-		if(pItem->Key() == Key)
-		{
-			return pItem->Data();
-		}
-	}
-	return nullptr;
+	const int Index = m_ItemIndex.Find(Key);
+	if(Index == -1)
+		return nullptr;
+	return GetItem(Index)->Data();
 }
 
 int CSnapshotBuilder::Finish(void *pSnapData)
@@ -855,6 +1040,7 @@ void *CSnapshotBuilder::NewItem(int Type, int Id, int Size)
 		return nullptr;
 
 	pObj->m_TypeAndId = (Type << 16) | Id;
+	m_ItemIndex.Add(pObj->Key(), m_NumItems);
 	m_aOffsets[m_NumItems] = m_DataSize;
 	m_DataSize += ItemSize;
 	m_NumItems++;
@@ -60,6 +60,7 @@ public:
 	int GetItemType(int Index) const;
 	int GetExternalItemType(int InternalType) const;
 	const void *FindItem(int Type, int Id) const;
+	const void *FindItem(int Type, int Id, const class CSnapshotItemIndex *pIndex) const;
 
 	unsigned Crc() const;
 	void DebugDump() const;
@@ -68,6 +69,36 @@ public:
 	static const CSnapshot *EmptySnapshot() { return &ms_EmptySnapshot; }
 };
 
+// CSnapshotItemIndex
+
+// Open addressing table mapping item keys to item indices. Used instead of
+// the linear CSnapshot::GetItemIndex when many items of the same snapshot
+// are looked up.
+class CSnapshotItemIndex
+{
+	enum
+	{
+		MIN_SLOTS = 16,
+		MAX_SLOTS = 2 * CSnapshot::MAX_ITEMS, // keeps the load factor at or below 0.5
+	};
+
+	int m_aKeys[MAX_SLOTS];
+	short m_aIndices[MAX_SLOTS]; // -1 for free slots
+	unsigned m_Mask;
+	int m_Shift;
+
+	unsigned Slot(int Key) const { return ((unsigned)Key * 2654435761u) >> m_Shift; }
+
+public:
+	CSnapshotItemIndex() { Clear(0); }
+
+	void Clear(int MaxItems);
+	void Build(const CSnapshot *pSnapshot);
+	// keeps the first index if the key is added multiple times, like GetItemIndex
+	void Add(int Key, int Index);
+	int Find(int Key) const;
+};
+
 // CSnapshotDelta
 
 class CSnapshotDelta
@@ -93,16 +124,20 @@ private:
 	int m_aSnapshotDataUpdates[CSnapshot::MAX_TYPE + 1];
 	CData m_Empty;
 
-	static void UndiffItem(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate);
-
 public:
+	// use SSE2 or NEON where available, with the same results as the scalar versions
 	static int DiffItem(const int *pPast, const int *pCurrent, int *pOut, int Size);
+	static void UndiffItem(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate);
+	static int DiffItemScalar(const int *pPast, const int *pCurrent, int *pOut, int Size);
+	static void UndiffItemScalar(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate);
 	CSnapshotDelta();
 	CSnapshotDelta(const CSnapshotDelta &Old);
 	int GetDataRate(int Index) const { return m_aSnapshotDataRate[Index]; }
 	int GetDataUpdates(int Index) const { return m_aSnapshotDataUpdates[Index]; }
 	void SetStaticsize(int ItemType, size_t Size);
 	void SetStaticsize7(int ItemType, size_t Size);
+	// whether the size of changed items of the type is part of the delta
+	bool IncludesSize(int ItemType) const { return ItemType >= MAX_NETOBJSIZES || !m_aItemSizes[ItemType]; }
 	const CData *EmptyDelta() const;
 	int CreateDelta(const CSnapshot *pFrom, const CSnapshot *pTo, void *pDstData);
 	int UnpackDelta(const CSnapshot *pFrom, CSnapshot *pTo, const void *pSrcData, int DataSize, bool Sixup);
@@ -113,6 +148,35 @@ public:
 
 class CSnapshotStorage
 {
+	// Snapshots are always purged in the order they were added, so the
+	// holders are placed one after another into fixed size blocks. A block
+	// is recycled as soon as all of its holders are purged, which avoids
+	// heap allocations once enough blocks for the retention window exist.
+	class CBlock
+	{
+	public:
+		CBlock *m_pNext;
+		size_t m_Used;
+		int m_NumHolders;
+	};
+
+	enum
+	{
+		BLOCK_SIZE = 2 * CSnapshot::MAX_SIZE + 1024, // fits a holder with two maximum size snapshots
+	};
+
+	CBlock *m_pFirstBlock;
+	CBlock *m_pLastBlock;
+	CBlock *m_pFreeBlocks;
+	int m_NumBlocks;
+	int m_NumFreeBlocks;
+	int64_t m_NumAllocations;
+	int64_t m_NumFrees;
+
+	void *Allocate(size_t Size, CBlock **ppBlock);
+	void Release(CBlock *pBlock);
+	void FreeBlock(CBlock *pBlock);
+
 public:
 	class CHolder
 	{
@@ -125,9 +189,13 @@ public:
 
 		int m_SnapSize;
 		int m_AltSnapSize;
+		// computed once when the snapshot is added
+		unsigned m_Crc;
 
 		CSnapshot *m_pSnap;
 		CSnapshot *m_pAltSnap;
+
+		CBlock *m_pBlock;
 	};
 
 	CHolder *m_pFirst;
@@ -140,6 +208,13 @@ public:
 	void PurgeUntil(int Tick);
 	void Add(int Tick, int64_t Tagtime, size_t DataSize, const void *pData, size_t AltDataSize, const void *pAltData);
 	int Get(int Tick, int64_t *pTagtime, const CSnapshot **ppData, const CSnapshot **ppAltData) const;
+	const CHolder *Find(int Tick) const;
+
+	// number of blocks currently owned, including recycled ones
+	int NumBlocks() const { return m_NumBlocks; }
+	// number of heap allocations and frees of blocks since construction
+	int64_t NumAllocations() const { return m_NumAllocations; }
+	int64_t NumFrees() const { return m_NumFrees; }
 };
 
 class CSnapshotBuilder
@@ -164,6 +239,8 @@ class CSnapshotBuilder
 
 	bool m_Sixup = false;
 
+	CSnapshotItemIndex m_ItemIndex;
+
 public:
 	CSnapshotBuilder();
 
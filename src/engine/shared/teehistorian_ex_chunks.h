@@ -21,3 +21,4 @@ UUID(TEEHISTORIAN_ANTIBOT, "teehistorian-antibot@ddnet.org")
 UUID(TEEHISTORIAN_PLAYER_NAME, "teehistorian-player-name@ddnet.org")
 UUID(TEEHISTORIAN_PLAYER_FINISH, "teehistorian-player-finish@ddnet.org")
 UUID(TEEHISTORIAN_TEAM_FINISH, "teehistorian-team-finish@ddnet.org")
+UUID(TEEHISTORIAN_PLAYER_DIRECT_INPUT, "teehistorian-player-direct-input@ddnet.org")
@@ -0,0 +1,841 @@
+#include "teehistorian_reader.h"
+
+#include <base/hash.h>
+#include <engine/external/json-parser/json.h>
+#include <engine/shared/json.h>
+#include <engine/shared/snapshot.h>
+#include <engine/storage.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+
+static const CUuid TEEHISTORIAN_UUID = CalculateUuid("teehistorian@ddnet.tw");
+
+// chunk types as they're stored, see `CTeeHistorian`
+enum
+{
+	TEEHISTORIAN_NONE,
+	TEEHISTORIAN_FINISH,
+	TEEHISTORIAN_TICK_SKIP,
+	TEEHISTORIAN_PLAYER_NEW,
+	TEEHISTORIAN_PLAYER_OLD,
+	TEEHISTORIAN_INPUT_DIFF,
+	TEEHISTORIAN_INPUT_NEW,
+	TEEHISTORIAN_MESSAGE,
+	TEEHISTORIAN_JOIN,
+	TEEHISTORIAN_DROP,
+	TEEHISTORIAN_CONSOLE_COMMAND,
+	TEEHISTORIAN_EX,
+};
+
+static const int INPUT_SIZE = sizeof(CNetObj_PlayerInput) / sizeof(int32_t);
+
+// the decompressed data is read in parts of this size, the server doesn't
+// write chunks that come close to the maximum size, messages and console
+// commands are limited by the network and the console
+static const int BUFFER_SIZE = 256 * 1024;
+static const int MAX_CHUNK_SIZE = 64 * 1024;
+static const int INPUT_BUFFER_SIZE = 64 * 1024;
+
+// sidecar index files, see `CTeeHistorianReader::SaveIndex`
+static const int INDEX_MAGIC = 0x58494854; // "THIX"
+static const int INDEX_VERSION = 2;
+static const int INDEX_MASK_INTS = (MAX_CLIENTS + 31) / 32;
+
+CTeeHistorianReader::CTeeHistorianReader() :
+	m_File(nullptr),
+	m_pSource(nullptr),
+	m_SourceSize(0),
+	m_SourcePos(0),
+	m_Compressed(false),
+	m_pZStream(nullptr),
+	m_InputOffset(0),
+	m_RecordRestartPoints(false),
+	m_DataOffset(0),
+	m_EndOfData(true),
+	m_pHeader(nullptr),
+	m_HeaderSize(0),
+	m_HeaderSha256(SHA256_ZEROED),
+	m_Finished(true),
+	m_Error(false),
+	m_ChunkOffset(0),
+	m_NextCheckpointTick(-1),
+	m_CheckpointInterval(0),
+	m_SeekTick(-1),
+	m_SeekFound(false)
+{
+	m_aError[0] = '\0';
+}
+
+CTeeHistorianReader::~CTeeHistorianReader()
+{
+	Close();
+}
+
+bool CTeeHistorianReader::Fail(const char *pError)
+{
+	m_Error = true;
+	str_copy(m_aError, pError);
+	return false;
+}
+
+void CTeeHistorianReader::Close()
+{
+	if(m_File)
+	{
+		io_close(m_File);
+		m_File = nullptr;
+	}
+	m_pSource = nullptr;
+	m_SourceSize = 0;
+	if(m_pZStream)
+	{
+		inflateEnd(m_pZStream);
+		delete m_pZStream;
+		m_pZStream = nullptr;
+	}
+	if(m_pHeader)
+	{
+		json_value_free(m_pHeader);
+		m_pHeader = nullptr;
+	}
+	m_HeaderSize = 0;
+	m_vCheckpoints.clear();
+	m_vRestartPoints.clear();
+}
+
+bool CTeeHistorianReader::Open(IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	Close();
+	m_File = pStorage->OpenFile(pFilename, IOFLAG_READ, StorageType);
+	if(!m_File)
+		return Fail("failed to open the file");
+	m_SourceSize = io_length(m_File);
+	if(m_SourceSize < 0)
+		return Fail("failed to read the file");
+	return Start();
+}
+
+bool CTeeHistorianReader::Load(const void *pData, int64_t DataSize)
+{
+	Close();
+	m_pSource = (const unsigned char *)pData;
+	m_SourceSize = DataSize;
+	return Start();
+}
+
+bool CTeeHistorianReader::Start()
+{
+	m_Finished = false;
+	m_Error = false;
+	m_aError[0] = '\0';
+	ResetState();
+
+	unsigned char aMagic[2] = {0, 0};
+	if(!SeekSource(0))
+		return Fail("failed to read the file");
+	m_Compressed = ReadSource(aMagic, sizeof(aMagic)) == sizeof(aMagic) && aMagic[0] == 0x1f && aMagic[1] == 0x8b;
+	m_vRestartPoints.push_back({0, 0});
+	return RestartData(0) && ParseHeader();
+}
+
+unsigned CTeeHistorianReader::ReadSource(void *pData, unsigned Size)
+{
+	if(m_File)
+		return io_read(m_File, pData, Size);
+	const unsigned Read = std::min<int64_t>(Size, m_SourceSize - m_SourcePos);
+	mem_copy(pData, m_pSource + m_SourcePos, Read);
+	m_SourcePos += Read;
+	return Read;
+}
+
+bool CTeeHistorianReader::SeekSource(int64_t Offset)
+{
+	if(Offset < 0 || Offset > m_SourceSize)
+		return false;
+	if(m_File)
+		return io_seek(m_File, Offset, IOSEEK_START) == 0;
+	m_SourcePos = Offset;
+	return true;
+}
+
+bool CTeeHistorianReader::Inflate(size_t Size)
+{
+	if(m_pZStream->avail_in == 0)
+	{
+		m_InputOffset += m_vInput.size();
+		m_vInput.resize(INPUT_BUFFER_SIZE);
+		m_vInput.resize(ReadSource(m_vInput.data(), m_vInput.size()));
+		m_pZStream->next_in = m_vInput.data();
+		m_pZStream->avail_in = m_vInput.size();
+	}
+
+	const size_t OldSize = m_vData.size();
+	m_vData.resize(Size);
+	m_pZStream->next_out = m_vData.data() + OldSize;
+	m_pZStream->avail_out = Size - OldSize;
+	// stops at the end of every deflate block so the flush points can be
+	// found
+	const int Result = inflate(m_pZStream, Z_BLOCK);
+	m_vData.resize(Size - m_pZStream->avail_out);
+	// files that weren't closed end without the end of the gzip stream,
+	// the data up to the last flush point is complete
+	if(Result == Z_STREAM_END || (Result == Z_BUF_ERROR && m_vInput.empty()))
+	{
+		m_EndOfData = true;
+		return true;
+	}
+	if(Result != Z_OK && Result != Z_BUF_ERROR)
+		return Fail("invalid compressed data");
+
+	// `CAsyncFileWriter`'s flush points are full flushes, which end in an
+	// empty stored block and don't refer to the data before
+	const int Consumed = m_pZStream->next_in - m_vInput.data();
+	const int DataType = m_pZStream->data_type;
+	if(m_RecordRestartPoints && (DataType & 128) && !(DataType & 64) && (DataType & 7) == 0 &&
+		Consumed >= 4 && mem_comp(m_pZStream->next_in - 4, "\x00\x00\xff\xff", 4) == 0)
+	{
+		const CRestartPoint Point = {m_InputOffset + Consumed, m_DataOffset + (int64_t)m_vData.size()};
+		if(Point.m_Out > m_vRestartPoints.back().m_Out)
+			m_vRestartPoints.push_back(Point);
+	}
+	return true;
+}
+
+bool CTeeHistorianReader::Fill(size_t Size)
+{
+	const size_t Consumed = m_vData.size() - m_Unpacker.RemainingSize();
+	m_vData.erase(m_vData.begin(), m_vData.begin() + Consumed);
+	m_DataOffset += Consumed;
+
+	bool Result = true;
+	while(Result && m_vData.size() < Size && !m_EndOfData)
+	{
+		if(m_Compressed)
+		{
+			Result = Inflate(Size);
+		}
+		else
+		{
+			const size_t OldSize = m_vData.size();
+			m_vData.resize(Size);
+			const unsigned Read = ReadSource(m_vData.data() + OldSize, Size - OldSize);
+			m_vData.resize(OldSize + Read);
+			m_EndOfData = Read == 0;
+		}
+	}
+	m_Unpacker.Reset(m_vData.data(), m_vData.size());
+	return Result;
+}
+
+bool CTeeHistorianReader::RestartData(int64_t Offset)
+{
+	// the last point before the offset the decompression can start at
+	CRestartPoint Restart = {Offset, Offset};
+	if(m_Compressed)
+	{
+		Restart = *(std::upper_bound(m_vRestartPoints.begin(), m_vRestartPoints.end(), Offset, [](int64_t Value, const CRestartPoint &Point) {
+			return Value < Point.m_Out;
+		}) - 1);
+		if(m_pZStream)
+			inflateEnd(m_pZStream);
+		else
+			m_pZStream = new z_stream;
+		mem_zero(m_pZStream, sizeof(*m_pZStream));
+		// 16 added to the window bits only accepts the gzip format, the
+		// data after a flush point is raw deflate data
+		if(inflateInit2(m_pZStream, Restart.m_In == 0 ? MAX_WBITS + 16 : -MAX_WBITS) != Z_OK)
+			return Fail("failed to initialize the decompression");
+	}
+	if(!SeekSource(Restart.m_In))
+		return Fail("failed to seek in the file");
+	m_InputOffset = Restart.m_In;
+	m_vInput.clear();
+	m_DataOffset = Restart.m_Out;
+	m_vData.clear();
+	m_EndOfData = false;
+	m_Unpacker.Reset(m_vData.data(), 0);
+
+	while(Offset - m_DataOffset > (int64_t)m_vData.size())
+	{
+		if(m_EndOfData)
+			return Fail("offset after the end of the data");
+		// drop everything before the offset
+		m_Unpacker.Reset(m_vData.data() + m_vData.size(), 0);
+		if(!Fill(BUFFER_SIZE))
+			return false;
+	}
+	m_Unpacker.Reset(m_vData.data() + (Offset - m_DataOffset), m_vData.size() - (Offset - m_DataOffset));
+	return true;
+}
+
+bool CTeeHistorianReader::SeekData(int64_t Offset)
+{
+	// still in the window, e.g. right after seeking to a tick
+	if(Offset >= m_DataOffset && Offset - m_DataOffset <= (int64_t)m_vData.size())
+	{
+		m_Unpacker.Reset(m_vData.data() + (Offset - m_DataOffset), m_vData.size() - (Offset - m_DataOffset));
+		return true;
+	}
+	return RestartData(Offset);
+}
+
+bool CTeeHistorianReader::ParseHeader()
+{
+	size_t Size = BUFFER_SIZE;
+	while(true)
+	{
+		if(!Fill(Size))
+			return false;
+		if(m_vData.size() < sizeof(CUuid) || mem_comp(m_vData.data(), &TEEHISTORIAN_UUID, sizeof(CUuid)) != 0)
+			return Fail("not a teehistorian file");
+		if(std::find(m_vData.begin() + sizeof(CUuid), m_vData.end(), '\0') != m_vData.end())
+			break;
+		if(m_EndOfData)
+			return Fail("header not terminated");
+		// a header that doesn't fit into the buffer
+		Size *= 2;
+	}
+
+	const char *pJson = (const char *)m_vData.data() + sizeof(CUuid);
+	const int JsonLength = str_length(pJson);
+	m_pHeader = json_parse(pJson, JsonLength);
+	if(!m_pHeader || m_pHeader->type != json_object)
+		return Fail("invalid header");
+
+	m_HeaderSize = sizeof(CUuid) + JsonLength + 1;
+	m_HeaderSha256 = sha256(m_vData.data(), m_HeaderSize);
+	m_Unpacker.Reset(m_vData.data() + m_HeaderSize, m_vData.size() - m_HeaderSize);
+	return true;
+}
+
+void CTeeHistorianReader::ResetState()
+{
+	m_State.m_Tick = 0;
+	m_State.m_MaxClientId = MAX_CLIENTS;
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		m_State.m_aPlayerAlive[i] = false;
+		m_State.m_aPlayerX[i] = 0;
+		m_State.m_aPlayerY[i] = 0;
+		m_State.m_aHaveInput[i] = false;
+		mem_zero(&m_State.m_aInputs[i], sizeof(m_State.m_aInputs[i]));
+	}
+}
+
+const char *CTeeHistorianReader::HeaderString(const char *pName) const
+{
+	if(!m_pHeader)
+		return "";
+	const json_value *pValue = json_object_get(m_pHeader, pName);
+	if(pValue->type != json_string)
+		return "";
+	return json_string_get(pValue);
+}
+
+bool CTeeHistorianReader::CheckClientId(int ClientId)
+{
+	if(m_Unpacker.Error())
+		return Fail("truncated chunk");
+	if(ClientId < 0 || ClientId >= MAX_CLIENTS)
+		return Fail("invalid client id");
+	return true;
+}
+
+void CTeeHistorianReader::PlayerData(int ClientId)
+{
+	// the player data of a tick is ordered by client id, the tick is only
+	// written explicitly if this can't tell it apart from the next one
+	if(ClientId <= m_State.m_MaxClientId)
+	{
+		TickStart(m_State.m_Tick + 1);
+		m_State.m_Tick++;
+	}
+	m_State.m_MaxClientId = ClientId;
+}
+
+void CTeeHistorianReader::TickStart(int NewTick)
+{
+	if(m_NextCheckpointTick >= 0 && NewTick >= m_NextCheckpointTick)
+	{
+		m_vCheckpoints.emplace_back();
+		CaptureCheckpoint(&m_vCheckpoints.back(), NewTick);
+		m_NextCheckpointTick = NewTick + m_CheckpointInterval;
+	}
+	if(m_SeekTick >= 0 && !m_SeekFound && NewTick >= m_SeekTick)
+	{
+		CaptureCheckpoint(&m_SeekCheckpoint, NewTick);
+		m_SeekFound = true;
+	}
+}
+
+void CTeeHistorianReader::CaptureCheckpoint(CCheckpoint *pCheckpoint, int NewTick) const
+{
+	pCheckpoint->m_Tick = NewTick;
+	pCheckpoint->m_Offset = m_ChunkOffset;
+	pCheckpoint->m_State = m_State;
+	pCheckpoint->m_Active.reset();
+	for(int i = 0; i < MAX_CLIENTS; i++)
+		pCheckpoint->m_Active[i] = m_State.m_aPlayerAlive[i];
+}
+
+bool CTeeHistorianReader::RestoreCheckpoint(const CCheckpoint &Checkpoint)
+{
+	m_State = Checkpoint.m_State;
+	m_Finished = false;
+	m_Error = false;
+	m_aError[0] = '\0';
+	return SeekData(Checkpoint.m_Offset);
+}
+
+bool CTeeHistorianReader::NextChunk(CChunk *pChunk)
+{
+	if(m_Finished || m_Error)
+		return false;
+	if(m_Unpacker.RemainingSize() < MAX_CHUNK_SIZE && !m_EndOfData && !Fill(BUFFER_SIZE))
+		return false;
+	if(m_Unpacker.RemainingSize() == 0)
+	{
+		// the server didn't shut down cleanly, treat it like the end
+		m_Finished = true;
+		return false;
+	}
+
+	pChunk->m_ClientId = -1;
+	m_ChunkOffset = m_DataOffset + (int64_t)(m_vData.size() - m_Unpacker.RemainingSize());
+
+	const int Type = m_Unpacker.GetInt();
+	if(Type >= 0)
+	{
+		// player position difference, the type is the client id
+		const int ClientId = Type;
+		const int Dx = m_Unpacker.GetInt();
+		const int Dy = m_Unpacker.GetInt();
+		if(!CheckClientId(ClientId))
+			return false;
+		if(!m_State.m_aPlayerAlive[ClientId])
+			return Fail("position difference of a player without position");
+		PlayerData(ClientId);
+		m_State.m_aPlayerX[ClientId] += Dx;
+		m_State.m_aPlayerY[ClientId] += Dy;
+		pChunk->m_Type = CHUNK_PLAYER_DIFF;
+		pChunk->m_ClientId = ClientId;
+		pChunk->m_X = m_State.m_aPlayerX[ClientId];
+		pChunk->m_Y = m_State.m_aPlayerY[ClientId];
+	}
+	else
+	{
+		switch(-Type)
+		{
+		case TEEHISTORIAN_FINISH:
+			pChunk->m_Type = CHUNK_FINISH;
+			m_Finished = true;
+			break;
+		case TEEHISTORIAN_TICK_SKIP:
+			pChunk->m_Type = CHUNK_TICK_SKIP;
+			pChunk->m_Dt = m_Unpacker.GetInt();
+			if(pChunk->m_Dt < 0)
+				return Fail("invalid tick skip");
+			TickStart(m_State.m_Tick + pChunk->m_Dt + 1);
+			m_State.m_Tick += pChunk->m_Dt + 1;
+			m_State.m_MaxClientId = -1;
+			break;
+		case TEEHISTORIAN_PLAYER_NEW:
+		{
+			const int ClientId = m_Unpacker.GetInt();
+			const int X = m_Unpacker.GetInt();
+			const int Y = m_Unpacker.GetInt();
+			if(!CheckClientId(ClientId))
+				return false;
+			PlayerData(ClientId);
+			m_State.m_aPlayerAlive[ClientId] = true;
+			m_State.m_aPlayerX[ClientId] = X;
+			m_State.m_aPlayerY[ClientId] = Y;
+			pChunk->m_Type = CHUNK_PLAYER_NEW;
+			pChunk->m_ClientId = ClientId;
+			pChunk->m_X = X;
+			pChunk->m_Y = Y;
+			break;
+		}
+		case TEEHISTORIAN_PLAYER_OLD:
+		{
+			const int ClientId = m_Unpacker.GetInt();
+			if(!CheckClientId(ClientId))
+				return false;
+			PlayerData(ClientId);
+			m_State.m_aPlayerAlive[ClientId] = false;
+			pChunk->m_Type = CHUNK_PLAYER_OLD;
+			pChunk->m_ClientId = ClientId;
+			break;
+		}
+		case TEEHISTORIAN_INPUT_NEW:
+		case TEEHISTORIAN_INPUT_DIFF:
+		{
+			const int ClientId = m_Unpacker.GetInt();
+			int aData[INPUT_SIZE];
+			for(int &Data : aData)
+				Data = m_Unpacker.GetInt();
+			if(!CheckClientId(ClientId))
+				return false;
+			if(-Type == TEEHISTORIAN_INPUT_DIFF)
+			{
+				if(!m_State.m_aHaveInput[ClientId])
+					return Fail("input difference of a player without input");
+				int DataRate = 0;
+				CSnapshotDelta::UndiffItem((const int *)&m_State.m_aInputs[ClientId], aData, (int *)&m_State.m_aInputs[ClientId], INPUT_SIZE, &DataRate);
+				pChunk->m_Type = CHUNK_INPUT_DIFF;
+			}
+			else
+			{
+				mem_copy(&m_State.m_aInputs[ClientId], aData, sizeof(aData));
+				pChunk->m_Type = CHUNK_INPUT_NEW;
+			}
+			m_State.m_aHaveInput[ClientId] = true;
+			pChunk->m_ClientId = ClientId;
+			pChunk->m_Input = m_State.m_aInputs[ClientId];
+			break;
+		}
+		case TEEHISTORIAN_MESSAGE:
+			pChunk->m_Type = CHUNK_MESSAGE;
+			pChunk->m_ClientId = m_Unpacker.GetInt();
+			pChunk->m_DataSize = m_Unpacker.GetInt();
+			pChunk->m_pData = m_Unpacker.GetRaw(pChunk->m_DataSize);
+			if(!CheckClientId(pChunk->m_ClientId))
+				return false;
+			break;
+		case TEEHISTORIAN_JOIN:
+			pChunk->m_Type = CHUNK_JOIN;
+			pChunk->m_ClientId = m_Unpacker.GetInt();
+			if(!CheckClientId(pChunk->m_ClientId))
+				return false;
+			break;
+		case TEEHISTORIAN_DROP:
+			pChunk->m_Type = CHUNK_DROP;
+			pChunk->m_ClientId = m_Unpacker.GetInt();
+			pChunk->m_pString = m_Unpacker.GetString(0);
+			if(!CheckClientId(pChunk->m_ClientId))
+				return false;
+			break;
+		case TEEHISTORIAN_CONSOLE_COMMAND:
+		{
+			pChunk->m_Type = CHUNK_CONSOLE_COMMAND;
+			// negative for commands not sent by a client
+			pChunk->m_ClientId = m_Unpacker.GetInt();
+			pChunk->m_FlagMask = m_Unpacker.GetInt();
+			pChunk->m_pString = m_Unpacker.GetString(0);
+			const int NumArgs = m_Unpacker.GetInt();
+			if(NumArgs < 0 || NumArgs > m_Unpacker.RemainingSize())
+				return Fail("invalid number of console command arguments");
+			m_vpArgs.resize(NumArgs);
+			for(auto &pArg : m_vpArgs)
+				pArg = m_Unpacker.GetString(0);
+			pChunk->m_NumArgs = NumArgs;
+			pChunk->m_ppArgs = m_vpArgs.data();
+			break;
+		}
+		case TEEHISTORIAN_EX:
+		{
+			pChunk->m_Type = CHUNK_EX;
+			const unsigned char *pUuid = m_Unpacker.GetRaw(sizeof(CUuid));
+			pChunk->m_DataSize = m_Unpacker.GetInt();
+			pChunk->m_pData = m_Unpacker.GetRaw(pChunk->m_DataSize);
+			if(pUuid)
+				mem_copy(&pChunk->m_Uuid, pUuid, sizeof(CUuid));
+			break;
+		}
+		default:
+			return Fail("unknown chunk type");
+		}
+	}
+
+	if(m_Unpacker.Error())
+		return Fail("truncated chunk");
+	pChunk->m_Tick = m_State.m_Tick;
+	return true;
+}
+
+bool CTeeHistorianReader::PlayerPosition(int ClientId, int *pX, int *pY) const
+{
+	if(!m_State.m_aPlayerAlive[ClientId])
+		return false;
+	*pX = m_State.m_aPlayerX[ClientId];
+	*pY = m_State.m_aPlayerY[ClientId];
+	return true;
+}
+
+bool CTeeHistorianReader::BuildIndex(int Interval)
+{
+	dbg_assert(Interval > 0, "invalid index interval");
+	if(m_HeaderSize == 0)
+		return Fail("no file loaded");
+
+	m_vCheckpoints.clear();
+	ResetState();
+	m_ChunkOffset = m_HeaderSize;
+	m_vCheckpoints.emplace_back();
+	CaptureCheckpoint(&m_vCheckpoints.back(), 0);
+
+	// decompress everything from the start to find the flush points
+	m_vRestartPoints.resize(1);
+	m_RecordRestartPoints = true;
+	m_Finished = false;
+	m_Error = false;
+	m_aError[0] = '\0';
+	m_CheckpointInterval = Interval;
+	m_NextCheckpointTick = Interval;
+	if(RestartData(m_HeaderSize))
+	{
+		CChunk Chunk;
+		while(NextChunk(&Chunk))
+		{
+			if(Chunk.m_ClientId >= 0)
+				m_vCheckpoints.back().m_Active.set(Chunk.m_ClientId);
+		}
+	}
+	m_NextCheckpointTick = -1;
+	m_RecordRestartPoints = false;
+
+	if(m_Error)
+	{
+		m_vCheckpoints.clear();
+		m_vRestartPoints.resize(1);
+		return false;
+	}
+	return RestoreCheckpoint(m_vCheckpoints.front());
+}
+
+static void PushInt64(std::vector<int32_t> *pvData, int64_t Value)
+{
+	pvData->push_back((int32_t)(uint32_t)Value);
+	pvData->push_back((int32_t)(Value >> 32));
+}
+
+static int64_t GetInt64(const int32_t *pData)
+{
+	return (int64_t)(uint32_t)pData[0] | ((int64_t)pData[1] << 32);
+}
+
+bool CTeeHistorianReader::SaveIndex(IOHANDLE File) const
+{
+	std::vector<int32_t> vData;
+	vData.push_back(INDEX_MAGIC);
+	vData.push_back(INDEX_VERSION);
+	PushInt64(&vData, m_SourceSize);
+	vData.push_back(m_CheckpointInterval);
+	for(size_t i = 0; i < sizeof(m_HeaderSha256.data); i += sizeof(int32_t))
+	{
+		int32_t Value;
+		mem_copy(&Value, m_HeaderSha256.data + i, sizeof(Value));
+		vData.push_back(Value);
+	}
+	vData.push_back(m_vRestartPoints.size());
+	vData.push_back(m_vCheckpoints.size());
+
+	for(const CRestartPoint &Point : m_vRestartPoints)
+	{
+		PushInt64(&vData, Point.m_In);
+		PushInt64(&vData, Point.m_Out);
+	}
+
+	for(const CCheckpoint &Checkpoint : m_vCheckpoints)
+	{
+		vData.push_back(Checkpoint.m_Tick);
+		PushInt64(&vData, Checkpoint.m_Offset);
+		vData.push_back(Checkpoint.m_State.m_Tick);
+		vData.push_back(Checkpoint.m_State.m_MaxClientId);
+		for(int i = 0; i < INDEX_MASK_INTS; i++)
+		{
+			int32_t Mask = 0;
+			for(int Bit = 0; Bit < 32 && i * 32 + Bit < MAX_CLIENTS; Bit++)
+				Mask |= (int32_t)Checkpoint.m_Active[i * 32 + Bit] << Bit;
+			vData.push_back(Mask);
+		}
+		// only the players that are alive and the clients with inputs
+		const size_t NumAliveIndex = vData.size();
+		vData.push_back(0);
+		for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+		{
+			if(!Checkpoint.m_State.m_aPlayerAlive[ClientId])
+				continue;
+			vData[NumAliveIndex]++;
+			vData.push_back(ClientId);
+			vData.push_back(Checkpoint.m_State.m_aPlayerX[ClientId]);
+			vData.push_back(Checkpoint.m_State.m_aPlayerY[ClientId]);
+		}
+		const size_t NumInputsIndex = vData.size();
+		vData.push_back(0);
+		for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+		{
+			if(!Checkpoint.m_State.m_aHaveInput[ClientId])
+				continue;
+			vData[NumInputsIndex]++;
+			vData.push_back(ClientId);
+			const int *pInput = (const int *)&Checkpoint.m_State.m_aInputs[ClientId];
+			vData.insert(vData.end(), pInput, pInput + INPUT_SIZE);
+		}
+	}
+
+	const unsigned Size = vData.size() * sizeof(int32_t);
+	return io_write(File, vData.data(), Size) == Size;
+}
+
+bool CTeeHistorianReader::LoadIndex(IOHANDLE File)
+{
+	void *pFileData;
+	unsigned FileSize;
+	io_read_all(File, &pFileData, &FileSize);
+	const int32_t *pData = (const int32_t *)pFileData;
+	const int32_t *pEnd = pData + FileSize / sizeof(int32_t);
+	std::vector<CRestartPoint> vRestartPoints;
+	std::vector<CCheckpoint> vCheckpoints;
+	auto Read = [&](int Num) {
+		const int32_t *pResult = pData;
+		if(Num < 0 || pEnd - pData < Num)
+			return (const int32_t *)nullptr;
+		pData += Num;
+		return pResult;
+	};
+
+	const int NumHeaderInts = 5 + sizeof(m_HeaderSha256.data) / sizeof(int32_t) + 2;
+	const int32_t *pHeader = Read(NumHeaderInts);
+	bool Valid = pHeader &&
+		     pHeader[0] == INDEX_MAGIC &&
+		     pHeader[1] == INDEX_VERSION &&
+		     GetInt64(pHeader + 2) == m_SourceSize &&
+		     pHeader[4] > 0 &&
+		     mem_comp(pHeader + 5, m_HeaderSha256.data, sizeof(m_HeaderSha256.data)) == 0 &&
+		     pHeader[NumHeaderInts - 2] > 0 &&
+		     pHeader[NumHeaderInts - 1] > 0;
+	const int32_t *pRestartPoints = Valid ? Read(pHeader[NumHeaderInts - 2] * 4) : nullptr;
+	Valid = Valid && pRestartPoints;
+	if(Valid)
+	{
+		vRestartPoints.resize(pHeader[NumHeaderInts - 2]);
+		for(size_t i = 0; i < vRestartPoints.size() && Valid; i++, pRestartPoints += 4)
+		{
+			vRestartPoints[i].m_In = GetInt64(pRestartPoints);
+			vRestartPoints[i].m_Out = GetInt64(pRestartPoints + 2);
+			// the first one is the start of the file, the others follow
+			// each other
+			if(i == 0)
+				Valid = vRestartPoints[i].m_In == 0 && vRestartPoints[i].m_Out == 0;
+			else
+				Valid = vRestartPoints[i].m_In > vRestartPoints[i - 1].m_In && vRestartPoints[i].m_In <= m_SourceSize && vRestartPoints[i].m_Out > vRestartPoints[i - 1].m_Out;
+		}
+	}
+	if(Valid)
+	{
+		vCheckpoints.resize(pHeader[NumHeaderInts - 1]);
+		for(CCheckpoint &Checkpoint : vCheckpoints)
+		{
+			const int32_t *pFixed = Read(5 + INDEX_MASK_INTS);
+			if(!pFixed || GetInt64(pFixed + 1) < m_HeaderSize)
+			{
+				Valid = false;
+				break;
+			}
+			Checkpoint.m_Tick = pFixed[0];
+			Checkpoint.m_Offset = GetInt64(pFixed + 1);
+			Checkpoint.m_State.m_Tick = pFixed[3];
+			Checkpoint.m_State.m_MaxClientId = pFixed[4];
+			for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+			{
+				Checkpoint.m_State.m_aPlayerAlive[ClientId] = false;
+				Checkpoint.m_State.m_aHaveInput[ClientId] = false;
+				Checkpoint.m_Active[ClientId] = (pFixed[5 + ClientId / 32] >> (ClientId % 32)) & 1;
+			}
+			const int32_t *pNumAlive = Read(1);
+			const int32_t *pAlive = pNumAlive ? Read(*pNumAlive * 3) : nullptr;
+			const int32_t *pNumInputs = pAlive ? Read(1) : nullptr;
+			const int32_t *pInputs = pNumInputs ? Read(*pNumInputs * (1 + INPUT_SIZE)) : nullptr;
+			if(!pInputs)
+			{
+				Valid = false;
+				break;
+			}
+			for(int i = 0; i < *pNumAlive && Valid; i++, pAlive += 3)
+			{
+				const int ClientId = pAlive[0];
+				Valid = ClientId >= 0 && ClientId < MAX_CLIENTS;
+				if(!Valid)
+					break;
+				Checkpoint.m_State.m_aPlayerAlive[ClientId] = true;
+				Checkpoint.m_State.m_aPlayerX[ClientId] = pAlive[1];
+				Checkpoint.m_State.m_aPlayerY[ClientId] = pAlive[2];
+			}
+			for(int i = 0; i < *pNumInputs && Valid; i++, pInputs += 1 + INPUT_SIZE)
+			{
+				const int ClientId = pInputs[0];
+				Valid = ClientId >= 0 && ClientId < MAX_CLIENTS;
+				if(!Valid)
+					break;
+				Checkpoint.m_State.m_aHaveInput[ClientId] = true;
+				mem_copy(&Checkpoint.m_State.m_aInputs[ClientId], pInputs + 1, sizeof(CNetObj_PlayerInput));
+			}
+			if(!Valid)
+				break;
+		}
+	}
+	Valid = Valid && pData == pEnd && (m_Compressed || vRestartPoints.size() == 1);
+	if(Valid)
+		m_CheckpointInterval = pHeader[4];
+	free(pFileData);
+
+	if(!Valid)
+		return false;
+	m_vRestartPoints = std::move(vRestartPoints);
+	m_vCheckpoints = std::move(vCheckpoints);
+	return true;
+}
+
+std::vector<CTeeHistorianReader::CCheckpoint>::const_iterator CTeeHistorianReader::FindCheckpoint(int Tick) const
+{
+	// the last checkpoint at or before the tick
+	auto It = std::upper_bound(m_vCheckpoints.begin(), m_vCheckpoints.end(), Tick, [](int Value, const CCheckpoint &Checkpoint) {
+		return Value < Checkpoint.m_Tick;
+	});
+	if(It != m_vCheckpoints.begin())
+		--It;
+	return It;
+}
+
+bool CTeeHistorianReader::SeekTick(int Tick)
+{
+	if(m_vCheckpoints.empty())
+		return Fail("no index");
+
+	auto It = FindCheckpoint(Tick);
+	if(!RestoreCheckpoint(*It))
+		return false;
+	if(It->m_Tick >= Tick)
+		return true;
+
+	m_SeekTick = Tick;
+	m_SeekFound = false;
+	CChunk Chunk;
+	while(!m_SeekFound && NextChunk(&Chunk))
+	{
+	}
+	m_SeekTick = -1;
+	if(!m_SeekFound)
+		return false;
+	return RestoreCheckpoint(m_SeekCheckpoint);
+}
+
+bool CTeeHistorianReader::ActiveRange(int ClientId, int Tick, int *pStart, int *pEnd) const
+{
+	dbg_assert(ClientId >= 0 && ClientId < MAX_CLIENTS, "invalid client id");
+	if(m_vCheckpoints.empty())
+		return false;
+	auto It = FindCheckpoint(Tick);
+	while(It != m_vCheckpoints.end() && !It->m_Active[ClientId])
+		++It;
+	if(It == m_vCheckpoints.end())
+		return false;
+	*pStart = std::max(Tick, It->m_Tick);
+	while(It != m_vCheckpoints.end() && It->m_Active[ClientId])
+		++It;
+	*pEnd = It != m_vCheckpoints.end() ? It->m_Tick : -1;
+	return true;
+}
@@ -0,0 +1,277 @@
+#ifndef ENGINE_SHARED_TEEHISTORIAN_READER_H
+#define ENGINE_SHARED_TEEHISTORIAN_READER_H
+
+#include <base/hash.h>
+#include <base/system.h>
+#include <engine/shared/packer.h>
+#include <engine/shared/protocol.h>
+#include <engine/shared/uuid_manager.h>
+#include <game/generated/protocol.h>
+
+#include <bitset>
+#include <vector>
+
+typedef struct _json_value json_value;
+typedef struct z_stream_s z_stream;
+
+/**
+ * Reads the files written by `CTeeHistorian`.
+ *
+ * The chunks are returned one by one together with the tick they belong
+ * to. Player positions and inputs are returned as absolute values, the
+ * differences to the previous ones stored in the file are resolved by the
+ * reader.
+ *
+ * The file is read and decompressed (gzip, as written by the server) in
+ * parts while reading the chunks, only a window of the data is kept in
+ * memory.
+ *
+ * The data of the returned chunks points into the reader's buffer and
+ * stays valid until the next chunk is read.
+ */
+class CTeeHistorianReader
+{
+public:
+	enum
+	{
+		CHUNK_FINISH,
+		CHUNK_TICK_SKIP,
+		CHUNK_PLAYER_NEW,
+		CHUNK_PLAYER_DIFF,
+		CHUNK_PLAYER_OLD,
+		CHUNK_INPUT_NEW,
+		CHUNK_INPUT_DIFF,
+		CHUNK_MESSAGE,
+		CHUNK_JOIN,
+		CHUNK_DROP,
+		CHUNK_CONSOLE_COMMAND,
+		CHUNK_EX,
+	};
+
+	class CChunk
+	{
+	public:
+		int m_Type;
+		// the tick the chunk belongs to, player data is recorded at the end
+		// of the tick and everything else between it and the next tick
+		int m_Tick;
+		int m_ClientId;
+
+		// CHUNK_TICK_SKIP
+		int m_Dt;
+
+		// CHUNK_PLAYER_NEW, CHUNK_PLAYER_DIFF
+		int m_X;
+		int m_Y;
+
+		// CHUNK_INPUT_NEW, CHUNK_INPUT_DIFF
+		CNetObj_PlayerInput m_Input;
+
+		// CHUNK_MESSAGE, CHUNK_EX
+		const unsigned char *m_pData;
+		int m_DataSize;
+
+		// CHUNK_EX
+		CUuid m_Uuid;
+
+		// CHUNK_DROP: the reason, CHUNK_CONSOLE_COMMAND: the command
+		const char *m_pString;
+
+		// CHUNK_CONSOLE_COMMAND
+		int m_FlagMask;
+		int m_NumArgs;
+		const char *const *m_ppArgs;
+	};
+
+private:
+	// the values the differences in the file are relative to
+	class CState
+	{
+	public:
+		int m_Tick;
+		// highest client id with player data in the current tick, a lower
+		// one starts the next tick
+		int m_MaxClientId;
+
+		bool m_aPlayerAlive[MAX_CLIENTS];
+		int m_aPlayerX[MAX_CLIENTS];
+		int m_aPlayerY[MAX_CLIENTS];
+		bool m_aHaveInput[MAX_CLIENTS];
+		CNetObj_PlayerInput m_aInputs[MAX_CLIENTS];
+	};
+
+	// everything needed to continue reading at a tick boundary
+	class CCheckpoint
+	{
+	public:
+		// the first tick read after restoring the checkpoint
+		int m_Tick;
+		// offset of the first chunk of the tick in the decompressed data
+		int64_t m_Offset;
+		CState m_State;
+		// clients that are alive or have chunks until the next checkpoint
+		std::bitset<MAX_CLIENTS> m_Active;
+	};
+
+	// a point from which the compressed data can be inflated without the
+	// data before it, the server's flush points
+	class CRestartPoint
+	{
+	public:
+		// offset in the file
+		int64_t m_In;
+		// offset in the decompressed data
+		int64_t m_Out;
+	};
+
+	// either the file or the data passed to `Load`
+	IOHANDLE m_File;
+	const unsigned char *m_pSource;
+	int64_t m_SourceSize;
+	int64_t m_SourcePos;
+
+	bool m_Compressed;
+	z_stream *m_pZStream;
+	std::vector<unsigned char> m_vInput;
+	// file offset of `m_vInput`
+	int64_t m_InputOffset;
+	std::vector<CRestartPoint> m_vRestartPoints;
+	bool m_RecordRestartPoints;
+
+	// window of the decompressed data starting at `m_DataOffset`, the
+	// unpacker reads from it
+	std::vector<unsigned char> m_vData;
+	int64_t m_DataOffset;
+	bool m_EndOfData;
+	CUnpacker m_Unpacker;
+
+	json_value *m_pHeader;
+	int m_HeaderSize;
+	SHA256_DIGEST m_HeaderSha256;
+
+	bool m_Finished;
+	bool m_Error;
+	char m_aError[128];
+
+	CState m_State;
+	std::vector<const char *> m_vpArgs;
+	// offset of the chunk being read
+	int64_t m_ChunkOffset;
+
+	std::vector<CCheckpoint> m_vCheckpoints;
+	// while building the index, the tick of the next checkpoint
+	int m_NextCheckpointTick;
+	int m_CheckpointInterval;
+	// while seeking, the state at the start of the first tick at or after
+	// `m_SeekTick` once it's read
+	int m_SeekTick;
+	bool m_SeekFound;
+	CCheckpoint m_SeekCheckpoint;
+
+	bool Fail(const char *pError);
+	void Close();
+	bool Start();
+	unsigned ReadSource(void *pData, unsigned Size);
+	bool SeekSource(int64_t Offset);
+	bool Inflate(size_t Size);
+	// reads until `Size` bytes after the unpacker's position are in
+	// `m_vData` or the data ends, dropping the bytes before it
+	bool Fill(size_t Size);
+	// continues reading the decompressed data at `Offset`, `RestartData`
+	// always reads it again from the file
+	bool SeekData(int64_t Offset);
+	bool RestartData(int64_t Offset);
+	bool ParseHeader();
+	bool CheckClientId(int ClientId);
+	void PlayerData(int ClientId);
+	// called before the first chunk of `NewTick` changes the state
+	void TickStart(int NewTick);
+	void ResetState();
+	void CaptureCheckpoint(CCheckpoint *pCheckpoint, int NewTick) const;
+	bool RestoreCheckpoint(const CCheckpoint &Checkpoint);
+	// the last checkpoint at or before the tick, the first one if there's none
+	std::vector<CCheckpoint>::const_iterator FindCheckpoint(int Tick) const;
+
+public:
+	CTeeHistorianReader();
+	~CTeeHistorianReader();
+
+	// keeps the file open until another one is opened
+	bool Open(class IStorage *pStorage, const char *pFilename, int StorageType);
+	// reads from the data, which must stay valid while reading
+	bool Load(const void *pData, int64_t DataSize);
+
+	const char *Error() const { return m_aError; }
+
+	/**
+	 * The JSON header of the file, containing the game uuid, the map, the
+	 * seed of the random number generator, the non-default server
+	 * configuration and tuning.
+	 */
+	const json_value *Header() const { return m_pHeader; }
+	// empty string if the header doesn't contain the string
+	const char *HeaderString(const char *pName) const;
+
+	/**
+	 * Reads the next chunk.
+	 *
+	 * @param pChunk Filled with the chunk.
+	 *
+	 * @return `false` after the `CHUNK_FINISH` chunk, at the end of the
+	 * data and on errors, `Error()` is non-empty in the latter case.
+	 */
+	bool NextChunk(CChunk *pChunk);
+
+	/**
+	 * The position of a player after the chunks read so far.
+	 *
+	 * @return `false` if the player isn't alive.
+	 */
+	bool PlayerPosition(int ClientId, int *pX, int *pY) const;
+
+	/**
+	 * Reads the whole file once and remembers the reader's state every
+	 * `Interval` ticks and the points at which the decompression can be
+	 * restarted, reading starts at the beginning again afterwards.
+	 *
+	 * @see SeekTick
+	 */
+	bool BuildIndex(int Interval);
+	/**
+	 * Writes the index to a sidecar file so it doesn't have to be built
+	 * again, it's only valid for the same file.
+	 */
+	bool SaveIndex(IOHANDLE File) const;
+	// fails if the index doesn't belong to the loaded file
+	bool LoadIndex(IOHANDLE File);
+	bool HasIndex() const { return !m_vCheckpoints.empty(); }
+	// including the start of the file
+	int NumRestartPoints() const { return m_vRestartPoints.size(); }
+
+	/**
+	 * Continues reading at the start of the first tick at or after `Tick`
+	 * using the index, reads at most the index interval of ticks to get
+	 * there. Compressed files are decompressed from the restart point
+	 * before it.
+	 *
+	 * @return `false` if the file ends before the tick.
+	 */
+	bool SeekTick(int Tick);
+	/**
+	 * Finds the next range of ticks in which the client is alive or has
+	 * chunks according to the index, at the granularity of the index
+	 * interval. The client isn't alive and has no chunks outside of
+	 * the ranges.
+	 *
+	 * @param ClientId The client.
+	 * @param Tick The first tick to consider.
+	 * @param pStart Filled with the first tick of the range.
+	 * @param pEnd Filled with the tick after the range, `-1` if the range
+	 * lasts until the end of the file.
+	 *
+	 * @return `false` if the client isn't present at or after `Tick`.
+	 */
+	bool ActiveRange(int ClientId, int Tick, int *pStart, int *pEnd) const;
+};
+
+#endif
@@ -75,6 +75,12 @@ void CDebugHud::RenderNetCorrections()
 	str_format(aBuf, sizeof(aBuf), "%d", m_pClient->m_Snap.m_pLocalCharacter->m_Angle);
 	RenderRow("Angle:", aBuf);
 
+	str_format(aBuf, sizeof(aBuf), "%.1f", m_pClient->PredictedTicksAvg());
+	RenderRow("Predicted ticks:", aBuf);
+
+	str_format(aBuf, sizeof(aBuf), "%.0f us", m_pClient->PredictTimeAvg() * 1000000.0f);
+	RenderRow("Prediction time:", aBuf);
+
 	str_format(aBuf, sizeof(aBuf), "%d", m_pClient->NetobjNumCorrections());
 	RenderRow("Netobj corrections", aBuf);
 	RenderRow(" on:", m_pClient->NetobjCorrectedOn());
@@ -582,6 +582,9 @@ void CGameClient::OnReset()
 
 	m_PredictedTick = -1;
 	std::fill(std::begin(m_aLastNewPredictedTick), std::end(m_aLastNewPredictedTick), -1);
+	m_PredictionCache.m_GameTick = -1;
+	m_PredictedTicksAvg = 0.0f;
+	m_PredictTimeAvg = 0.0f;
 
 	m_LastRoundStartTick = -1;
 	m_LastFlagCarrierRed = -4;
@@ -1053,6 +1056,7 @@ void CGameClient::OnMessage(int MsgId, CUnpacker *pUnpacker, int Conn, bool Dumm
 			if(CCharacter *pChar = m_GameWorld.GetCharacterById(pMsg->m_Victim))
 				pChar->ResetPrediction();
 			m_GameWorld.ReleaseHooked(pMsg->m_Victim);
+			m_GameWorld.OnModified();
 		}
 
 		// if we are spectating a static id set (team 0) and somebody killed, and its not a guy in solo, we remove him from the list
@@ -1098,6 +1102,7 @@ void CGameClient::OnMessage(int MsgId, CUnpacker *pUnpacker, int Conn, bool Dumm
 				m_GameWorld.ReleaseHooked(i);
 			}
 		}
+		m_GameWorld.OnModified();
 		std::stable_sort(vStrongWeakSorted.begin(), vStrongWeakSorted.end(), [](auto &Left, auto &Right) { return Left.second > Right.second; });
 		for(auto Id : vStrongWeakSorted)
 		{
@@ -2139,6 +2144,153 @@ void CGameClient::UpdateEditorIngameMoved()
 	}
 }
 
+void CGameClient::CPredictionCache::CInput::Set(const CNetObj_PlayerInput *pInput)
+{
+	m_Valid = pInput != nullptr;
+	if(pInput)
+		m_Input = *pInput;
+}
+
+bool CGameClient::CPredictionCache::CInput::Matches(const CNetObj_PlayerInput *pInput) const
+{
+	if(!pInput)
+		return !m_Valid;
+	return m_Valid && mem_comp(&m_Input, pInput, sizeof(m_Input)) == 0;
+}
+
+bool CGameClient::PredictionCacheValid(int CacheTick)
+{
+	// m_GameWorld got a new snapshot or was modified otherwise since the copy
+	if(!m_CachedPredictedWorld.m_IsValidCopy || m_CachedPredictedWorld.m_pParent != &m_GameWorld || m_GameWorld.m_pChild != &m_CachedPredictedWorld)
+		return false;
+
+	const CPredictionCache &Cache = m_PredictionCache;
+	if(Cache.m_GameTick != Client()->GameTick(g_Config.m_ClDummy) ||
+		Cache.m_Dummy != g_Config.m_ClDummy ||
+		Cache.m_IsDummySwapping != m_IsDummySwapping ||
+		Cache.m_LocalClientId != m_Snap.m_LocalClientId ||
+		Cache.m_DummyId != (PredictDummy() ? m_PredictedDummyId : -1))
+		return false;
+
+	// the predicted time was reset, or more ticks are cached than are needed now
+	if(Client()->PredGameTick(g_Config.m_ClDummy) < Cache.m_PredGameTick || Cache.m_Tick > CacheTick)
+		return false;
+	if(CacheTick - Cache.m_GameTick >= CPredictionCache::NUM_INPUTS)
+		return false;
+
+	for(int Tick = Cache.m_GameTick + 1; Tick <= Cache.m_Tick; Tick++)
+	{
+		if(!Cache.m_aInputs[Tick % CPredictionCache::NUM_INPUTS].Matches((CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping)))
+			return false;
+		if(Cache.m_HasDummyChar && !Cache.m_aDummyInputs[Tick % CPredictionCache::NUM_INPUTS].Matches((CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping ^ 1)))
+			return false;
+	}
+	return true;
+}
+
+void CGameClient::RemoveUnpredicted(CGameWorld *pWorld)
+{
+	// don't predict inactive players, or entities from other teams
+	for(int i = 0; i < MAX_CLIENTS; i++)
+		if(CCharacter *pChar = pWorld->GetCharacterById(i))
+			if((!m_Snap.m_aCharacters[i].m_Active && pChar->m_SnapTicks > 10) || IsOtherTeam(i))
+				pChar->Destroy();
+
+	CProjectile *pProjNext = 0;
+	for(CProjectile *pProj = (CProjectile *)pWorld->FindFirst(CGameWorld::ENTTYPE_PROJECTILE); pProj; pProj = pProjNext)
+	{
+		pProjNext = (CProjectile *)pProj->TypeNext();
+		if(IsOtherTeam(pProj->GetOwner()))
+		{
+			pProj->Destroy();
+		}
+	}
+}
+
+void CGameClient::PredictTick(CGameWorld *pWorld, int Tick, int FinalTick, int FreezeTick, CCharacter *pLocalChar, CCharacter *pDummyChar)
+{
+	// optionally allow some movement in freeze by not predicting freeze the last one to two ticks
+	if(g_Config.m_ClPredictFreeze == 2 && FreezeTick <= Tick)
+		pLocalChar->m_CanMoveInFreeze = true;
+
+	// apply inputs and tick
+	CNetObj_PlayerInput *pInputData = (CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping);
+	CNetObj_PlayerInput *pDummyInputData = !pDummyChar ? 0 : (CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping ^ 1);
+	bool DummyFirst = pInputData && pDummyInputData && pDummyChar->GetCid() < pLocalChar->GetCid();
+
+	if(g_Config.m_ClFastInput && Tick == FinalTick)
+		pInputData = &m_Controls.m_FastInput;
+
+	if(DummyFirst)
+		pDummyChar->OnDirectInput(pDummyInputData);
+	if(pInputData)
+		pLocalChar->OnDirectInput(pInputData);
+	if(pDummyInputData && !DummyFirst)
+		pDummyChar->OnDirectInput(pDummyInputData);
+	pWorld->m_GameTick = Tick;
+	if(pInputData)
+		pLocalChar->OnPredictedInput(pInputData);
+	if(pDummyInputData)
+		pDummyChar->OnPredictedInput(pDummyInputData);
+	pWorld->Tick();
+}
+
+#ifdef CONF_DEBUG
+void CGameClient::CheckPredictionCache(int FinalTick, int OthersTick, int FreezeTick)
+{
+	// copying m_GameWorld relinks its entities to the copy, keep the links
+	// of the cached world
+	std::vector<CEntity *> vpChildren;
+	for(int Type = 0; Type < CGameWorld::NUM_ENTTYPES; Type++)
+		for(CEntity *pEnt = m_GameWorld.FindFirst(Type); pEnt; pEnt = pEnt->TypeNext())
+			vpChildren.push_back(pEnt->m_pChild);
+	CGameWorld *pChild = m_GameWorld.m_pChild;
+	const bool CacheValid = m_CachedPredictedWorld.m_IsValidCopy;
+	m_DebugPredictedWorld.CopyWorld(&m_GameWorld);
+	m_GameWorld.m_pChild = pChild;
+	m_CachedPredictedWorld.m_IsValidCopy = CacheValid;
+
+	// all ticks from the snapshot, like without the cache
+	RemoveUnpredicted(&m_DebugPredictedWorld);
+	CCharacter *pLocalChar = m_DebugPredictedWorld.GetCharacterById(m_Snap.m_LocalClientId);
+	CCharacter *pDummyChar = PredictDummy() ? m_DebugPredictedWorld.GetCharacterById(m_PredictedDummyId) : nullptr;
+	for(int Tick = Client()->GameTick(g_Config.m_ClDummy) + 1; pLocalChar && Tick <= FinalTick; Tick++)
+	{
+		PredictTick(&m_DebugPredictedWorld, Tick, FinalTick, FreezeTick, pLocalChar, pDummyChar);
+
+		if(Tick == OthersTick)
+		{
+			for(int i = 0; i < MAX_CLIENTS; i++)
+			{
+				if(CCharacter *pChar = m_DebugPredictedWorld.GetCharacterById(i))
+				{
+					CNetObj_CharacterCore Full, Cached;
+					pChar->GetCore().Write(&Full);
+					m_aClients[i].m_Predicted.Write(&Cached);
+					if(mem_comp(&Full, &Cached, sizeof(Full)) != 0)
+						log_error("prediction", "cached prediction differs for ClientId=%d at tick %d", i, Tick);
+				}
+			}
+		}
+		if(Tick == FinalTick)
+		{
+			CNetObj_CharacterCore Full, Cached;
+			pLocalChar->GetCore().Write(&Full);
+			m_PredictedChar.Write(&Cached);
+			if(mem_comp(&Full, &Cached, sizeof(Full)) != 0)
+				log_error("prediction", "cached prediction differs for the local character at tick %d", Tick);
+		}
+	}
+
+	m_DebugPredictedWorld.Clear();
+	m_DebugPredictedWorld.m_pParent = nullptr;
+	int Child = 0;
+	for(int Type = 0; Type < CGameWorld::NUM_ENTTYPES; Type++)
+		for(CEntity *pEnt = m_GameWorld.FindFirst(Type); pEnt; pEnt = pEnt->TypeNext())
+			pEnt->m_pChild = vpChildren[Child++];
+}
+#endif
+
 void CGameClient::OnPredict()
 {
 	// store the previous values so we can detect prediction errors
@@ -2170,81 +2322,95 @@ void CGameClient::OnPredict()
 		aBeforeRender[i] = GetSmoothPos(i);
 
 	// init
+	const int64_t PredictStart = time_get();
 	bool Dummy = g_Config.m_ClDummy ^ m_IsDummySwapping;
-	m_PredictedWorld.CopyWorld(&m_GameWorld);
-
-	// don't predict inactive players, or entities from other teams
-	for(int i = 0; i < MAX_CLIENTS; i++)
-		if(CCharacter *pChar = m_PredictedWorld.GetCharacterById(i))
-			if((!m_Snap.m_aCharacters[i].m_Active && pChar->m_SnapTicks > 10) || IsOtherTeam(i))
-				pChar->Destroy();
-
-	CProjectile *pProjNext = 0;
-	for(CProjectile *pProj = (CProjectile *)m_PredictedWorld.FindFirst(CGameWorld::ENTTYPE_PROJECTILE); pProj; pProj = pProjNext)
-	{
-		pProjNext = (CProjectile *)pProj->TypeNext();
-		if(IsOtherTeam(pProj->GetOwner()))
-		{
-			pProj->Destroy();
-		}
-	}
-
-	CCharacter *pLocalChar = m_PredictedWorld.GetCharacterById(m_Snap.m_LocalClientId);
+	const int FinalTick = Client()->PredGameTick(g_Config.m_ClDummy) + g_Config.m_ClFastInput;
+	const int OthersTick = FinalTick - std::max(g_Config.m_ClFastInput - g_Config.m_ClFastInputOthers, 0);
+	const int FreezeTick = Client()->PredGameTick(g_Config.m_ClDummy) - 1 - Client()->PredGameTick(g_Config.m_ClDummy) % 2;
+
+	// the ticks up to the first one that is captured below can be kept for the next frames,
+	// the cached world starts at the snapshot tick
+	int CacheTick = OthersTick - 1;
+	if(g_Config.m_ClPredictFreeze == 2)
+		CacheTick = minimum(CacheTick, FreezeTick - 1);
+	CacheTick = maximum(CacheTick, Client()->GameTick(g_Config.m_ClDummy));
+
+	const bool CacheValid = PredictionCacheValid(CacheTick);
+	if(!CacheValid)
+	{
+		m_CachedPredictedWorld.CopyWorld(&m_GameWorld);
+		RemoveUnpredicted(&m_CachedPredictedWorld);
+
+		m_PredictionCache.m_GameTick = Client()->GameTick(g_Config.m_ClDummy);
+		m_PredictionCache.m_Tick = m_PredictionCache.m_GameTick;
+		m_PredictionCache.m_Dummy = g_Config.m_ClDummy;
+		m_PredictionCache.m_IsDummySwapping = m_IsDummySwapping;
+		m_PredictionCache.m_LocalClientId = m_Snap.m_LocalClientId;
+		m_PredictionCache.m_DummyId = PredictDummy() ? m_PredictedDummyId : -1;
+		m_PredictionCache.m_HasDummyChar = m_PredictionCache.m_DummyId >= 0 && m_CachedPredictedWorld.GetCharacterById(m_PredictionCache.m_DummyId);
+	}
+	m_PredictionCache.m_PredGameTick = Client()->PredGameTick(g_Config.m_ClDummy);
+
+	CGameWorld *pWorld = &m_CachedPredictedWorld;
+	CCharacter *pLocalChar = pWorld->GetCharacterById(m_Snap.m_LocalClientId);
 	if(!pLocalChar)
+	{
+		m_PredictedWorld.CopyWorld(&m_CachedPredictedWorld);
 		return;
+	}
 	CCharacter *pDummyChar = 0;
 	if(PredictDummy())
-		pDummyChar = m_PredictedWorld.GetCharacterById(m_PredictedDummyId);
+		pDummyChar = pWorld->GetCharacterById(m_PredictedDummyId);
 
 	// predict
 	// prediction actually happens here
-	int FinalTick = Client()->PredGameTick(g_Config.m_ClDummy) + g_Config.m_ClFastInput;
-	for(int Tick = Client()->GameTick(g_Config.m_ClDummy) + 1; Tick <= FinalTick; Tick++)
+	// continue in a copy from the first tick that depends on this frame
+	auto ContinueInCopy = [&]() {
+		m_PredictedWorld.CopyWorld(&m_CachedPredictedWorld);
+		pWorld = &m_PredictedWorld;
+		pLocalChar = pWorld->GetCharacterById(m_Snap.m_LocalClientId);
+		if(pDummyChar)
+			pDummyChar = pWorld->GetCharacterById(m_PredictedDummyId);
+		return pLocalChar != nullptr;
+	};
+	const int FirstTick = m_PredictionCache.m_Tick + 1;
+	dbg_assert(FirstTick <= CacheTick + 1, "more ticks cached than allowed");
+	// nothing left to cache, also if no tick is predicted at all
+	if(FirstTick > CacheTick && !ContinueInCopy())
+		return;
+	for(int Tick = FirstTick; Tick <= FinalTick; Tick++)
 	{
+		if(Tick == CacheTick + 1 && pWorld == &m_CachedPredictedWorld && !ContinueInCopy())
+			return;
+
 		// fetch the previous characters
 		if(Tick == FinalTick)
 		{
 			m_PrevPredictedWorld.CopyWorld(&m_PredictedWorld);
 			m_PredictedPrevChar = pLocalChar->GetCore();
 		}
-		if(Tick == FinalTick - std::max(g_Config.m_ClFastInput - g_Config.m_ClFastInputOthers, 0))
+		if(Tick == OthersTick)
 		{
 			for(int i = 0; i < MAX_CLIENTS; i++)
 				if(CCharacter *pChar = m_PredictedWorld.GetCharacterById(i))
 					m_aClients[i].m_PrevPredicted = pChar->GetCore();
 		}
 
-		// optionally allow some movement in freeze by not predicting freeze the last one to two ticks
-		if(g_Config.m_ClPredictFreeze == 2 && Client()->PredGameTick(g_Config.m_ClDummy) - 1 - Client()->PredGameTick(g_Config.m_ClDummy) % 2 <= Tick)
-			pLocalChar->m_CanMoveInFreeze = true;
-
-		// apply inputs and tick
-		CNetObj_PlayerInput *pInputData = (CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping);
-		CNetObj_PlayerInput *pDummyInputData = !pDummyChar ? 0 : (CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping ^ 1);
-		bool DummyFirst = pInputData && pDummyInputData && pDummyChar->GetCid() < pLocalChar->GetCid();
-
-		if(g_Config.m_ClFastInput && Tick == FinalTick)
-			pInputData = &m_Controls.m_FastInput;
-
-		if(DummyFirst)
-			pDummyChar->OnDirectInput(pDummyInputData);
-		if(pInputData)
-			pLocalChar->OnDirectInput(pInputData);
-		if(pDummyInputData && !DummyFirst)
-			pDummyChar->OnDirectInput(pDummyInputData);
-		m_PredictedWorld.m_GameTick = Tick;
-		if(pInputData)
-			pLocalChar->OnPredictedInput(pInputData);
-		if(pDummyInputData)
-			pDummyChar->OnPredictedInput(pDummyInputData);
-		m_PredictedWorld.Tick();
+		if(pWorld == &m_CachedPredictedWorld)
+		{
+			m_PredictionCache.m_aInputs[Tick % CPredictionCache::NUM_INPUTS].Set((CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping));
+			m_PredictionCache.m_aDummyInputs[Tick % CPredictionCache::NUM_INPUTS].Set(!pDummyChar ? 0 : (CNetObj_PlayerInput *)Client()->GetInput(Tick, m_IsDummySwapping ^ 1));
+			m_PredictionCache.m_Tick = Tick;
+		}
+
+		PredictTick(pWorld, Tick, FinalTick, FreezeTick, pLocalChar, pDummyChar);
 
 		// fetch the current characters
 		if(Tick == FinalTick)
 		{
 			m_PredictedChar = pLocalChar->GetCore();
 		}
-		if(Tick == FinalTick - std::max(g_Config.m_ClFastInput - g_Config.m_ClFastInputOthers, 0)) 
+		if(Tick == OthersTick)
 		{
 			for(int i = 0; i < MAX_CLIENTS; i++)
 				if(CCharacter *pChar = m_PredictedWorld.GetCharacterById(i))
@@ -2252,7 +2418,7 @@ void CGameClient::OnPredict()
 		}
 
 		for(int i = 0; i < MAX_CLIENTS; i++)
-			if(CCharacter *pChar = m_PredictedWorld.GetCharacterById(i))
+			if(CCharacter *pChar = pWorld->GetCharacterById(i))
 			{
 				m_aClients[i].m_aPredPos[Tick % 200] = pChar->Core()->m_Pos;
 				m_aClients[i].m_aPredTick[Tick % 200] = Tick;
@@ -2295,6 +2461,15 @@ void CGameClient::OnPredict()
 	if(g_Config.m_ClFastInput)
 		m_PredictedWorld.CopyWorld(&m_PrevPredictedWorld);
 
+#ifdef CONF_DEBUG
+	if(g_Config.m_DbgPredictionCache && CacheValid)
+		CheckPredictionCache(FinalTick, OthersTick, FreezeTick);
+#endif
+
+	const float PredictTime = (time_get() - PredictStart) / (float)time_freq();
+	m_PredictedTicksAvg = m_PredictedTicksAvg * 0.9f + (FinalTick - FirstTick + 1) * 0.1f;
+	m_PredictTimeAvg = m_PredictTimeAvg * 0.9f + PredictTime * 0.1f;
+
 	if(g_Config.m_ClRemoveAnti)
 	{
 		m_ExtraPredictedWorld.CopyWorld(&m_PredictedWorld);
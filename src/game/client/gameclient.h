@@ -297,6 +297,10 @@ public:
 	}
 	const char *NetobjCorrectedOn() { return m_NetObjHandler.CorrectedObjOn(); }
 
+	// average number of ticks simulated and time in seconds spent per prediction
+	float PredictedTicksAvg() const { return m_PredictedTicksAvg; }
+	float PredictTimeAvg() const { return m_PredictTimeAvg; }
+
 	bool m_SuppressEvents;
 	bool m_NewTick;
 	bool m_NewPredictedTick;
@@ -608,9 +612,15 @@ public:
 	void FormatClientId(int ClientId, char (&aClientId)[16], EClientIdFormat Format) const;
 
 	CGameWorld m_GameWorld;
+	// m_GameWorld advanced by the ticks that are kept across frames, see CPredictionCache
+	CGameWorld m_CachedPredictedWorld;
 	CGameWorld m_PredictedWorld;
 	CGameWorld m_PrevPredictedWorld;
 	CGameWorld m_ExtraPredictedWorld;
+#ifdef CONF_DEBUG
+	// predicted without the cache for dbg_prediction_cache
+	CGameWorld m_DebugPredictedWorld;
+#endif
 
 	std::vector<SSwitchers> &Switchers() { return m_GameWorld.m_Core.m_vSwitchers; }
 	std::vector<SSwitchers> &PredSwitchers() { return m_PredictedWorld.m_Core.m_vSwitchers; }
@@ -817,6 +827,55 @@ private:
 	void UpdatePrediction();
 	void UpdateRenderedCharacters();
 
+	// The ticks from the last snapshot up to shortly before the predicted tick
+	// only depend on the snapshot and on inputs that were already sent. They
+	// are simulated once in m_CachedPredictedWorld and the following frames
+	// continue from there, until a new snapshot arrives, m_GameWorld is
+	// modified or one of the inputs of those ticks changes.
+	class CPredictionCache
+	{
+	public:
+		enum
+		{
+			// same as the input history of the client
+			NUM_INPUTS = 200,
+		};
+
+		class CInput
+		{
+		public:
+			bool m_Valid;
+			CNetObj_PlayerInput m_Input;
+
+			void Set(const CNetObj_PlayerInput *pInput);
+			bool Matches(const CNetObj_PlayerInput *pInput) const;
+		};
+
+		int m_GameTick;
+		int m_PredGameTick;
+		// last tick simulated in m_CachedPredictedWorld
+		int m_Tick;
+		int m_Dummy;
+		int m_IsDummySwapping;
+		int m_LocalClientId;
+		int m_DummyId;
+		bool m_HasDummyChar;
+		CInput m_aInputs[NUM_INPUTS];
+		CInput m_aDummyInputs[NUM_INPUTS];
+	};
+	CPredictionCache m_PredictionCache;
+	bool PredictionCacheValid(int CacheTick);
+	// removes the entities that aren't predicted from a copy of m_GameWorld
+	void RemoveUnpredicted(CGameWorld *pWorld);
+	// applies the inputs of the tick to the local characters and ticks the world
+	void PredictTick(CGameWorld *pWorld, int Tick, int FinalTick, int FreezeTick, CCharacter *pLocalChar, CCharacter *pDummyChar);
+#ifdef CONF_DEBUG
+	void CheckPredictionCache(int FinalTick, int OthersTick, int FreezeTick);
+#endif
+
+	float m_PredictedTicksAvg;
+	float m_PredictTimeAvg;
+
 	int m_aLastUpdateTick[MAX_CLIENTS] = {0};
 	void DetectStrongHook();
 
@@ -3,15 +3,19 @@
 #ifndef GAME_CLIENT_PREDICTION_ENTITY_H
 #define GAME_CLIENT_PREDICTION_ENTITY_H
 
+#include <base/system.h>
 #include <base/vmath.h>
 
-#include <game/alloc.h>
-
+#include "entity_pool.h"
 #include "gameworld.h"
 
 class CEntity
 {
-	MACRO_ALLOC_HEAP()
+public:
+	// entities live in the pool of their world: `new(pGameWorld) CProjectile(...)`
+	void *operator new(size_t Size, CGameWorld *pGameWorld) { return pGameWorld->EntityPool()->Allocate(Size); }
+	void operator delete(void *pPtr, CGameWorld *pGameWorld) { CEntityPool::Free(pPtr); }
+	void operator delete(void *pPtr) { CEntityPool::Free(pPtr); }
 
 private:
 	friend CGameWorld; // entity list handling
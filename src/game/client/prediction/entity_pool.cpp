@@ -0,0 +1,104 @@
+#include "entity_pool.h"
+
+#include <base/math.h>
+#include <base/system.h>
+
+#include <game/alloc.h>
+
+static size_t AlignSize(size_t Size)
+{
+	const size_t Alignment = alignof(std::max_align_t);
+	return (Size + Alignment - 1) & ~(Alignment - 1);
+}
+
+CEntityPool::CEntityPool()
+{
+	m_NumSizeClasses = 0;
+	m_pFirstChunk = nullptr;
+	m_NumUsed = 0;
+	m_NumAllocations = 0;
+	m_NumChunkAllocations = 0;
+}
+
+CEntityPool::~CEntityPool()
+{
+	dbg_assert(m_NumUsed == 0, "entities outlive their pool");
+	while(m_pFirstChunk)
+	{
+		CChunk *pNext = m_pFirstChunk->m_pNext;
+		ASAN_UNPOISON_MEMORY_REGION(m_pFirstChunk, AlignSize(sizeof(CChunk)) + m_pFirstChunk->m_Size);
+		free(m_pFirstChunk);
+		m_pFirstChunk = pNext;
+	}
+}
+
+void *CEntityPool::AllocateFromChunk(size_t Size)
+{
+	Size = AlignSize(Size);
+	if(!m_pFirstChunk || m_pFirstChunk->m_Used + Size > m_pFirstChunk->m_Size)
+	{
+		// the rest of the previous chunk stays unused
+		const size_t ChunkSize = maximum(Size, (size_t)CHUNK_SIZE);
+		CChunk *pChunk = static_cast<CChunk *>(malloc(AlignSize(sizeof(CChunk)) + ChunkSize));
+		pChunk->m_pNext = m_pFirstChunk;
+		pChunk->m_Size = ChunkSize;
+		pChunk->m_Used = 0;
+		m_pFirstChunk = pChunk;
+		m_NumChunkAllocations++;
+	}
+	void *pData = (char *)m_pFirstChunk + AlignSize(sizeof(CChunk)) + m_pFirstChunk->m_Used;
+	m_pFirstChunk->m_Used += Size;
+	return pData;
+}
+
+void *CEntityPool::Allocate(size_t Size)
+{
+	CSizeClass *pSizeClass = nullptr;
+	for(int i = 0; i < m_NumSizeClasses; i++)
+	{
+		if(m_aSizeClasses[i].m_Size == Size)
+		{
+			pSizeClass = &m_aSizeClasses[i];
+			break;
+		}
+	}
+	if(!pSizeClass)
+	{
+		dbg_assert(m_NumSizeClasses < MAX_SIZE_CLASSES, "too many entity sizes");
+		pSizeClass = &m_aSizeClasses[m_NumSizeClasses++];
+		pSizeClass->m_pPool = this;
+		pSizeClass->m_Size = Size;
+		pSizeClass->m_pFirstFree = nullptr;
+	}
+
+	CHeader *pHeader = pSizeClass->m_pFirstFree;
+	if(pHeader)
+	{
+		pSizeClass->m_pFirstFree = pHeader->m_pNextFree;
+		ASAN_UNPOISON_MEMORY_REGION(pHeader + 1, Size);
+	}
+	else
+	{
+		pHeader = static_cast<CHeader *>(AllocateFromChunk(sizeof(CHeader) + Size));
+	}
+	pHeader->m_pSizeClass = pSizeClass;
+	pHeader->m_pNextFree = nullptr;
+	m_NumUsed++;
+	m_NumAllocations++;
+
+	void *pData = pHeader + 1;
+	mem_zero(pData, Size);
+	return pData;
+}
+
+void CEntityPool::Free(void *pData)
+{
+	if(!pData)
+		return;
+	CHeader *pHeader = static_cast<CHeader *>(pData) - 1;
+	CSizeClass *pSizeClass = pHeader->m_pSizeClass;
+	pHeader->m_pNextFree = pSizeClass->m_pFirstFree;
+	pSizeClass->m_pFirstFree = pHeader;
+	pSizeClass->m_pPool->m_NumUsed--;
+	ASAN_POISON_MEMORY_REGION(pData, pSizeClass->m_Size);
+}
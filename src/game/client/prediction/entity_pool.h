@@ -0,0 +1,72 @@
+#ifndef GAME_CLIENT_PREDICTION_ENTITY_POOL_H
+#define GAME_CLIENT_PREDICTION_ENTITY_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Memory of the entities of one prediction world. The prediction worlds are
+// copied several times per frame, which used to allocate every entity anew.
+// Destroyed entities are put into a free list per entity size and new ones
+// are carved out of large chunks, so once a world has grown to its usual
+// size, copying it doesn't touch the heap anymore.
+class CEntityPool
+{
+	class CChunk
+	{
+	public:
+		CChunk *m_pNext;
+		size_t m_Size;
+		size_t m_Used;
+	};
+
+	class CSizeClass;
+
+	// placed in front of every entity
+	class alignas(std::max_align_t) CHeader
+	{
+	public:
+		CSizeClass *m_pSizeClass;
+		CHeader *m_pNextFree;
+	};
+
+	class CSizeClass
+	{
+	public:
+		CEntityPool *m_pPool;
+		size_t m_Size;
+		CHeader *m_pFirstFree;
+	};
+
+	enum
+	{
+		CHUNK_SIZE = 64 * 1024,
+		// one for every entity class
+		MAX_SIZE_CLASSES = 8,
+	};
+
+	CSizeClass m_aSizeClasses[MAX_SIZE_CLASSES];
+	int m_NumSizeClasses;
+	CChunk *m_pFirstChunk;
+	int m_NumUsed;
+
+	int64_t m_NumAllocations;
+	int64_t m_NumChunkAllocations;
+
+	void *AllocateFromChunk(size_t Size);
+
+public:
+	CEntityPool();
+	~CEntityPool();
+	CEntityPool(const CEntityPool &) = delete;
+	CEntityPool &operator=(const CEntityPool &) = delete;
+
+	// returns zeroed memory, like the heap allocation of the entities did
+	void *Allocate(size_t Size);
+	static void Free(void *pData);
+
+	int NumUsed() const { return m_NumUsed; }
+	int64_t NumAllocations() const { return m_NumAllocations; }
+	int64_t NumChunkAllocations() const { return m_NumChunkAllocations; }
+};
+
+#endif
@@ -29,6 +29,7 @@ CGameWorld::CGameWorld()
 	m_GameTick = 0;
 	m_pParent = 0;
 	m_pChild = 0;
+	m_Core.m_UseBroadphase = true;
 }
 
 CGameWorld::~CGameWorld()
@@ -145,8 +146,14 @@ void CGameWorld::RemoveEntity(CEntity *pEnt)
 
 	if(pEnt->m_pParent)
 	{
-		if(m_IsValidCopy && m_pParent && m_pParent->m_pChild == this)
-			pEnt->m_pParent->m_DestroyTick = GameTick();
+		// the parent world can be a copy as well (e.g. the cached prediction),
+		// pass the tick up to the entity of the world everything came from
+		const CGameWorld *pWorld = this;
+		for(CEntity *pParent = pEnt->m_pParent; pParent && pWorld->m_IsValidCopy && pWorld->m_pParent && pWorld->m_pParent->m_pChild == pWorld; pParent = pParent->m_pParent)
+		{
+			pParent->m_DestroyTick = GameTick();
+			pWorld = pWorld->m_pParent;
+		}
 		pEnt->m_pParent->m_pChild = nullptr;
 		pEnt->m_pParent = nullptr;
 	}
@@ -184,6 +191,9 @@ void CGameWorld::RemoveEntities()
 
 void CGameWorld::Tick()
 {
+	if(m_Core.m_UseBroadphase)
+		m_Core.UpdateBroadphase();
+
 	// update all objects
 	for(int i = 0; i < NUM_ENTTYPES; i++)
 	{
@@ -205,6 +215,9 @@ void CGameWorld::Tick()
 		{
 			m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
 			pEnt->Tick();
+			// characters can teleport during their tick
+			if(i == ENTTYPE_CHARACTER && m_Core.m_UseBroadphase)
+				m_Core.UpdateBroadphase(((CCharacter *)pEnt)->GetCid());
 			pEnt = m_pNextTraverseEntity;
 		}
 	}
@@ -401,7 +414,7 @@ void CGameWorld::NetCharAdd(int ObjId, CNetObj_Character *pCharObj, CNetObj_DDNe
 		}
 		else
 		{
-			pChar = new CCharacter(this, ObjId, pCharObj, pExtended);
+			pChar = new(this) CCharacter(this, ObjId, pCharObj, pExtended);
 			InsertEntity(pChar);
 		}
 
@@ -467,7 +480,7 @@ void CGameWorld::NetObjAdd(int ObjId, int ObjType, const void *pObjData, const C
 					NetProj.m_Owner = pClosest->m_Id;
 			}
 		}
-		CProjectile *pProj = new CProjectile(NetProj);
+		CProjectile *pProj = new(this) CProjectile(NetProj);
 		InsertEntity(pProj);
 	}
 	else if((ObjType == NETOBJTYPE_PICKUP || ObjType == NETOBJTYPE_DDNETPICKUP) && m_WorldConfig.m_PredictWeapons)
@@ -483,7 +496,7 @@ void CGameWorld::NetObjAdd(int ObjId, int ObjType, const void *pObjData, const C
 				return;
 			}
 		}
-		CEntity *pEnt = new CPickup(NetPickup);
+		CEntity *pEnt = new(this) CPickup(NetPickup);
 		InsertEntity(pEnt, true);
 	}
 	else if((ObjType == NETOBJTYPE_LASER || ObjType == NETOBJTYPE_DDNETLASER) && m_WorldConfig.m_PredictWeapons)
@@ -537,7 +550,7 @@ void CGameWorld::NetObjAdd(int ObjId, int ObjType, const void *pObjData, const C
 					pDragger->Read(&Data);
 					return;
 				}
-				CEntity *pEnt = new CDragger(NetDragger);
+				CEntity *pEnt = new(this) CDragger(NetDragger);
 				InsertEntity(pEnt);
 			}
 		}
@@ -613,15 +626,15 @@ void CGameWorld::CopyWorld(CGameWorld *pFrom)
 		{
 			CEntity *pCopy = 0;
 			if(Type == ENTTYPE_PROJECTILE)
-				pCopy = new CProjectile(*((CProjectile *)pEnt));
+				pCopy = new(this) CProjectile(*((CProjectile *)pEnt));
 			else if(Type == ENTTYPE_LASER)
-				pCopy = new CLaser(*((CLaser *)pEnt));
+				pCopy = new(this) CLaser(*((CLaser *)pEnt));
 			else if(Type == ENTTYPE_DRAGGER)
-				pCopy = new CDragger(*((CDragger *)pEnt));
+				pCopy = new(this) CDragger(*((CDragger *)pEnt));
 			else if(Type == ENTTYPE_CHARACTER)
-				pCopy = new CCharacter(*((CCharacter *)pEnt));
+				pCopy = new(this) CCharacter(*((CCharacter *)pEnt));
 			else if(Type == ENTTYPE_PICKUP)
-				pCopy = new CPickup(*((CPickup *)pEnt));
+				pCopy = new(this) CPickup(*((CPickup *)pEnt));
 			if(pCopy)
 			{
 				pCopy->m_pParent = pEnt;
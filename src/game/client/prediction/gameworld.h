@@ -3,6 +3,8 @@
 #ifndef GAME_CLIENT_PREDICTION_GAMEWORLD_H
 #define GAME_CLIENT_PREDICTION_GAMEWORLD_H
 
+#include "entity_pool.h"
+
 #include <game/gamecore.h>
 #include <game/teamscore.h>
 
@@ -103,9 +105,14 @@ public:
 	CTuningParams *TuningList() { return m_pTuningList; }
 	CTuningParams *GetTuning(int i) { return &TuningList()[i]; }
 
+	CEntityPool *EntityPool() { return &m_EntityPool; }
+
 private:
 	void RemoveEntities();
 
+	// destroyed after `Clear` in the destructor removed all entities
+	CEntityPool m_EntityPool;
+
 	CEntity *m_pNextTraverseEntity = nullptr;
 	CEntity *m_apFirstEntityTypes[NUM_ENTTYPES];
 
@@ -102,18 +102,15 @@ bool CRaceHelper::IsStart(vec2 Prev, vec2 Pos) const
 	}
 	else
 	{
-		std::vector<int> vIndices = m_pGameClient->Collision()->GetMapIndices(Prev, Pos);
-		if(!vIndices.empty())
-		{
-			for(const int Index : vIndices)
-			{
-				if(m_pGameClient->Collision()->GetTileIndex(Index) == TILE_START)
-					return true;
-				if(m_pGameClient->Collision()->GetFTileIndex(Index) == TILE_START)
-					return true;
-			}
-		}
-		else
+		const CCollision *pCollision = m_pGameClient->Collision();
+		bool Start = false;
+		const bool FoundTiles = pCollision->VisitMapIndices(Prev, Pos, [&](int Index) {
+			Start = pCollision->GetTileIndex(Index) == TILE_START || pCollision->GetFTileIndex(Index) == TILE_START;
+			return !Start;
+		});
+		if(Start)
+			return true;
+		if(!FoundTiles)
 		{
 			const int Index = m_pGameClient->Collision()->GetPureMapIndex(Pos);
 			if(m_pGameClient->Collision()->GetTileIndex(Index) == TILE_START)
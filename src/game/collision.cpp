@@ -146,6 +146,12 @@ void CCollision::Init(class CLayers *pLayers)
 			}
 		}
 	}
+
+	m_vTileInfo.resize((size_t)m_Width * m_Height);
+	for(int i = 0; i < m_Width * m_Height; i++)
+		UpdateTileInfo(i);
+
+	InitEmptyDistance();
 }
 
 void CCollision::Unload()
@@ -161,6 +167,8 @@ void CCollision::Unload()
 	m_TeleOuts.clear();
 	m_TeleCheckOuts.clear();
 	m_TeleOthers.clear();
+	m_vTileInfo.clear();
+	m_vEmptyDistance.clear();
 
 	m_pTele = nullptr;
 	m_pSpeedup = nullptr;
@@ -186,6 +194,135 @@ void CCollision::FillAntibot(CAntibotMapData *pMapData) const
 	}
 }
 
+static bool IsStopper(int Tile)
+{
+	return Tile == TILE_STOP || Tile == TILE_STOPS || Tile == TILE_STOPA;
+}
+
+void CCollision::UpdateTileInfo(int Index)
+{
+	int Info = 0;
+	if(m_pTiles[Index].m_Index)
+		Info |= TILEINFO_GAME;
+	if(m_pFront && m_pFront[Index].m_Index)
+		Info |= TILEINFO_FRONT;
+	if(IsStopper(m_pTiles[Index].m_Index) || (m_pFront && IsStopper(m_pFront[Index].m_Index)))
+		Info |= TILEINFO_STOPPER;
+	if(m_pTele && m_pTele[Index].m_Type)
+		Info |= TILEINFO_TELE;
+	if(m_pSpeedup && m_pSpeedup[Index].m_Force > 0)
+		Info |= TILEINFO_SPEEDUP;
+	if(m_pSwitch && m_pSwitch[Index].m_Type)
+		Info |= TILEINFO_SWITCH;
+	if(m_pTune && m_pTune[Index].m_Type)
+		Info |= TILEINFO_TUNE;
+	m_vTileInfo[Index] = Info;
+}
+
+bool CCollision::IsLineStop(int Index) const
+{
+	// everything any of the Intersect* functions except `IntersectAir` checks
+	const int Tile = m_pTiles[Index].m_Index;
+	if(Tile == TILE_SOLID || Tile == TILE_NOHOOK || Tile == TILE_NOLASER || Tile == TILE_THROUGH_ALL || Tile == TILE_THROUGH_DIR)
+		return true;
+	if(m_pFront)
+	{
+		const int FTile = m_pFront[Index].m_Index;
+		if(FTile == TILE_NOLASER || FTile == TILE_THROUGH_ALL || FTile == TILE_THROUGH_DIR)
+			return true;
+	}
+	return m_pTele && m_pTele[Index].m_Type;
+}
+
+void CCollision::InitEmptyDistance()
+{
+	m_vEmptyDistance.resize((size_t)m_Width * m_Height);
+
+	// two pass distance transform, with the diagonal neighbours it yields
+	// the exact Chebyshev distance
+	for(int y = 0; y < m_Height; y++)
+	{
+		for(int x = 0; x < m_Width; x++)
+		{
+			const int Index = y * m_Width + x;
+			if(IsLineStop(Index))
+			{
+				m_vEmptyDistance[Index] = 0;
+				continue;
+			}
+			int Distance = EMPTY_DISTANCE_MAX;
+			if(x > 0)
+				Distance = minimum(Distance, m_vEmptyDistance[Index - 1] + 1);
+			if(y > 0)
+			{
+				for(int dx = maximum(x - 1, 0); dx <= minimum(x + 1, m_Width - 1); dx++)
+					Distance = minimum(Distance, m_vEmptyDistance[Index - m_Width - x + dx] + 1);
+			}
+			m_vEmptyDistance[Index] = Distance;
+		}
+	}
+	for(int y = m_Height - 1; y >= 0; y--)
+	{
+		for(int x = m_Width - 1; x >= 0; x--)
+		{
+			const int Index = y * m_Width + x;
+			int Distance = m_vEmptyDistance[Index];
+			if(x < m_Width - 1)
+				Distance = minimum(Distance, m_vEmptyDistance[Index + 1] + 1);
+			if(y < m_Height - 1)
+			{
+				for(int dx = maximum(x - 1, 0); dx <= minimum(x + 1, m_Width - 1); dx++)
+					Distance = minimum(Distance, m_vEmptyDistance[Index + m_Width - x + dx] + 1);
+			}
+			m_vEmptyDistance[Index] = Distance;
+		}
+	}
+}
+
+void CCollision::UpdateEmptyDistance(int Index)
+{
+	// distances only need to shrink around new stops, keeping them for
+	// removed ones is less effective but still correct
+	if(m_vEmptyDistance.empty() || !IsLineStop(Index))
+		return;
+
+	const int TileX = Index % m_Width;
+	const int TileY = Index / m_Width;
+	for(int y = maximum(TileY - EMPTY_DISTANCE_MAX, 0); y <= minimum(TileY + EMPTY_DISTANCE_MAX, m_Height - 1); y++)
+	{
+		for(int x = maximum(TileX - EMPTY_DISTANCE_MAX, 0); x <= minimum(TileX + EMPTY_DISTANCE_MAX, m_Width - 1); x++)
+		{
+			unsigned char &Distance = m_vEmptyDistance[y * m_Width + x];
+			Distance = minimum<int>(Distance, maximum(absolute(x - TileX), absolute(y - TileY)));
+		}
+	}
+}
+
+int CCollision::EmptySteps(int x, int y) const
+{
+	if(x < 0 || y < 0 || x >= m_Width * 32 || y >= m_Height * 32)
+		return 0;
+
+	const int TileX = x / 32;
+	const int TileY = y / 32;
+	const int Distance = m_vEmptyDistance[TileY * m_Width + TileX];
+	if(Distance == 0)
+		return 0;
+
+	// all pixels of tiles closer than `Distance` are empty
+	const int MinX = maximum(TileX - Distance + 1, 0) * 32;
+	const int MaxX = minimum(TileX + Distance, m_Width) * 32 - 1;
+	const int MinY = maximum(TileY - Distance + 1, 0) * 32;
+	const int MaxY = minimum(TileY + Distance, m_Height) * 32 - 1;
+	const int Margin = minimum(minimum(x - MinX, MaxX - x), minimum(y - MinY, MaxY - y));
+
+	// steps are at most a pixel long, after n steps the rounded position
+	// moved at most n + 1 pixels on each axis. Keep another pixel for float
+	// imprecision and leave the last empty step to the caller, so it can
+	// remember that position.
+	return maximum(Margin - 3, 0);
+}
+
 enum
 {
 	MR_DIR_HERE = 0,
@@ -282,21 +419,24 @@ int CCollision::GetMoveRestrictions(CALLBACK_SWITCHACTIVE pfnSwitchActive, void
 		{
 			ModMapIndex = OverrideCenterTileIndex;
 		}
-		for(int Front = 0; Front < 2; Front++)
+		if(GetTileInfo(ModMapIndex) & TILEINFO_STOPPER)
 		{
-			int Tile;
-			int Flags;
-			if(!Front)
-			{
-				Tile = GetTileIndex(ModMapIndex);
-				Flags = GetTileFlags(ModMapIndex);
-			}
-			else
+			for(int Front = 0; Front < 2; Front++)
 			{
-				Tile = GetFTileIndex(ModMapIndex);
-				Flags = GetFTileFlags(ModMapIndex);
+				int Tile;
+				int Flags;
+				if(!Front)
+				{
+					Tile = GetTileIndex(ModMapIndex);
+					Flags = GetTileFlags(ModMapIndex);
+				}
+				else
+				{
+					Tile = GetFTileIndex(ModMapIndex);
+					Flags = GetFTileFlags(ModMapIndex);
+				}
+				Restrictions |= ::GetMoveRestrictions(d, Tile, Flags);
 			}
-			Restrictions |= ::GetMoveRestrictions(d, Tile, Flags);
 		}
 		if(pfnSwitchActive)
 		{
@@ -350,6 +490,8 @@ int CCollision::IntersectLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *p
 		}
 
 		Last = Pos;
+		// nothing to hit until the line gets close to a non-empty tile
+		i += EmptySteps(ix, iy);
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -410,6 +552,8 @@ int CCollision::IntersectLineTeleHook(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision,
 		}
 
 		Last = Pos;
+		// nothing to hit until the line gets close to a non-empty tile
+		i += EmptySteps(ix, iy);
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -458,6 +602,8 @@ int CCollision::IntersectLineTeleWeapon(vec2 Pos0, vec2 Pos1, vec2 *pOutCollisio
 		}
 
 		Last = Pos;
+		// nothing to hit until the line gets close to a non-empty tile
+		i += EmptySteps(ix, iy);
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -916,48 +1062,6 @@ int CCollision::GetMapIndex(vec2 Pos) const
 		return -1;
 }
 
-std::vector<int> CCollision::GetMapIndices(vec2 PrevPos, vec2 Pos, unsigned MaxIndices) const
-{
-	std::vector<int> vIndices;
-	float d = distance(PrevPos, Pos);
-	int End(d + 1);
-	if(!d)
-	{
-		int Nx = clamp((int)Pos.x / 32, 0, m_Width - 1);
-		int Ny = clamp((int)Pos.y / 32, 0, m_Height - 1);
-		int Index = Ny * m_Width + Nx;
-
-		if(TileExists(Index))
-		{
-			vIndices.push_back(Index);
-			return vIndices;
-		}
-		else
-			return vIndices;
-	}
-	else
-	{
-		int LastIndex = 0;
-		for(int i = 0; i < End; i++)
-		{
-			float a = i / d;
-			vec2 Tmp = mix(PrevPos, Pos, a);
-			int Nx = clamp((int)Tmp.x / 32, 0, m_Width - 1);
-			int Ny = clamp((int)Tmp.y / 32, 0, m_Height - 1);
-			int Index = Ny * m_Width + Nx;
-			if(TileExists(Index) && LastIndex != Index)
-			{
-				if(MaxIndices && vIndices.size() > MaxIndices)
-					return vIndices;
-				vIndices.push_back(Index);
-				LastIndex = Index;
-			}
-		}
-
-		return vIndices;
-	}
-}
-
 vec2 CCollision::GetPos(int Index) const
 {
 	if(Index < 0)
@@ -1084,6 +1188,8 @@ void CCollision::SetCollisionAt(float x, float y, int Index)
 	int Ny = clamp(round_to_int(y) / 32, 0, m_Height - 1);
 
 	m_pTiles[Ny * m_Width + Nx].m_Index = Index;
+	UpdateTileInfo(Ny * m_Width + Nx);
+	UpdateEmptyDistance(Ny * m_Width + Nx);
 }
 
 void CCollision::SetDCollisionAt(float x, float y, int Type, int Flags, int Number)
@@ -1176,6 +1282,8 @@ int CCollision::IntersectNoLaser(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2
 				return GetCollisionAt(Pos.x, Pos.y);
 		}
 		Last = Pos;
+		// nothing to hit until the line gets close to a non-empty tile
+		i += EmptySteps(round_to_int(Pos.x), round_to_int(Pos.y));
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -1205,6 +1313,8 @@ int CCollision::IntersectNoLaserNW(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, ve
 				return GetFCollisionAt(Pos.x, Pos.y);
 		}
 		Last = Pos;
+		// nothing to hit until the line gets close to a non-empty tile
+		i += EmptySteps(round_to_int(Pos.x), round_to_int(Pos.y));
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -25,6 +25,18 @@ enum
 	CANTMOVE_DOWN = 1 << 3,
 };
 
+enum
+{
+	// what a map tile contains, see `CCollision::GetTileInfo`
+	TILEINFO_GAME = 1 << 0,
+	TILEINFO_FRONT = 1 << 1,
+	TILEINFO_TELE = 1 << 2,
+	TILEINFO_SPEEDUP = 1 << 3,
+	TILEINFO_SWITCH = 1 << 4,
+	TILEINFO_TUNE = 1 << 5,
+	TILEINFO_STOPPER = 1 << 6, // in the game or front layer
+};
+
 vec2 ClampVel(int MoveRestriction, vec2 Vel);
 
 typedef bool (*CALLBACK_SWITCHACTIVE)(int Number, void *pUser);
@@ -72,12 +84,67 @@ public:
 		return GetMoveRestrictions(nullptr, nullptr, Pos, Distance);
 	}
 
+	/**
+	 * Summarizes all layers of a tile, so that tiles without anything
+	 * special need only one lookup.
+	 *
+	 * @param Index The map index.
+	 *
+	 * @return The `TILEINFO_*` flags of the layers that contain something at `Index`.
+	 */
+	int GetTileInfo(int Index) const { return Index < 0 ? 0 : m_vTileInfo[Index]; }
+
 	int GetTile(int x, int y) const;
 	int GetFTile(int x, int y) const;
 	int Entity(int x, int y, int Layer) const;
 	int GetPureMapIndex(float x, float y) const;
 	int GetPureMapIndex(vec2 Pos) const { return GetPureMapIndex(Pos.x, Pos.y); }
-	std::vector<int> GetMapIndices(vec2 PrevPos, vec2 Pos, unsigned MaxIndices = 0) const;
+
+	/**
+	 * Visits the tiles on the way from `PrevPos` to `Pos` which contain
+	 * gameplay tiles, in order and without visiting the same tile twice in
+	 * a row. Doesn't allocate.
+	 *
+	 * @param Visit Called with the map index of each tile, returning `false` stops the walk.
+	 *
+	 * @return Whether there was any such tile.
+	 */
+	template<typename TVisit>
+	bool VisitMapIndices(vec2 PrevPos, vec2 Pos, TVisit &&Visit) const
+	{
+		float d = distance(PrevPos, Pos);
+		if(!d)
+		{
+			int Nx = clamp((int)Pos.x / 32, 0, m_Width - 1);
+			int Ny = clamp((int)Pos.y / 32, 0, m_Height - 1);
+			int Index = Ny * m_Width + Nx;
+			if(!TileExists(Index))
+				return false;
+			Visit(Index);
+			return true;
+		}
+
+		int End(d + 1);
+		int LastIndex = 0;
+		bool Found = false;
+		for(int i = 0; i < End; i++)
+		{
+			float a = i / d;
+			vec2 Tmp = mix(PrevPos, Pos, a);
+			int Nx = clamp((int)Tmp.x / 32, 0, m_Width - 1);
+			int Ny = clamp((int)Tmp.y / 32, 0, m_Height - 1);
+			int Index = Ny * m_Width + Nx;
+			if(TileExists(Index) && LastIndex != Index)
+			{
+				Found = true;
+				if(!Visit(Index))
+					return true;
+				LastIndex = Index;
+			}
+		}
+		return Found;
+	}
+
 	int GetMapIndex(vec2 Pos) const;
 	bool TileExists(int Index) const;
 	bool TileExistsNext(int Index) const;
@@ -161,6 +228,21 @@ private:
 	CTuneTile *m_pTune;
 	CDoorTile *m_pDoor;
 
+	std::vector<unsigned char> m_vTileInfo;
+	void UpdateTileInfo(int Index);
+
+	enum
+	{
+		EMPTY_DISTANCE_MAX = 16,
+	};
+	// Chebyshev distance in tiles to the closest tile a line intersection
+	// can stop at, capped at `EMPTY_DISTANCE_MAX`
+	std::vector<unsigned char> m_vEmptyDistance;
+	void InitEmptyDistance();
+	void UpdateEmptyDistance(int Index);
+	bool IsLineStop(int Index) const;
+	int EmptySteps(int x, int y) const;
+
 	// TILE_TELEIN
 	std::map<int, std::vector<vec2>> m_TeleIns;
 	// TILE_TELEOUT
@@ -155,7 +155,7 @@ void CCharacterCore::Reset()
 	m_HookTick = 0;
 	m_HookState = HOOK_IDLE;
 	SetHookedPlayer(-1);
-	m_AttachedPlayers.clear();
+	m_AttachedPlayers.reset();
 	m_Jumped = 0;
 	m_JumpedTotal = 0;
 	m_Jumps = 2;
@@ -348,8 +348,11 @@ void CCharacterCore::Tick(bool UseInput, bool DoDeferredTick)
 		if(!m_HookHitDisabled && m_pWorld && m_Tuning.m_PlayerHooking && (m_HookState == HOOK_FLYING || !m_NewHook))
 		{
 			float Distance = 0.0f;
+			const CClientMask Candidates = m_pWorld->BroadphaseQuery(m_HookPos, NewPos, PhysicalSize() + 2.0f);
 			for(int i = 0; i < MAX_CLIENTS; i++)
 			{
+				if(!Candidates[i])
+					continue;
 				CCharacterCore *pCharCore = m_pWorld->m_apCharacters[i];
 				if(!pCharCore || pCharCore == this || (!(m_Super || pCharCore->m_Super) && ((m_Id != -1 && !m_pTeams->CanCollide(i, m_Id)) || pCharCore->m_Solo || m_Solo)))
 					continue;
@@ -461,8 +464,14 @@ void CCharacterCore::TickDeferred()
 {
 	if(m_pWorld)
 	{
+		// only close characters collide, the hooked one is dragged from anywhere
+		CClientMask Candidates = m_pWorld->BroadphaseQuery(m_Pos, m_Pos, PhysicalSize() * 1.25f);
+		if(m_HookedPlayer != -1)
+			Candidates.set(m_HookedPlayer);
 		for(int i = 0; i < MAX_CLIENTS; i++)
 		{
+			if(!Candidates[i])
+				continue;
 			CCharacterCore *pCharCore = m_pWorld->m_apCharacters[i];
 			if(!pCharCore)
 				continue;
@@ -564,7 +573,9 @@ void CCharacterCore::Move()
 
 	if(m_pWorld && (m_Super || (m_Tuning.m_PlayerCollision && !m_CollisionDisabled && !m_Solo)))
 	{
-		// check player collision
+		// check player collision, with all characters: the characters move
+		// one after another (or on the team threads) during the deferred
+		// tick, the broadphase only knows their positions from the tick
 		float Distance = distance(m_Pos, NewPos);
 		if(Distance > 0)
 		{
@@ -708,7 +719,7 @@ void CCharacterCore::SetHookedPlayer(int HookedPlayer)
 			CCharacterCore *pCharCore = m_pWorld->m_apCharacters[m_HookedPlayer];
 			if(pCharCore)
 			{
-				pCharCore->m_AttachedPlayers.erase(m_Id);
+				pCharCore->m_AttachedPlayers.reset(m_Id);
 			}
 		}
 		if(HookedPlayer != -1 && m_Id != -1 && m_pWorld)
@@ -716,7 +727,7 @@ void CCharacterCore::SetHookedPlayer(int HookedPlayer)
 			CCharacterCore *pCharCore = m_pWorld->m_apCharacters[HookedPlayer];
 			if(pCharCore)
 			{
-				pCharCore->m_AttachedPlayers.insert(m_Id);
+				pCharCore->m_AttachedPlayers.set(m_Id);
 			}
 		}
 		m_HookedPlayer = HookedPlayer;
@@ -758,3 +769,93 @@ void CWorldCore::InitSwitchers(int HighestSwitchNumber)
 		}
 	}
 }
+
+bool CWorldCore::BroadphaseCell(vec2 Pos, int *pX, int *pY)
+{
+	// also false for NaN
+	const float Limit = 1e7f;
+	if(!(Pos.x > -Limit && Pos.x < Limit && Pos.y > -Limit && Pos.y < Limit))
+		return false;
+	*pX = (int)std::floor(Pos.x / BROADPHASE_CELL_SIZE);
+	*pY = (int)std::floor(Pos.y / BROADPHASE_CELL_SIZE);
+	return true;
+}
+
+int CWorldCore::BroadphaseBucket(int X, int Y)
+{
+	return (((unsigned)X * 73856093u) ^ ((unsigned)Y * 19349663u)) % NUM_BROADPHASE_BUCKETS;
+}
+
+void CWorldCore::UpdateBroadphase()
+{
+	for(int i = 0; i < MAX_CLIENTS; i++)
+		UpdateBroadphase(i);
+}
+
+void CWorldCore::UpdateBroadphase(int ClientId)
+{
+	const CCharacterCore *pCharacter = m_apCharacters[ClientId];
+	if(pCharacter == m_apBroadphaseCharacters[ClientId] && (!pCharacter || pCharacter->m_Pos == m_aBroadphasePos[ClientId]))
+		return;
+
+	int Bucket = BROADPHASE_BUCKET_NONE;
+	if(pCharacter)
+	{
+		int X, Y;
+		Bucket = BroadphaseCell(pCharacter->m_Pos, &X, &Y) ? BroadphaseBucket(X, Y) : (int)BROADPHASE_BUCKET_FAR;
+		m_aBroadphasePos[ClientId] = pCharacter->m_Pos;
+	}
+	m_apBroadphaseCharacters[ClientId] = pCharacter;
+
+	const int OldBucket = m_aBroadphaseBucket[ClientId];
+	if(Bucket == OldBucket)
+		return;
+	if(OldBucket == BROADPHASE_BUCKET_FAR)
+		m_BroadphaseFar.reset(ClientId);
+	else if(OldBucket != BROADPHASE_BUCKET_NONE)
+		m_aBroadphaseBuckets[OldBucket].reset(ClientId);
+	if(Bucket == BROADPHASE_BUCKET_FAR)
+		m_BroadphaseFar.set(ClientId);
+	else if(Bucket != BROADPHASE_BUCKET_NONE)
+		m_aBroadphaseBuckets[Bucket].set(ClientId);
+	m_BroadphaseAll.set(ClientId, Bucket != BROADPHASE_BUCKET_NONE);
+	m_aBroadphaseBucket[ClientId] = Bucket;
+}
+
+CClientMask CWorldCore::BroadphaseQuery(vec2 From, vec2 To, float Radius) const
+{
+	if(!m_UseBroadphase)
+		return CClientMask().set();
+
+	// a little more than the radius, the exact distance checks are done
+	// with float precision
+	const float Margin = Radius + 1.0f;
+	const vec2 Min = vec2(minimum(From.x, To.x) - Margin, minimum(From.y, To.y) - Margin);
+	const vec2 Max = vec2(maximum(From.x, To.x) + Margin, maximum(From.y, To.y) + Margin);
+
+	CClientMask Result;
+	int MinX, MinY, MaxX, MaxY;
+	if(!BroadphaseCell(Min, &MinX, &MinY) || !BroadphaseCell(Max, &MaxX, &MaxY) ||
+		(int64_t)(MaxX - MinX + 1) * (MaxY - MinY + 1) > NUM_BROADPHASE_BUCKETS / 2)
+	{
+		Result = m_BroadphaseAll;
+	}
+	else
+	{
+		Result = m_BroadphaseFar;
+		for(int Y = MinY; Y <= MaxY; Y++)
+			for(int X = MinX; X <= MaxX; X++)
+				Result |= m_aBroadphaseBuckets[BroadphaseBucket(X, Y)];
+	}
+
+#ifdef CONF_DEBUG
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		const CCharacterCore *pCharacter = m_apCharacters[i];
+		if(pCharacter && pCharacter->m_Pos.x >= Min.x && pCharacter->m_Pos.x <= Max.x && pCharacter->m_Pos.y >= Min.y && pCharacter->m_Pos.y <= Max.y)
+			dbg_assert(Result[i], "broadphase missed a character, a position change wasn't reported");
+	}
+#endif
+
+	return Result;
+}
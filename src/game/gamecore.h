@@ -6,7 +6,6 @@
 #include <base/vmath.h>
 
 #include <map>
-#include <set>
 #include <vector>
 
 #include <engine/shared/protocol.h>
@@ -142,6 +141,27 @@ struct SSwitchers
 
 class CWorldCore
 {
+	// The broadphase sorts the characters into the buckets of a hashed grid,
+	// so the characters near a point can be found without looking at all of
+	// them. It is kept up to date by the game world, see `UpdateBroadphase`.
+	enum
+	{
+		BROADPHASE_CELL_SIZE = 128,
+		NUM_BROADPHASE_BUCKETS = 256,
+		BROADPHASE_BUCKET_NONE = -1,
+		BROADPHASE_BUCKET_FAR = NUM_BROADPHASE_BUCKETS, // position too far away or not finite
+	};
+
+	CClientMask m_aBroadphaseBuckets[NUM_BROADPHASE_BUCKETS];
+	CClientMask m_BroadphaseFar;
+	CClientMask m_BroadphaseAll;
+	const class CCharacterCore *m_apBroadphaseCharacters[MAX_CLIENTS];
+	vec2 m_aBroadphasePos[MAX_CLIENTS];
+	int m_aBroadphaseBucket[MAX_CLIENTS];
+
+	static bool BroadphaseCell(vec2 Pos, int *pX, int *pY);
+	static int BroadphaseBucket(int X, int Y);
+
 public:
 	CWorldCore()
 	{
@@ -150,6 +170,12 @@ public:
 			pCharacter = nullptr;
 		}
 		m_pPrng = nullptr;
+		m_UseBroadphase = false;
+		for(int i = 0; i < MAX_CLIENTS; i++)
+		{
+			m_apBroadphaseCharacters[i] = nullptr;
+			m_aBroadphaseBucket[i] = BROADPHASE_BUCKET_NONE;
+		}
 	}
 
 	int RandomOr0(int BelowThis)
@@ -170,6 +196,38 @@ public:
 
 	void InitSwitchers(int HighestSwitchNumber);
 	std::vector<SSwitchers> m_vSwitchers;
+
+	// Whether the character cores use the broadphase to find the characters
+	// they interact with. The results are exactly the same without it, the
+	// game world must call `UpdateBroadphase` when enabling it though.
+	bool m_UseBroadphase;
+
+	/**
+	 * Brings the broadphase up to date with the positions of all characters.
+	 * Must be called at the start of every tick.
+	 */
+	void UpdateBroadphase();
+
+	/**
+	 * Brings the broadphase up to date with the position of one character.
+	 * Must be called whenever a character moved during the tick, e.g. after
+	 * the character's own tick, which can teleport it.
+	 *
+	 * @param ClientId The client id of the character.
+	 */
+	void UpdateBroadphase(int ClientId);
+
+	/**
+	 * Finds the characters that may be within a distance of a line segment.
+	 *
+	 * @param From Start of the line segment.
+	 * @param To End of the line segment.
+	 * @param Radius The distance.
+	 *
+	 * @return Mask of the candidates, a superset of the characters within the
+	 * distance. All characters if the broadphase is disabled.
+	 */
+	CClientMask BroadphaseQuery(vec2 From, vec2 To, float Radius) const;
 };
 
 class CCharacterCore
@@ -188,7 +246,7 @@ public:
 	vec2 m_HookTeleBase;
 	int m_HookTick;
 	int m_HookState;
-	std::set<int> m_AttachedPlayers;
+	CClientMask m_AttachedPlayers;
 	int HookedPlayer() const { return m_HookedPlayer; }
 	void SetHookedPlayer(int HookedPlayer);
 
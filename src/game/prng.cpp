@@ -40,6 +40,33 @@ void CPrng::Seed(uint64_t aSeed[2])
 	RandomBits();
 }
 
+static bool ParseHex64(const char *pStr, uint64_t *pValue)
+{
+	*pValue = 0;
+	for(int i = 0; i < 16; i++)
+	{
+		const char c = pStr[i];
+		int Digit;
+		if(c >= '0' && c <= '9')
+			Digit = c - '0';
+		else if(c >= 'a' && c <= 'f')
+			Digit = c - 'a' + 10;
+		else
+			return false;
+		*pValue = (*pValue << 4) | Digit;
+	}
+	return true;
+}
+
+bool CPrng::ParseSeed(const char *pDescription, uint64_t aSeed[2])
+{
+	// NAME ":" 16 hex digits ":" 16 hex digits
+	const char *pSeed = str_startswith(pDescription, NAME ":");
+	if(!pSeed || str_length(pSeed) != 16 + 1 + 16 || pSeed[16] != ':')
+		return false;
+	return ParseHex64(pSeed, &aSeed[0]) && ParseHex64(pSeed + 17, &aSeed[1]);
+}
+
 unsigned int CPrng::RandomBits()
 {
 	dbg_assert(m_Seeded, "prng needs to be seeded before it can generate random numbers");
@@ -17,6 +17,11 @@ public:
 	// to be the same for the same seed.
 	void Seed(uint64_t aSeed[2]);
 
+	// Extracts the seed from a description returned by `Description()`,
+	// so that the random sequence of a recorded game can be reproduced.
+	// Returns false if the description isn't one of a seeded instance.
+	static bool ParseSeed(const char *pDescription, uint64_t aSeed[2]);
+
 	// Generates 32 random bits. `Seed()` must be called before calling
 	// this function.
 	unsigned int RandomBits();
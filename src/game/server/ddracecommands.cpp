@@ -367,7 +367,7 @@ void CGameContext::ModifyWeapons(IConsole::IResult *pResult, void *pUserData,
 void CGameContext::Teleport(CCharacter *pChr, vec2 Pos)
 {
 	pChr->SetPosition(Pos);
-	pChr->m_Pos = Pos;
+	pChr->SetPos(Pos);
 	pChr->m_PrevPos = Pos;
 	pChr->m_DDRaceState = DDRACE_CHEAT;
 }
@@ -913,6 +913,32 @@ void CGameContext::ConDumpAntibot(IConsole::IResult *pResult, void *pUserData)
 	pSelf->Antibot()->ConsoleCommand("dump");
 }
 
+void CGameContext::ConTeeHistorianStats(IConsole::IResult *pResult, void *pUserData)
+{
+	CGameContext *pSelf = (CGameContext *)pUserData;
+	pSelf->PrintTeeHistorianStats();
+}
+
+void CGameContext::ConEventStats(IConsole::IResult *pResult, void *pUserData)
+{
+	CGameContext *pSelf = (CGameContext *)pUserData;
+	if(pResult->NumArguments() > 0 && str_comp(pResult->GetString(0), "reset") == 0)
+	{
+		pSelf->m_Events.ResetStats();
+		return;
+	}
+
+	const CEventHandler::CStats &Stats = pSelf->m_Events.Stats();
+	const double NumSnapshots = maximum<int64_t>(Stats.m_NumSnapshots, 1);
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "snapshots=%" PRId64 " created=%.2f/snapshot (max %d) dropped=%" PRId64,
+		Stats.m_NumSnapshots, Stats.m_EventsCreated / NumSnapshots, Stats.m_MaxEventsCreated, Stats.m_EventsDropped);
+	pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "events", aBuf);
+	str_format(aBuf, sizeof(aBuf), "snapped=%.2f/snapshot (max %d) tested=%.2f/snapshot",
+		Stats.m_EventsSnapped / NumSnapshots, Stats.m_MaxEventsSnapped, Stats.m_EventsTested / NumSnapshots);
+	pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "events", aBuf);
+}
+
 void CGameContext::ConAntibot(IConsole::IResult *pResult, void *pUserData)
 {
 	CGameContext *pSelf = (CGameContext *)pUserData;
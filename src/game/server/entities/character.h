@@ -37,6 +37,10 @@ public:
 	void Tick() override;
 	void TickDeferred() override;
 	void TickPaused() override;
+	// the part of `TickDeferred` that only changes the character's own
+	// cores: moving it and updating the dead reckoning, may run on a
+	// worker thread next to characters of other teams
+	void MoveCore();
 	void Snap(int SnappingClient) override;
 	void PostSnap() override;
 	void SwapClients(int Client1, int Client2) override;
@@ -158,6 +162,14 @@ private:
 	CCharacterCore m_SendCore; // core that we should send
 	CCharacterCore m_ReckoningCore; // the dead reckoning core
 
+	// state of `MoveCore` for the rest of `TickDeferred`
+	bool m_CoreMoved;
+	vec2 m_MoveStartPos;
+	vec2 m_MoveStartVel;
+	bool m_StuckBefore;
+	bool m_StuckAfterMove;
+	bool m_StuckAfterQuant;
+
 	// DDRace
 
 	void SnapCharacter(int SnappingClient, int Id);
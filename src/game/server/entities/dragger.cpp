@@ -43,7 +43,7 @@ void CDragger::Tick()
 		{
 			m_Core = GameServer()->Collision()->CpSpeed(index, Flags);
 		}
-		m_Pos += m_Core;
+		SetPos(m_Pos + m_Core);
 
 		// Adopt the new position for all outgoing laser beams
 		for(auto &DraggerBeam : m_apDraggerBeam)
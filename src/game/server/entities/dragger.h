@@ -41,6 +41,7 @@ public:
 	void Reset() override;
 	void Tick() override;
 	void Snap(int SnappingClient) override;
+	bool SnapOnlyInView() const override { return true; }
 	void SwapClients(int Client1, int Client2) override;
 };
 
@@ -76,11 +76,6 @@ void CDraggerBeam::Tick()
 	}
 }
 
-void CDraggerBeam::SetPos(vec2 Pos)
-{
-	m_Pos = Pos;
-}
-
 void CDraggerBeam::Reset()
 {
 	m_MarkedForDestroy = true;
@@ -33,8 +33,6 @@ class CDraggerBeam : public CEntity
 public:
 	CDraggerBeam(CGameWorld *pGameWorld, CDragger *pDragger, vec2 Pos, float Strength, bool IgnoreWalls, int ForClientId, int Layer, int Number);
 
-	void SetPos(vec2 Pos);
-
 	void Reset() override;
 	void Tick() override;
 	void Snap(int SnappingClient) override;
@@ -40,7 +40,7 @@ void CGun::Tick()
 		{
 			m_Core = GameServer()->Collision()->CpSpeed(index, Flags);
 		}
-		m_Pos += m_Core;
+		SetPos(m_Pos + m_Core);
 	}
 	if(g_Config.m_SvPlasmaPerSec > 0)
 	{
@@ -50,7 +50,7 @@ void CPlasma::Tick()
 
 void CPlasma::Move()
 {
-	m_Pos += m_Core;
+	SetPos(m_Pos + m_Core);
 	m_Core *= PLASMA_ACCEL;
 }
 
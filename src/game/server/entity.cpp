@@ -22,6 +22,15 @@ CEntity::CEntity(CGameWorld *pGameWorld, int ObjType, vec2 Pos, int ProximityRad
 
 	m_pPrevTypeEntity = 0;
 	m_pNextTypeEntity = 0;
+
+	m_pPrevCellEntity = nullptr;
+	m_pNextCellEntity = nullptr;
+	m_GridCell = -1;
+	m_ListOrder = 0;
+
+	m_pPrevAlwaysSnapEntity = nullptr;
+	m_pNextAlwaysSnapEntity = nullptr;
+	m_SnapOnlyInView = false;
 }
 
 CEntity::~CEntity()
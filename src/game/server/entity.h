@@ -26,6 +26,18 @@ private:
 	CEntity *m_pPrevTypeEntity;
 	CEntity *m_pNextTypeEntity;
 
+	// spatial grid handling, see CEntityGrid
+	friend CEntityGrid<CEntity>;
+	CEntity *m_pPrevCellEntity;
+	CEntity *m_pNextCellEntity;
+	int m_GridCell;
+	int64_t m_ListOrder;
+
+	// snap culling handling, see CGameWorld::Snap
+	CEntity *m_pPrevAlwaysSnapEntity;
+	CEntity *m_pNextAlwaysSnapEntity;
+	bool m_SnapOnlyInView;
+
 	/* Identity */
 	CGameWorld *m_pGameWorld;
 	CCollision *m_pCCollision;
@@ -47,9 +59,22 @@ public: // TODO: Maybe make protected
 	/*
 		Variable: m_Pos
 			Contains the current posititon of the entity.
+			Use SetPos to change it, so the world can keep track of it.
 	*/
 	vec2 m_Pos;
 
+	/*
+		Function: SetPos
+			Moves the entity and updates its place in the world's
+			spatial grid.
+	*/
+	void SetPos(vec2 Pos)
+	{
+		m_Pos = Pos;
+		if(m_GridCell != -1)
+			m_pGameWorld->UpdateGridEntity(this);
+	}
+
 	/* Getters */
 	int GetId() const { return m_Id; }
 
@@ -123,6 +148,16 @@ public: // TODO: Maybe make protected
 	*/
 	virtual void Snap(int SnappingClient) {}
 
+	/*
+		Function: SnapOnlyInView
+			Tells whether Snap does nothing for clients for which
+			NetworkClipped(SnappingClient) is true. The world skips
+			such entities for clients whose view is far away without
+			calling Snap. Evaluated when the entity is inserted into
+			the world.
+	*/
+	virtual bool SnapOnlyInView() const { return false; }
+
 	/*
 		Function: PostSnap
 			Called after all clients received their snapshot.
@@ -0,0 +1,160 @@
+#ifndef GAME_SERVER_ENTITY_GRID_H
+#define GAME_SERVER_ENTITY_GRID_H
+
+#include <base/math.h>
+#include <base/vmath.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/*
+	Class: Entity Grid
+		Uniform grid over the map with one list of entities per type and
+		cell. Entities outside of the map are kept in the border cells.
+
+		The lists are linked through the entities, which need the members
+		m_ObjType, m_Pos, m_ListOrder, m_GridCell, m_pPrevCellEntity and
+		m_pNextCellEntity. m_ListOrder grows with every insertion into the
+		type list of the world, which walks the newest entity first.
+*/
+template<typename T>
+class CEntityGrid
+{
+public:
+	enum
+	{
+		CELL_SIZE = 256,
+	};
+
+private:
+	int m_Width = 0;
+	int m_Height = 0;
+	std::vector<T *> m_vpCells;
+
+	static int Coord(float Value, int Size)
+	{
+		const float Cell = Value / CELL_SIZE;
+		if(!(Cell >= 0.0f)) // also catches NaN
+			return 0;
+		if(Cell >= Size)
+			return Size - 1;
+		return (int)Cell;
+	}
+
+public:
+	/*
+		Function: Init
+			Creates the cells for a map of the given size in pixels.
+	*/
+	void Init(int NumTypes, int MapWidth, int MapHeight)
+	{
+		m_Width = maximum(1, (MapWidth + CELL_SIZE - 1) / CELL_SIZE);
+		m_Height = maximum(1, (MapHeight + CELL_SIZE - 1) / CELL_SIZE);
+		m_vpCells.assign((size_t)NumTypes * m_Width * m_Height, nullptr);
+	}
+
+	bool IsInitialized() const { return !m_vpCells.empty(); }
+
+	int Cell(int Type, vec2 Pos) const
+	{
+		return (Type * m_Height + Coord(Pos.y, m_Height)) * m_Width + Coord(Pos.x, m_Width);
+	}
+
+	// number of cells that overlap the box
+	int64_t NumCells(vec2 Min, vec2 Max) const
+	{
+		return (int64_t)(Coord(Max.x, m_Width) - Coord(Min.x, m_Width) + 1) * (Coord(Max.y, m_Height) - Coord(Min.y, m_Height) + 1);
+	}
+
+	void Insert(T *pEnt)
+	{
+		const int Index = Cell(pEnt->m_ObjType, pEnt->m_Pos);
+		pEnt->m_GridCell = Index;
+		pEnt->m_pPrevCellEntity = nullptr;
+		pEnt->m_pNextCellEntity = m_vpCells[Index];
+		if(m_vpCells[Index])
+			m_vpCells[Index]->m_pPrevCellEntity = pEnt;
+		m_vpCells[Index] = pEnt;
+	}
+
+	void Remove(T *pEnt)
+	{
+		if(pEnt->m_GridCell == -1)
+			return;
+
+		if(pEnt->m_pPrevCellEntity)
+			pEnt->m_pPrevCellEntity->m_pNextCellEntity = pEnt->m_pNextCellEntity;
+		else
+			m_vpCells[pEnt->m_GridCell] = pEnt->m_pNextCellEntity;
+		if(pEnt->m_pNextCellEntity)
+			pEnt->m_pNextCellEntity->m_pPrevCellEntity = pEnt->m_pPrevCellEntity;
+
+		pEnt->m_pPrevCellEntity = nullptr;
+		pEnt->m_pNextCellEntity = nullptr;
+		pEnt->m_GridCell = -1;
+	}
+
+	// moves the entity to the cell of its current position
+	void Update(T *pEnt)
+	{
+		if(pEnt->m_GridCell == Cell(pEnt->m_ObjType, pEnt->m_Pos))
+			return;
+		Remove(pEnt);
+		Insert(pEnt);
+	}
+
+	/*
+		Function: ForEach
+			Calls Fn for the entities of a type in the cells that overlap
+			the box, in no particular order.
+	*/
+	template<typename F>
+	void ForEach(int Type, vec2 Min, vec2 Max, F &&Fn) const
+	{
+		const int MinX = Coord(Min.x, m_Width);
+		const int MinY = Coord(Min.y, m_Height);
+		const int MaxX = Coord(Max.x, m_Width);
+		const int MaxY = Coord(Max.y, m_Height);
+		for(int y = MinY; y <= MaxY; y++)
+		{
+			const int RowCell = (Type * m_Height + y) * m_Width;
+			for(int x = MinX; x <= MaxX; x++)
+			{
+				for(T *pEnt = m_vpCells[RowCell + x]; pEnt; pEnt = pEnt->m_pNextCellEntity)
+					Fn(pEnt);
+			}
+		}
+	}
+
+	/*
+		Function: Collect
+			Finds the entities of a type in the cells that overlap the box.
+
+		Arguments:
+			ppEnts - Receives the entities in the order of the type list.
+			MaxEnts - Number of entities that fit into ppEnts.
+
+		Returns:
+			The number of entities found, -1 if they don't fit.
+	*/
+	int Collect(int Type, vec2 Min, vec2 Max, T **ppEnts, int MaxEnts) const
+	{
+		int Num = 0;
+		ForEach(Type, Min, Max, [&](T *pEnt) {
+			if(Num < MaxEnts)
+				ppEnts[Num] = pEnt;
+			Num++;
+		});
+		if(Num > MaxEnts)
+			return -1;
+
+		// keep the order of the type list, the queries depend on it
+		std::sort(ppEnts, ppEnts + Num, [](const T *pA, const T *pB) {
+			return pA->m_ListOrder > pB->m_ListOrder;
+		});
+		return Num;
+	}
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "event_index.h"
+
+#include <base/math.h>
+#include <base/system.h>
+
+#include <algorithm>
+
+int CEventIndex::CellCoord(float Value, int Size)
+{
+	const float Cell = Value / CELL_SIZE;
+	if(!(Cell >= 0.0f)) // also catches NaN
+		return 0;
+	if(Cell >= Size)
+		return Size - 1;
+	return (int)Cell;
+}
+
+void CEventIndex::Build(int MapWidth, int MapHeight, int NumEvents, const vec2 *pPositions, const CClientMask *pMasks)
+{
+	dbg_assert(NumEvents <= MAX_EVENTS, "too many events");
+	m_GridWidth = maximum(1, (MapWidth + CELL_SIZE - 1) / CELL_SIZE);
+	m_GridHeight = maximum(1, (MapHeight + CELL_SIZE - 1) / CELL_SIZE);
+	m_NumEvents = NumEvents;
+
+	m_NumGroups = 0;
+	for(int i = 0; i < NumEvents; i++)
+	{
+		int Group = 0;
+		while(Group < m_NumGroups && m_aGroupMasks[Group] != pMasks[i])
+			Group++;
+		if(Group == m_NumGroups)
+			m_aGroupMasks[m_NumGroups++] = pMasks[i];
+		m_aEventGroups[i] = Group;
+
+		m_aPositions[i] = pPositions[i];
+		const int Cell = CellCoord(pPositions[i].y, m_GridHeight) * m_GridWidth + CellCoord(pPositions[i].x, m_GridWidth);
+		m_aCellEvents[i] = {Cell, i};
+	}
+	std::sort(m_aCellEvents, m_aCellEvents + NumEvents);
+}
+
+int CEventIndex::Collect(int ClientId, vec2 ViewPos, vec2 ShowDistance, int *pEvents, int64_t *pNumTested) const
+{
+	bool aGroupVisible[MAX_EVENTS];
+	for(int Group = 0; Group < m_NumGroups; Group++)
+		aGroupVisible[Group] = m_aGroupMasks[Group].test(ClientId);
+
+	const vec2 ViewMin = ViewPos - ShowDistance;
+	const vec2 ViewMax = ViewPos + ShowDistance;
+	const int MinX = CellCoord(ViewMin.x, m_GridWidth);
+	const int MaxX = CellCoord(ViewMax.x, m_GridWidth);
+	const int MinY = CellCoord(ViewMin.y, m_GridHeight);
+	const int MaxY = CellCoord(ViewMax.y, m_GridHeight);
+	const std::pair<int, int> *pEnd = m_aCellEvents + m_NumEvents;
+	int NumEvents = 0;
+	for(int y = MinY; y <= MaxY; y++)
+	{
+		// the cells of a row in the view are consecutive
+		const int LastCell = y * m_GridWidth + MaxX;
+		const std::pair<int, int> *pCellEvent = std::lower_bound((const std::pair<int, int> *)m_aCellEvents, pEnd, std::pair<int, int>(y * m_GridWidth + MinX, -1));
+		for(; pCellEvent != pEnd && pCellEvent->first <= LastCell; pCellEvent++)
+		{
+			(*pNumTested)++;
+			const int i = pCellEvent->second;
+			if(aGroupVisible[m_aEventGroups[i]] &&
+				absolute(ViewPos.x - m_aPositions[i].x) <= ShowDistance.x &&
+				absolute(ViewPos.y - m_aPositions[i].y) <= ShowDistance.y)
+			{
+				pEvents[NumEvents++] = i;
+			}
+		}
+	}
+	// in event order to get the same snapshot as without the index
+	std::sort(pEvents, pEvents + NumEvents);
+	return NumEvents;
+}
@@ -0,0 +1,70 @@
+#ifndef GAME_SERVER_EVENT_INDEX_H
+#define GAME_SERVER_EVENT_INDEX_H
+
+#include <base/vmath.h>
+
+#include <engine/shared/protocol.h>
+
+#include <cstdint>
+#include <utility>
+
+/*
+	Class: Event Index
+		Index of the events of a snapshot. The events are sorted by the
+		world cell they're in and put into groups of events with the same
+		client mask, usually the mask of a team. A client only looks at the
+		cells around its view and tests the mask once per group.
+*/
+class CEventIndex
+{
+public:
+	enum
+	{
+		MAX_EVENTS = 128,
+		CELL_SIZE = 256,
+	};
+
+private:
+	int m_GridWidth = 1;
+	int m_GridHeight = 1;
+	int m_NumEvents = 0;
+	int m_NumGroups = 0;
+	vec2 m_aPositions[MAX_EVENTS];
+	CClientMask m_aGroupMasks[MAX_EVENTS];
+	int m_aEventGroups[MAX_EVENTS];
+	// (cell, event) pairs sorted by cell and event
+	std::pair<int, int> m_aCellEvents[MAX_EVENTS];
+
+	static int CellCoord(float Value, int Size);
+
+public:
+	/*
+		Function: Build
+			Indexes the events of a snapshot.
+
+		Arguments:
+			MapWidth - Width of the map in pixels.
+			MapHeight - Height of the map in pixels.
+			NumEvents - Number of events, at most MAX_EVENTS.
+			pPositions - Positions of the events.
+			pMasks - Clients that can see the events.
+	*/
+	void Build(int MapWidth, int MapHeight, int NumEvents, const vec2 *pPositions, const CClientMask *pMasks);
+
+	/*
+		Function: Collect
+			Finds the events a client can see, the ones with the client in
+			their mask that are at most ShowDistance away from ViewPos on
+			both axes, like NetworkClipped checks.
+
+		Arguments:
+			pEvents - Receives the indices of the events in event order.
+			pNumTested - The number of events looked at is added to it.
+
+		Returns:
+			Number of events found.
+	*/
+	int Collect(int ClientId, vec2 ViewPos, vec2 ShowDistance, int *pEvents, int64_t *pNumTested) const;
+};
+
+#endif
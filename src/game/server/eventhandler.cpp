@@ -4,9 +4,13 @@
 
 #include "entity.h"
 #include "gamecontext.h"
+#include "player.h"
 
 #include <base/system.h>
 #include <base/vmath.h>
+#include <engine/shared/config.h>
+
+#include <algorithm>
 
 //////////////////////////////////////////////////
 // Event handler
@@ -14,6 +18,9 @@
 CEventHandler::CEventHandler()
 {
 	m_pGameServer = 0;
+	m_NumEvents = 0;
+	m_NumSnapped = 0;
+	ResetStats();
 	Clear();
 }
 
@@ -24,10 +31,11 @@ void CEventHandler::SetGameServer(CGameContext *pGameServer)
 
 void *CEventHandler::Create(int Type, int Size, CClientMask Mask)
 {
-	if(m_NumEvents == MAX_EVENTS)
-		return 0;
-	if(m_CurrentOffset + Size >= MAX_DATASIZE)
+	if(m_NumEvents == MAX_EVENTS || m_CurrentOffset + Size >= MAX_DATASIZE)
+	{
+		m_Stats.m_EventsDropped++;
 		return 0;
+	}
 
 	void *p = &m_aData[m_CurrentOffset];
 	m_aOffsets[m_NumEvents] = m_CurrentOffset;
@@ -36,36 +44,92 @@ void *CEventHandler::Create(int Type, int Size, CClientMask Mask)
 	m_aClientMasks[m_NumEvents] = Mask;
 	m_CurrentOffset += Size;
 	m_NumEvents++;
+	m_IndexDirty = true;
+	m_Stats.m_EventsCreated++;
 	return p;
 }
 
 void CEventHandler::Clear()
 {
+	m_Stats.m_NumSnapshots++;
+	m_Stats.m_MaxEventsCreated = std::max(m_Stats.m_MaxEventsCreated, m_NumEvents);
+	m_Stats.m_MaxEventsSnapped = std::max(m_Stats.m_MaxEventsSnapped, m_NumSnapped);
+
 	m_NumEvents = 0;
 	m_CurrentOffset = 0;
+	m_NumSnapped = 0;
+	m_IndexDirty = true;
 }
 
-void CEventHandler::Snap(int SnappingClient)
+void CEventHandler::ResetStats()
 {
+	mem_zero(&m_Stats, sizeof(m_Stats));
+}
+
+void CEventHandler::BuildIndex()
+{
+	vec2 aPositions[MAX_EVENTS];
 	for(int i = 0; i < m_NumEvents; i++)
 	{
-		if(SnappingClient == SERVER_DEMO_CLIENT || m_aClientMasks[i].test(SnappingClient))
+		const CNetEvent_Common *pEvent = (const CNetEvent_Common *)&m_aData[m_aOffsets[i]];
+		aPositions[i] = vec2(pEvent->m_X, pEvent->m_Y);
+	}
+	const CCollision *pCollision = GameServer()->Collision();
+	m_Index.Build(pCollision->GetWidth() * 32, pCollision->GetHeight() * 32, m_NumEvents, aPositions, m_aClientMasks);
+	m_IndexDirty = false;
+}
+
+int CEventHandler::CollectEvents(int SnappingClient)
+{
+	int NumEvents = 0;
+	if(SnappingClient == SERVER_DEMO_CLIENT)
+	{
+		for(int i = 0; i < m_NumEvents; i++)
+			m_aSnapEvents[NumEvents++] = i;
+		m_Stats.m_EventsTested += m_NumEvents;
+		return NumEvents;
+	}
+
+	// same area as NetworkClipped
+	const CPlayer *pPlayer = GameServer()->m_apPlayers[SnappingClient];
+	const vec2 ViewMin = pPlayer->m_ViewPos - pPlayer->m_ShowDistance;
+	const vec2 ViewMax = pPlayer->m_ViewPos + pPlayer->m_ShowDistance;
+	if(!GameServer()->Config()->m_SvSnapCulling || pPlayer->m_ShowAll || !(ViewMin.x <= ViewMax.x && ViewMin.y <= ViewMax.y))
+	{
+		for(int i = 0; i < m_NumEvents; i++)
 		{
-			CNetEvent_Common *pEvent = (CNetEvent_Common *)&m_aData[m_aOffsets[i]];
-			if(!NetworkClipped(GameServer(), SnappingClient, vec2(pEvent->m_X, pEvent->m_Y)))
-			{
-				int Type = m_aTypes[i];
-				int Size = m_aSizes[i];
-				const char *pData = &m_aData[m_aOffsets[i]];
-				if(GameServer()->Server()->IsSixup(SnappingClient))
-					EventToSixup(&Type, &Size, &pData);
-
-				void *pItem = GameServer()->Server()->SnapNewItem(Type, i, Size);
-				if(pItem)
-					mem_copy(pItem, pData, Size);
-			}
+			const CNetEvent_Common *pEvent = (const CNetEvent_Common *)&m_aData[m_aOffsets[i]];
+			if(m_aClientMasks[i].test(SnappingClient) && !NetworkClipped(GameServer(), SnappingClient, vec2(pEvent->m_X, pEvent->m_Y)))
+				m_aSnapEvents[NumEvents++] = i;
 		}
+		m_Stats.m_EventsTested += m_NumEvents;
+		return NumEvents;
+	}
+
+	if(m_IndexDirty)
+		BuildIndex();
+
+	return m_Index.Collect(SnappingClient, pPlayer->m_ViewPos, pPlayer->m_ShowDistance, m_aSnapEvents, &m_Stats.m_EventsTested);
+}
+
+void CEventHandler::Snap(int SnappingClient)
+{
+	const int NumEvents = CollectEvents(SnappingClient);
+	for(int j = 0; j < NumEvents; j++)
+	{
+		const int i = m_aSnapEvents[j];
+		int Type = m_aTypes[i];
+		int Size = m_aSizes[i];
+		const char *pData = &m_aData[m_aOffsets[i]];
+		if(GameServer()->Server()->IsSixup(SnappingClient))
+			EventToSixup(&Type, &Size, &pData);
+
+		void *pItem = GameServer()->Server()->SnapNewItem(Type, i, Size);
+		if(pItem)
+			mem_copy(pItem, pData, Size);
 	}
+	m_NumSnapped += NumEvents;
+	m_Stats.m_EventsSnapped += NumEvents;
 }
 
 void CEventHandler::EventToSixup(int *pType, int *pSize, const char **ppData)
@@ -3,15 +3,34 @@
 #ifndef GAME_SERVER_EVENTHANDLER_H
 #define GAME_SERVER_EVENTHANDLER_H
 
+#include "event_index.h"
+
 #include <cstdint>
 
 #include <engine/shared/protocol.h>
 
 class CEventHandler
 {
+public:
+	class CStats
+	{
+	public:
+		int64_t m_NumSnapshots;
+		int64_t m_EventsCreated;
+		// not created because the buffer was full
+		int64_t m_EventsDropped;
+		// added to the snapshots of all clients
+		int64_t m_EventsSnapped;
+		// events looked at for the snapshots of all clients
+		int64_t m_EventsTested;
+		int m_MaxEventsCreated;
+		int m_MaxEventsSnapped;
+	};
+
+private:
 	enum
 	{
-		MAX_EVENTS = 128,
+		MAX_EVENTS = CEventIndex::MAX_EVENTS,
 		MAX_DATASIZE = 128 * 64,
 	};
 
@@ -26,6 +45,18 @@ class CEventHandler
 	int m_CurrentOffset;
 	int m_NumEvents;
 
+	// built on the first snap after events were created
+	CEventIndex m_Index;
+	bool m_IndexDirty;
+	int m_aSnapEvents[MAX_EVENTS];
+
+	CStats m_Stats;
+	int m_NumSnapped;
+
+	void BuildIndex();
+	// fills m_aSnapEvents with the events the client can see in event order
+	int CollectEvents(int SnappingClient);
+
 public:
 	CGameContext *GameServer() const { return m_pGameServer; }
 	void SetGameServer(CGameContext *pGameServer);
@@ -42,6 +73,9 @@ public:
 	void Clear();
 	void Snap(int SnappingClient);
 
+	const CStats &Stats() const { return m_Stats; }
+	void ResetStats();
+
 	void EventToSixup(int *pType, int *pSize, const char **ppData);
 };
 
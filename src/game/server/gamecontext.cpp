@@ -187,7 +187,24 @@ void CGameContext::Clear()
 void CGameContext::TeeHistorianWrite(const void *pData, int DataSize, void *pUser)
 {
 	CGameContext *pSelf = (CGameContext *)pUser;
-	aio_write(pSelf->m_pTeeHistorianFile, pData, DataSize);
+	pSelf->m_TeeHistorianFile.Write(pData, DataSize);
+}
+
+void CGameContext::PrintTeeHistorianStats()
+{
+	if(!m_TeeHistorianFile.IsOpen())
+	{
+		Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "teehistorian", "not recording");
+		return;
+	}
+	const CAsyncFileWriter::CStats Stats = m_TeeHistorianFile.Stats();
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "bytes_in=%" PRId64 " bytes_out=%" PRId64 " ratio=%.2f flush_points=%" PRId64,
+		Stats.m_BytesIn, Stats.m_BytesOut, Stats.m_BytesOut > 0 ? (double)Stats.m_BytesIn / Stats.m_BytesOut : 0.0, Stats.m_NumFlushPoints);
+	Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "teehistorian", aBuf);
+	str_format(aBuf, sizeof(aBuf), "buffer_peak=%" PRId64 " max_buffer=%d stalls=%" PRId64 " stall_time=%.3fms",
+		Stats.m_BufferPeak, g_Config.m_SvTeeHistorianMaxBuffer * 1024, Stats.m_NumStalls, Stats.m_StallTimeNs / 1e6);
+	Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "teehistorian", aBuf);
 }
 
 void CGameContext::CommandCallback(int ClientId, int FlagMask, const char *pCmd, IConsole::IResult *pResult, void *pUser)
@@ -259,6 +276,34 @@ void CGameContext::FillAntibot(CAntibotRoundData *pData)
 	}
 }
 
+bool CGameContext::CharacterPos(int ClientId, int *pX, int *pY) const
+{
+	if(!m_apPlayers[ClientId] || !m_apPlayers[ClientId]->GetCharacter())
+		return false;
+	CNetObj_CharacterCore Char;
+	m_apPlayers[ClientId]->GetCharacter()->GetCore().Write(&Char);
+	*pX = Char.m_X;
+	*pY = Char.m_Y;
+	return true;
+}
+
+void CGameContext::EnableEntityTickStats()
+{
+	m_World.EnableProfiling();
+}
+
+int CGameContext::EntityTickStats(CEntityTickStats *pStats, int MaxStats) const
+{
+	const int NumStats = minimum(MaxStats, (int)CGameWorld::NUM_ENTTYPES);
+	for(int i = 0; i < NumStats; i++)
+	{
+		pStats[i].m_pName = CGameWorld::EntityTypeName(i);
+		pStats[i].m_Duration = m_World.TickDuration(i);
+		pStats[i].m_NumTicked = m_World.NumTicked(i);
+	}
+	return NumStats;
+}
+
 void CGameContext::CreateDamageInd(vec2 Pos, float Angle, int Amount, CClientMask Mask)
 {
 	float a = 3 * pi / 2 + Angle;
@@ -1017,7 +1062,7 @@ void CGameContext::OnTick()
 
 	if(m_TeeHistorianActive)
 	{
-		int Error = aio_error(m_pTeeHistorianFile);
+		int Error = m_TeeHistorianFile.Error();
 		if(Error)
 		{
 			dbg_msg("teehistorian", "error writing to file, err=%d", Error);
@@ -1028,6 +1073,9 @@ void CGameContext::OnTick()
 		{
 			m_TeeHistorian.EndInputs();
 			m_TeeHistorian.EndTick();
+			// between ticks, so reading can start at the flush point
+			if(Server()->Tick() % (Server()->TickSpeed() * g_Config.m_SvTeeHistorianFlushInterval) == 0)
+				m_TeeHistorianFile.FlushPoint();
 		}
 		m_TeeHistorian.BeginTick(Server()->Tick());
 		m_TeeHistorian.BeginPlayers();
@@ -1323,6 +1371,11 @@ void CGameContext::OnClientPrepareInput(int ClientId, void *pInput)
 
 void CGameContext::OnClientDirectInput(int ClientId, void *pInput)
 {
+	if(m_TeeHistorianActive)
+	{
+		m_TeeHistorian.RecordPlayerDirectInput(ClientId, m_apPlayers[ClientId]->GetUniqueCid(), (CNetObj_PlayerInput *)pInput);
+	}
+
 	if(!m_World.m_Paused)
 		m_apPlayers[ClientId]->OnDirectInput((CNetObj_PlayerInput *)pInput);
 
@@ -3653,6 +3706,8 @@ void CGameContext::OnConsoleInit()
 	Console()->Register("vote", "r['yes'|'no']", CFGFLAG_SERVER, ConVote, this, "Force a vote to yes/no");
 	Console()->Register("votes", "?i[page]", CFGFLAG_SERVER, ConVotes, this, "Show all votes (page 0 by default, 20 entries per page)");
 	Console()->Register("dump_antibot", "", CFGFLAG_SERVER, ConDumpAntibot, this, "Dumps the antibot status");
+	Console()->Register("teehistorian_stats", "", CFGFLAG_SERVER, ConTeeHistorianStats, this, "Shows the compression and write buffer statistics of the tee historian");
+	Console()->Register("event_stats", "?s['reset']", CFGFLAG_SERVER, ConEventStats, this, "Shows how many events were created and snapped per snapshot");
 	Console()->Register("antibot", "r[command]", CFGFLAG_SERVER, ConAntibot, this, "Sends a command to the antibot");
 
 	Console()->Chain("sv_motd", ConchainSpecialMotdupdate, this);
@@ -3849,7 +3904,12 @@ void CGameContext::OnInit(const void *pPersistentData)
 	Console()->SetTeeHistorianCommandCallback(CommandCallback, this);
 
 	uint64_t aSeed[2];
-	secure_random_fill(aSeed, sizeof(aSeed));
+	if(!g_Config.m_SvPrngSeed[0] || !CPrng::ParseSeed(g_Config.m_SvPrngSeed, aSeed))
+	{
+		if(g_Config.m_SvPrngSeed[0])
+			log_error("server", "invalid prng seed '%s', using a random one", g_Config.m_SvPrngSeed);
+		secure_random_fill(aSeed, sizeof(aSeed));
+	}
 	m_Prng.Seed(aSeed);
 	m_World.m_Core.m_pPrng = &m_Prng;
 
@@ -3952,7 +4012,7 @@ void CGameContext::OnInit(const void *pPersistentData)
 		FormatUuid(m_GameUuid, aGameUuid, sizeof(aGameUuid));
 
 		char aFilename[IO_MAX_PATH_LENGTH];
-		str_format(aFilename, sizeof(aFilename), "teehistorian/%s.teehistorian", aGameUuid);
+		str_format(aFilename, sizeof(aFilename), "teehistorian/%s.teehistorian%s", aGameUuid, g_Config.m_SvTeeHistorianCompression ? ".gz" : "");
 
 		IOHANDLE THFile = Storage()->OpenFile(aFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
 		if(!THFile)
@@ -3965,7 +4025,7 @@ void CGameContext::OnInit(const void *pPersistentData)
 		{
 			dbg_msg("teehistorian", "recording to '%s'", aFilename);
 		}
-		m_pTeeHistorianFile = aio_new(THFile);
+		m_TeeHistorianFile.Open(THFile, g_Config.m_SvTeeHistorianCompression, g_Config.m_SvTeeHistorianMaxBuffer * 1024);
 
 		char aVersion[128];
 		if(GIT_SHORTREV_HASH)
@@ -4272,15 +4332,16 @@ void CGameContext::OnShutdown(void *pPersistentData)
 	if(m_TeeHistorianActive)
 	{
 		m_TeeHistorian.Finish();
-		aio_close(m_pTeeHistorianFile);
-		aio_wait(m_pTeeHistorianFile);
-		int Error = aio_error(m_pTeeHistorianFile);
+		m_TeeHistorianFile.Close();
+		int Error = m_TeeHistorianFile.Error();
 		if(Error)
 		{
 			dbg_msg("teehistorian", "error closing file, err=%d", Error);
 			Server()->SetErrorShutdown("teehistorian close error");
 		}
-		aio_free(m_pTeeHistorianFile);
+		const CAsyncFileWriter::CStats Stats = m_TeeHistorianFile.Stats();
+		dbg_msg("teehistorian", "closed file, bytes_in=%" PRId64 " bytes_out=%" PRId64 " buffer_peak=%" PRId64 " stalls=%" PRId64 " stall_time=%.3fms",
+			Stats.m_BytesIn, Stats.m_BytesOut, Stats.m_BufferPeak, Stats.m_NumStalls, Stats.m_StallTimeNs / 1e6);
 	}
 
 	// Stop any demos being recorded.
@@ -5,6 +5,7 @@
 
 #include <engine/console.h>
 #include <engine/server.h>
+#include <engine/shared/async_file_writer.h>
 
 #include <game/collision.h>
 #include <game/generated/protocol.h>
@@ -94,7 +95,7 @@ class CGameContext : public IGameServer
 
 	bool m_TeeHistorianActive;
 	CTeeHistorian m_TeeHistorian;
-	ASYNCIO *m_pTeeHistorianFile;
+	CAsyncFileWriter m_TeeHistorianFile;
 	CUuid m_GameUuid;
 	CMapBugs m_MapBugs;
 	CPrng m_Prng;
@@ -103,6 +104,7 @@ class CGameContext : public IGameServer
 
 	static void CommandCallback(int ClientId, int FlagMask, const char *pCmd, IConsole::IResult *pResult, void *pUser);
 	static void TeeHistorianWrite(const void *pData, int DataSize, void *pUser);
+	void PrintTeeHistorianStats();
 
 	static void ConTuneParam(IConsole::IResult *pResult, void *pUserData);
 	static void ConToggleTuneParam(IConsole::IResult *pResult, void *pUserData);
@@ -135,6 +137,8 @@ class CGameContext : public IGameServer
 	static void ConVoteNo(IConsole::IResult *pResult, void *pUserData);
 	static void ConDrySave(IConsole::IResult *pResult, void *pUserData);
 	static void ConDumpAntibot(IConsole::IResult *pResult, void *pUserData);
+	static void ConTeeHistorianStats(IConsole::IResult *pResult, void *pUserData);
+	static void ConEventStats(IConsole::IResult *pResult, void *pUserData);
 	static void ConAntibot(IConsole::IResult *pResult, void *pUserData);
 	static void ConchainSpecialMotdupdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainSettingUpdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
@@ -346,6 +350,9 @@ public:
 	void OnPreTickTeehistorian() override;
 	bool OnClientDDNetVersionKnown(int ClientId);
 	void FillAntibot(CAntibotRoundData *pData) override;
+	bool CharacterPos(int ClientId, int *pX, int *pY) const override;
+	void EnableEntityTickStats() override;
+	int EntityTickStats(CEntityTickStats *pStats, int MaxStats) const override;
 	bool ProcessSpamProtection(int ClientId, bool RespectChatInitialDelay = true);
 	int GetDDRaceTeam(int ClientId) const;
 	// Describes the time when the first player joined the server.
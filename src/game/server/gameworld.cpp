@@ -6,6 +6,7 @@
 #include "entity.h"
 #include "gamecontext.h"
 #include "gamecontroller.h"
+#include "player.h"
 
 #include <engine/shared/config.h>
 
@@ -25,6 +26,21 @@ CGameWorld::CGameWorld()
 	m_ResetRequested = false;
 	for(auto &pFirstEntityType : m_apFirstEntityTypes)
 		pFirstEntityType = 0;
+	for(int &NumEntities : m_aNumEntities)
+		NumEntities = 0;
+	m_NextListOrder = 0;
+	for(auto &pFirstAlwaysSnapEntity : m_apFirstAlwaysSnapEntities)
+		pFirstAlwaysSnapEntity = nullptr;
+	for(int &NumAlwaysSnapEntities : m_aNumAlwaysSnapEntities)
+		NumAlwaysSnapEntities = 0;
+
+	for(float &MaxRadius : m_aGridMaxRadius)
+		MaxRadius = 0.0f;
+	m_ProfileEntityTicks = false;
+	for(int64_t &TickDuration : m_aTickDuration)
+		TickDuration = 0;
+	for(int64_t &NumTicked : m_aNumTicked)
+		NumTicked = 0;
 }
 
 CGameWorld::~CGameWorld()
@@ -42,29 +58,105 @@ void CGameWorld::SetGameServer(CGameContext *pGameServer)
 	m_pServer = m_pGameServer->Server();
 }
 
+const char *CGameWorld::EntityTypeName(int Type)
+{
+	switch(Type)
+	{
+	case ENTTYPE_PROJECTILE: return "projectile";
+	case ENTTYPE_LASER: return "laser";
+	case ENTTYPE_PICKUP: return "pickup";
+	case ENTTYPE_FLAG: return "flag";
+	case ENTTYPE_CHARACTER: return "character";
+	}
+	dbg_assert(false, "invalid entity type");
+	return "";
+}
+
 CEntity *CGameWorld::FindFirst(int Type)
 {
 	return Type < 0 || Type >= NUM_ENTTYPES ? 0 : m_apFirstEntityTypes[Type];
 }
 
-int CGameWorld::FindEntities(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type)
+void CGameWorld::GridInsert(CEntity *pEnt)
 {
-	if(Type < 0 || Type >= NUM_ENTTYPES)
-		return 0;
+	if(!m_Grid.IsInitialized())
+		m_Grid.Init(NUM_ENTTYPES, GameServer()->Collision()->GetWidth() * 32, GameServer()->Collision()->GetHeight() * 32);
+	m_Grid.Insert(pEnt);
+}
 
-	int Num = 0;
-	for(CEntity *pEnt = m_apFirstEntityTypes[Type]; pEnt; pEnt = pEnt->m_pNextTypeEntity)
+void CGameWorld::UpdateGridEntity(CEntity *pEnt)
+{
+	m_Grid.Update(pEnt);
+}
+
+template<typename F>
+void CGameWorld::ForEachCandidate(int Type, vec2 Pos0, vec2 Pos1, float Radius, bool UseGrid, F &&Fn)
+{
+	const float Margin = Radius + m_aGridMaxRadius[Type];
+	const vec2 Min = vec2(minimum(Pos0.x, Pos1.x) - Margin, minimum(Pos0.y, Pos1.y) - Margin);
+	const vec2 Max = vec2(maximum(Pos0.x, Pos1.x) + Margin, maximum(Pos0.y, Pos1.y) + Margin);
+
+	// walking the list is cheaper for large areas and few entities
+	CEntity *apCandidates[MAX_CANDIDATES];
+	int NumCandidates = -1;
+	if(UseGrid && m_Grid.IsInitialized() && m_Grid.NumCells(Min, Max) < m_aNumEntities[Type])
+		NumCandidates = m_Grid.Collect(Type, Min, Max, apCandidates, std::size(apCandidates));
+
+	if(NumCandidates < 0)
 	{
-		if(distance(pEnt->m_Pos, Pos) < Radius + pEnt->m_ProximityRadius)
+		for(CEntity *pEnt = m_apFirstEntityTypes[Type]; pEnt; pEnt = pEnt->m_pNextTypeEntity)
 		{
-			if(ppEnts)
-				ppEnts[Num] = pEnt;
-			Num++;
-			if(Num == Max)
-				break;
+			if(!Fn(pEnt))
+				return;
 		}
+		return;
+	}
+
+#ifdef CONF_DEBUG
+	// an entity moved without SetPos would be missed here
+	for(CEntity *pEnt = m_apFirstEntityTypes[Type]; pEnt; pEnt = pEnt->m_pNextTypeEntity)
+	{
+		dbg_assert(pEnt->m_GridCell == m_Grid.Cell(Type, pEnt->m_Pos), "entity moved without updating the grid");
 	}
+#endif
+
+	for(int i = 0; i < NumCandidates; i++)
+	{
+		if(!Fn(apCandidates[i]))
+			return;
+	}
+}
+
+int CGameWorld::FindEntities(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type)
+{
+	if(Type < 0 || Type >= NUM_ENTTYPES)
+		return 0;
+
+	const auto &&Find = [&](bool UseGrid, CEntity **ppFound) {
+		int Num = 0;
+		ForEachCandidate(Type, Pos, Pos, Radius, UseGrid, [&](CEntity *pEnt) {
+			if(distance(pEnt->m_Pos, Pos) < Radius + pEnt->m_ProximityRadius)
+			{
+				if(ppFound)
+					ppFound[Num] = pEnt;
+				Num++;
+				if(Num == Max)
+					return false;
+			}
+			return true;
+		});
+		return Num;
+	};
 
+	const int Num = Find(true, ppEnts);
+#ifdef CONF_DEBUG
+	if(Config()->m_DbgWorldGrid)
+	{
+		std::vector<CEntity *> vpExpected(maximum(Max, 0));
+		dbg_assert(Find(false, ppEnts ? vpExpected.data() : nullptr) == Num, "grid changed the number of found entities");
+		dbg_assert(!ppEnts || std::equal(vpExpected.begin(), vpExpected.begin() + Num, ppEnts), "grid changed the found entities");
+	}
+#endif
 	return Num;
 }
 
@@ -81,6 +173,23 @@ void CGameWorld::InsertEntity(CEntity *pEnt)
 	pEnt->m_pNextTypeEntity = m_apFirstEntityTypes[pEnt->m_ObjType];
 	pEnt->m_pPrevTypeEntity = 0x0;
 	m_apFirstEntityTypes[pEnt->m_ObjType] = pEnt;
+
+	pEnt->m_ListOrder = ++m_NextListOrder;
+	m_aNumEntities[pEnt->m_ObjType]++;
+	m_aGridMaxRadius[pEnt->m_ObjType] = maximum(m_aGridMaxRadius[pEnt->m_ObjType], pEnt->m_ProximityRadius);
+	GridInsert(pEnt);
+
+	pEnt->m_SnapOnlyInView = pEnt->SnapOnlyInView();
+	if(!pEnt->m_SnapOnlyInView)
+	{
+		CEntity *&pFirst = m_apFirstAlwaysSnapEntities[pEnt->m_ObjType];
+		if(pFirst)
+			pFirst->m_pPrevAlwaysSnapEntity = pEnt;
+		pEnt->m_pNextAlwaysSnapEntity = pFirst;
+		pEnt->m_pPrevAlwaysSnapEntity = nullptr;
+		pFirst = pEnt;
+		m_aNumAlwaysSnapEntities[pEnt->m_ObjType]++;
+	}
 }
 
 void CGameWorld::RemoveEntity(CEntity *pEnt)
@@ -103,29 +212,81 @@ void CGameWorld::RemoveEntity(CEntity *pEnt)
 
 	pEnt->m_pNextTypeEntity = 0;
 	pEnt->m_pPrevTypeEntity = 0;
-}
 
-//
-void CGameWorld::Snap(int SnappingClient)
-{
-	for(CEntity *pEnt = m_apFirstEntityTypes[ENTTYPE_CHARACTER]; pEnt;)
+	m_aNumEntities[pEnt->m_ObjType]--;
+	m_Grid.Remove(pEnt);
+
+	if(!pEnt->m_SnapOnlyInView)
 	{
-		m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
-		pEnt->Snap(SnappingClient);
-		pEnt = m_pNextTraverseEntity;
+		if(pEnt->m_pPrevAlwaysSnapEntity)
+			pEnt->m_pPrevAlwaysSnapEntity->m_pNextAlwaysSnapEntity = pEnt->m_pNextAlwaysSnapEntity;
+		else
+			m_apFirstAlwaysSnapEntities[pEnt->m_ObjType] = pEnt->m_pNextAlwaysSnapEntity;
+		if(pEnt->m_pNextAlwaysSnapEntity)
+			pEnt->m_pNextAlwaysSnapEntity->m_pPrevAlwaysSnapEntity = pEnt->m_pPrevAlwaysSnapEntity;
+		pEnt->m_pPrevAlwaysSnapEntity = nullptr;
+		pEnt->m_pNextAlwaysSnapEntity = nullptr;
+		m_aNumAlwaysSnapEntities[pEnt->m_ObjType]--;
 	}
+}
 
-	for(int i = 0; i < NUM_ENTTYPES; i++)
-	{
-		if(i == ENTTYPE_CHARACTER)
-			continue;
+bool CGameWorld::SnapView(int SnappingClient, vec2 *pViewMin, vec2 *pViewMax)
+{
+	if(!Config()->m_SvSnapCulling || SnappingClient == SERVER_DEMO_CLIENT)
+		return false;
+
+	// same area as NetworkClipped
+	const CPlayer *pPlayer = GameServer()->m_apPlayers[SnappingClient];
+	if(pPlayer->m_ShowAll)
+		return false;
+	*pViewMin = pPlayer->m_ViewPos - pPlayer->m_ShowDistance;
+	*pViewMax = pPlayer->m_ViewPos + pPlayer->m_ShowDistance;
+
+	// let the entities handle NaN and negative distances themselves
+	return pViewMin->x <= pViewMax->x && pViewMin->y <= pViewMax->y;
+}
 
-		for(CEntity *pEnt = m_apFirstEntityTypes[i]; pEnt;)
+void CGameWorld::SnapEntities(int Type, int SnappingClient, bool Cull, vec2 ViewMin, vec2 ViewMax)
+{
+	if(!Cull || m_aNumAlwaysSnapEntities[Type] == m_aNumEntities[Type])
+	{
+		for(CEntity *pEnt = m_apFirstEntityTypes[Type]; pEnt;)
 		{
 			m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
 			pEnt->Snap(SnappingClient);
 			pEnt = m_pNextTraverseEntity;
 		}
+		return;
+	}
+
+	// only the entities in the cells around the view can be seen
+	m_vpSnapEntities.clear();
+	m_Grid.ForEach(Type, ViewMin, ViewMax, [&](CEntity *pEnt) {
+		if(pEnt->m_SnapOnlyInView)
+			m_vpSnapEntities.push_back(pEnt);
+	});
+	for(CEntity *pEnt = m_apFirstAlwaysSnapEntities[Type]; pEnt; pEnt = pEnt->m_pNextAlwaysSnapEntity)
+		m_vpSnapEntities.push_back(pEnt);
+
+	// snap in list order to get the same snapshot as without culling
+	std::sort(m_vpSnapEntities.begin(), m_vpSnapEntities.end(), [](const CEntity *pA, const CEntity *pB) {
+		return pA->m_ListOrder > pB->m_ListOrder;
+	});
+	for(CEntity *pEnt : m_vpSnapEntities)
+		pEnt->Snap(SnappingClient);
+}
+
+void CGameWorld::Snap(int SnappingClient)
+{
+	vec2 ViewMin, ViewMax;
+	const bool Cull = SnapView(SnappingClient, &ViewMin, &ViewMax);
+
+	SnapEntities(ENTTYPE_CHARACTER, SnappingClient, Cull, ViewMin, ViewMax);
+	for(int i = 0; i < NUM_ENTTYPES; i++)
+	{
+		if(i == ENTTYPE_CHARACTER)
+			continue;
+		SnapEntities(i, SnappingClient, Cull, ViewMin, ViewMax);
 	}
 }
 
@@ -214,9 +375,15 @@ void CGameWorld::Tick()
 		if(GameServer()->m_pController->IsForceBalanced())
 			GameServer()->SendChat(-1, TEAM_ALL, "Teams have been balanced");
 
+		m_Core.m_UseBroadphase = g_Config.m_SvCoreBroadphase;
+		if(m_Core.m_UseBroadphase)
+			m_Core.UpdateBroadphase();
+
 		// update all objects
 		for(int i = 0; i < NUM_ENTTYPES; i++)
 		{
+			const int64_t Start = m_ProfileEntityTicks ? time_get_nanoseconds().count() : 0;
+
 			// It's important to call PreTick() and Tick() after each other.
 			// If we call PreTick() before, and Tick() after other entities have been processed, it causes physics changes such as a stronger shotgun or grenade.
 			if(g_Config.m_SvNoWeakHook && i == ENTTYPE_CHARACTER)
@@ -235,17 +402,48 @@ void CGameWorld::Tick()
 			{
 				m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
 				pEnt->Tick();
+				m_aNumTicked[i]++;
+				// characters can teleport during their tick
+				if(i == ENTTYPE_CHARACTER && m_Core.m_UseBroadphase)
+					m_Core.UpdateBroadphase(((CCharacter *)pEnt)->GetPlayer()->GetCid());
 				pEnt = m_pNextTraverseEntity;
 			}
+
+			if(m_ProfileEntityTicks)
+				m_aTickDuration[i] += time_get_nanoseconds().count() - Start;
 		}
 
-		for(auto *pEnt : m_apFirstEntityTypes)
+		// (re)start the worker threads if the configuration changed
+		if(m_TeamWorkers.NumThreads() != Config()->m_SvTeamThreads)
+		{
+			if(m_TeamWorkers.NumThreads())
+				m_TeamWorkers.Shutdown();
+			if(Config()->m_SvTeamThreads)
+				m_TeamWorkers.Init(Config()->m_SvTeamThreads);
+		}
+		// characters of different teams don't interact, move their cores
+		// in parallel before the rest of the deferred tick
+		if(m_TeamWorkers.NumThreads())
+		{
+			const int64_t Start = m_ProfileEntityTicks ? time_get_nanoseconds().count() : 0;
+			m_TeamWorkers.MoveCores(&GameServer()->m_pController->Teams().m_Core, (CCharacter *)m_apFirstEntityTypes[ENTTYPE_CHARACTER]);
+			if(m_ProfileEntityTicks)
+				m_aTickDuration[ENTTYPE_CHARACTER] += time_get_nanoseconds().count() - Start;
+		}
+
+		for(int i = 0; i < NUM_ENTTYPES; i++)
+		{
+			const int64_t Start = m_ProfileEntityTicks ? time_get_nanoseconds().count() : 0;
+			auto *pEnt = m_apFirstEntityTypes[i];
 			for(; pEnt;)
 			{
 				m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
 				pEnt->TickDeferred();
 				pEnt = m_pNextTraverseEntity;
 			}
+			if(m_ProfileEntityTicks)
+				m_aTickDuration[i] += time_get_nanoseconds().count() - Start;
+		}
 	}
 	else
 	{
@@ -300,87 +498,115 @@ void CGameWorld::SwapClients(int Client1, int Client2)
 // TODO: should be more general
 CCharacter *CGameWorld::IntersectCharacter(vec2 Pos0, vec2 Pos1, float Radius, vec2 &NewPos, const CCharacter *pNotThis, int CollideWith, const CCharacter *pThisOnly)
 {
-	// Find other players
-	float ClosestLen = distance(Pos0, Pos1) * 100.0f;
-	CCharacter *pClosest = 0;
+	const auto &&Intersect = [&](bool UseGrid, vec2 *pNewPos) {
+		// Find other players
+		float ClosestLen = distance(Pos0, Pos1) * 100.0f;
+		CCharacter *pClosest = 0;
 
-	CCharacter *p = (CCharacter *)FindFirst(ENTTYPE_CHARACTER);
-	for(; p; p = (CCharacter *)p->TypeNext())
-	{
-		if(p == pNotThis)
-			continue;
+		ForEachCandidate(ENTTYPE_CHARACTER, Pos0, Pos1, Radius, UseGrid, [&](CEntity *pEnt) {
+			CCharacter *p = (CCharacter *)pEnt;
+			if(p == pNotThis)
+				return true;
 
-		if(pThisOnly && p != pThisOnly)
-			continue;
+			if(pThisOnly && p != pThisOnly)
+				return true;
 
-		if(CollideWith != -1 && !p->CanCollide(CollideWith))
-			continue;
+			if(CollideWith != -1 && !p->CanCollide(CollideWith))
+				return true;
 
-		vec2 IntersectPos;
-		if(closest_point_on_line(Pos0, Pos1, p->m_Pos, IntersectPos))
-		{
-			float Len = distance(p->m_Pos, IntersectPos);
-			if(Len < p->m_ProximityRadius + Radius)
+			vec2 IntersectPos;
+			if(closest_point_on_line(Pos0, Pos1, p->m_Pos, IntersectPos))
 			{
-				Len = distance(Pos0, IntersectPos);
-				if(Len < ClosestLen)
+				float Len = distance(p->m_Pos, IntersectPos);
+				if(Len < p->m_ProximityRadius + Radius)
 				{
-					NewPos = IntersectPos;
-					ClosestLen = Len;
-					pClosest = p;
+					Len = distance(Pos0, IntersectPos);
+					if(Len < ClosestLen)
+					{
+						*pNewPos = IntersectPos;
+						ClosestLen = Len;
+						pClosest = p;
+					}
 				}
 			}
-		}
-	}
+			return true;
+		});
+		return pClosest;
+	};
 
+	CCharacter *pClosest = Intersect(true, &NewPos);
+#ifdef CONF_DEBUG
+	if(Config()->m_DbgWorldGrid)
+	{
+		vec2 ExpectedPos = NewPos;
+		dbg_assert(Intersect(false, &ExpectedPos) == pClosest && ExpectedPos == NewPos, "grid changed the intersected character");
+	}
+#endif
 	return pClosest;
 }
 
 CCharacter *CGameWorld::ClosestCharacter(vec2 Pos, float Radius, const CEntity *pNotThis)
 {
-	// Find other players
-	float ClosestRange = Radius * 2;
-	CCharacter *pClosest = 0;
+	const auto &&Closest = [&](bool UseGrid) {
+		// Find other players
+		float ClosestRange = Radius * 2;
+		CCharacter *pClosest = 0;
 
-	CCharacter *p = (CCharacter *)GameServer()->m_World.FindFirst(ENTTYPE_CHARACTER);
-	for(; p; p = (CCharacter *)p->TypeNext())
-	{
-		if(p == pNotThis)
-			continue;
+		ForEachCandidate(ENTTYPE_CHARACTER, Pos, Pos, Radius, UseGrid, [&](CEntity *pEnt) {
+			CCharacter *p = (CCharacter *)pEnt;
+			if(p == pNotThis)
+				return true;
 
-		float Len = distance(Pos, p->m_Pos);
-		if(Len < p->m_ProximityRadius + Radius)
-		{
-			if(Len < ClosestRange)
+			float Len = distance(Pos, p->m_Pos);
+			if(Len < p->m_ProximityRadius + Radius)
 			{
-				ClosestRange = Len;
-				pClosest = p;
+				if(Len < ClosestRange)
+				{
+					ClosestRange = Len;
+					pClosest = p;
+				}
 			}
-		}
-	}
+			return true;
+		});
+		return pClosest;
+	};
 
+	CCharacter *pClosest = Closest(true);
+#ifdef CONF_DEBUG
+	if(Config()->m_DbgWorldGrid)
+		dbg_assert(Closest(false) == pClosest, "grid changed the closest character");
+#endif
 	return pClosest;
 }
 
 std::vector<CCharacter *> CGameWorld::IntersectedCharacters(vec2 Pos0, vec2 Pos1, float Radius, const CEntity *pNotThis)
 {
-	std::vector<CCharacter *> vpCharacters;
-	CCharacter *pChr = (CCharacter *)FindFirst(CGameWorld::ENTTYPE_CHARACTER);
-	for(; pChr; pChr = (CCharacter *)pChr->TypeNext())
-	{
-		if(pChr == pNotThis)
-			continue;
-
-		vec2 IntersectPos;
-		if(closest_point_on_line(Pos0, Pos1, pChr->m_Pos, IntersectPos))
-		{
-			float Len = distance(pChr->m_Pos, IntersectPos);
-			if(Len < pChr->m_ProximityRadius + Radius)
+	const auto &&Intersected = [&](bool UseGrid) {
+		std::vector<CCharacter *> vpCharacters;
+		ForEachCandidate(ENTTYPE_CHARACTER, Pos0, Pos1, Radius, UseGrid, [&](CEntity *pEnt) {
+			CCharacter *pChr = (CCharacter *)pEnt;
+			if(pChr == pNotThis)
+				return true;
+
+			vec2 IntersectPos;
+			if(closest_point_on_line(Pos0, Pos1, pChr->m_Pos, IntersectPos))
 			{
-				vpCharacters.push_back(pChr);
+				float Len = distance(pChr->m_Pos, IntersectPos);
+				if(Len < pChr->m_ProximityRadius + Radius)
+				{
+					vpCharacters.push_back(pChr);
+				}
 			}
-		}
-	}
+			return true;
+		});
+		return vpCharacters;
+	};
+
+	std::vector<CCharacter *> vpCharacters = Intersected(true);
+#ifdef CONF_DEBUG
+	if(Config()->m_DbgWorldGrid)
+		dbg_assert(Intersected(false) == vpCharacters, "grid changed the intersected characters");
+#endif
 	return vpCharacters;
 }
 
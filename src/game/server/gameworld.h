@@ -5,7 +5,9 @@
 
 #include <game/gamecore.h>
 
+#include "entity_grid.h"
 #include "save.h"
+#include "teamworkers.h"
 
 #include <vector>
 
@@ -36,6 +38,46 @@ private:
 
 	CEntity *m_pNextTraverseEntity = nullptr;
 	CEntity *m_apFirstEntityTypes[NUM_ENTTYPES];
+	int m_aNumEntities[NUM_ENTTYPES];
+	int64_t m_NextListOrder;
+
+	/*
+		Uniform grid over the map, see CEntityGrid. The position based
+		queries only look at the cells close to the query and return the
+		same entities in the same order as walking the type lists would.
+	*/
+	CEntityGrid<CEntity> m_Grid;
+	float m_aGridMaxRadius[NUM_ENTTYPES];
+
+	enum
+	{
+		// the candidates of a query are collected on the stack, queries
+		// with more candidates walk the type list
+		MAX_CANDIDATES = 256,
+	};
+
+	void GridInsert(CEntity *pEnt);
+	// calls Fn with the entities that may be within Radius of the line in
+	// list order, until it returns false
+	template<typename F>
+	void ForEachCandidate(int Type, vec2 Pos0, vec2 Pos1, float Radius, bool UseGrid, F &&Fn);
+
+	// entities that don't snap only in view, in list order
+	CEntity *m_apFirstAlwaysSnapEntities[NUM_ENTTYPES];
+	int m_aNumAlwaysSnapEntities[NUM_ENTTYPES];
+	std::vector<CEntity *> m_vpSnapEntities;
+
+	bool SnapView(int SnappingClient, vec2 *pViewMin, vec2 *pViewMax);
+	void SnapEntities(int Type, int SnappingClient, bool Cull, vec2 ViewMin, vec2 ViewMax);
+
+	CTeamWorkers m_TeamWorkers;
+
+	// time spent ticking the entities of each type in nanoseconds, only
+	// measured if enabled, and the number of entity ticks, including the
+	// deferred and parallel parts
+	bool m_ProfileEntityTicks;
+	int64_t m_aTickDuration[NUM_ENTTYPES];
+	int64_t m_aNumTicked[NUM_ENTTYPES];
 
 	class CGameContext *m_pGameServer;
 	class CConfig *m_pConfig;
@@ -57,6 +99,11 @@ public:
 
 	CEntity *FindFirst(int Type);
 
+	static const char *EntityTypeName(int Type);
+	void EnableProfiling() { m_ProfileEntityTicks = true; }
+	int64_t TickDuration(int Type) const { return m_aTickDuration[Type]; }
+	int64_t NumTicked(int Type) const { return m_aNumTicked[Type]; }
+
 	/*
 		Function: FindEntities
 			Finds entities close to a position and returns them in a list.
@@ -121,6 +168,16 @@ public:
 	*/
 	void RemoveEntity(CEntity *pEntity);
 
+	/*
+		Function: UpdateGridEntity
+			Moves an entity to the grid cell of its current position,
+			called by CEntity::SetPos.
+
+		Arguments:
+			pEntity - Entity that moved
+	*/
+	void UpdateGridEntity(CEntity *pEntity);
+
 	void RemoveEntitiesFromPlayer(int PlayerId);
 	void RemoveEntitiesFromPlayers(int PlayerIds[], int NumPlayers);
 
@@ -0,0 +1,129 @@
+#include "teamworkers.h"
+
+#include <game/server/entities/character.h>
+#include <game/server/player.h>
+#include <game/teamscore.h>
+
+CTeamWorkers::CTeamWorkers() :
+	m_Shutdown(true),
+	m_NextTask(0)
+{
+}
+
+CTeamWorkers::~CTeamWorkers()
+{
+	if(!m_Shutdown)
+	{
+		Shutdown();
+	}
+}
+
+void CTeamWorkers::WorkerThread(void *pUser)
+{
+	CWorker *pWorker = static_cast<CWorker *>(pUser);
+	CTeamWorkers *pPool = pWorker->m_pPool;
+	while(true)
+	{
+		sphore_wait(&pWorker->m_Start);
+		if(pPool->m_Shutdown)
+			break;
+		pPool->RunTasks();
+		sphore_signal(&pPool->m_Done);
+	}
+}
+
+void CTeamWorkers::RunTasks()
+{
+	while(true)
+	{
+		const int Index = m_NextTask.fetch_add(1);
+		if(Index >= (int)m_vTasks.size())
+			break;
+		const CTask &Task = m_vTasks[Index];
+		for(int i = Task.m_First; i < Task.m_End; i++)
+			m_vpCharacters[i]->MoveCore();
+	}
+}
+
+void CTeamWorkers::Init(int NumThreads)
+{
+	dbg_assert(m_Shutdown, "Team workers already running");
+	m_Shutdown = false;
+
+	sphore_init(&m_Done);
+
+	char aName[16]; // unix kernel length limit
+	m_vpWorkers.reserve(NumThreads);
+	for(int i = 0; i < NumThreads; i++)
+	{
+		m_vpWorkers.push_back(std::make_unique<CWorker>());
+		CWorker *pWorker = m_vpWorkers.back().get();
+		pWorker->m_pPool = this;
+		sphore_init(&pWorker->m_Start);
+		str_format(aName, sizeof(aName), "team worker %d", i);
+		pWorker->m_pThread = thread_init(WorkerThread, pWorker, aName);
+	}
+}
+
+void CTeamWorkers::Shutdown()
+{
+	dbg_assert(!m_Shutdown, "Team workers already shut down");
+	m_Shutdown = true;
+
+	for(auto &pWorker : m_vpWorkers)
+		sphore_signal(&pWorker->m_Start);
+	for(auto &pWorker : m_vpWorkers)
+	{
+		thread_wait(pWorker->m_pThread);
+		sphore_destroy(&pWorker->m_Start);
+	}
+	m_vpWorkers.clear();
+
+	sphore_destroy(&m_Done);
+}
+
+bool CTeamWorkers::MoveCores(const CTeamsCore *pTeams, CCharacter *pFirstCharacter)
+{
+	const int SuperTeam = pTeams->m_IsDDRace16 ? VANILLA_TEAM_SUPER : TEAM_SUPER;
+
+	// count the characters per team, super characters collide with
+	// everyone and need the serial order
+	int aTeamSizes[NUM_DDRACE_TEAMS] = {0};
+	int NumCharacters = 0;
+	for(CCharacter *pChr = pFirstCharacter; pChr; pChr = (CCharacter *)pChr->TypeNext())
+	{
+		const int Team = pTeams->Team(pChr->GetPlayer()->GetCid());
+		if(Team == SuperTeam || pChr->IsSuper() || Team < 0 || Team >= NUM_DDRACE_TEAMS)
+			return false;
+		aTeamSizes[Team]++;
+		NumCharacters++;
+	}
+
+	int aTeamStarts[NUM_DDRACE_TEAMS];
+	m_vTasks.clear();
+	int Start = 0;
+	for(int Team = 0; Team < NUM_DDRACE_TEAMS; Team++)
+	{
+		aTeamStarts[Team] = Start;
+		if(aTeamSizes[Team])
+			m_vTasks.push_back({Start, Start + aTeamSizes[Team]});
+		Start += aTeamSizes[Team];
+	}
+	if(m_vTasks.size() < 2)
+		return false;
+
+	m_vpCharacters.resize(NumCharacters);
+	for(CCharacter *pChr = pFirstCharacter; pChr; pChr = (CCharacter *)pChr->TypeNext())
+		m_vpCharacters[aTeamStarts[pTeams->Team(pChr->GetPlayer()->GetCid())]++] = pChr;
+
+	m_NextTask = 0;
+	for(auto &pWorker : m_vpWorkers)
+		sphore_signal(&pWorker->m_Start);
+
+	// help out instead of idling
+	RunTasks();
+
+	for(size_t i = 0; i < m_vpWorkers.size(); i++)
+		sphore_wait(&m_Done);
+	return true;
+}
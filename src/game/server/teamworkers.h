@@ -0,0 +1,83 @@
+#ifndef GAME_SERVER_TEAMWORKERS_H
+#define GAME_SERVER_TEAMWORKERS_H
+
+#include <base/system.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class CCharacter;
+class CTeamsCore;
+
+/**
+ * Moves the characters of different teams in parallel on worker threads.
+ *
+ * Characters of different teams can't collide, so `CCharacter::MoveCore`
+ * of one team never looks at the cores of another one. The characters of
+ * a team are moved in their usual order on one thread, which keeps the
+ * results exactly the same as moving all of them on the main thread.
+ *
+ * Everything else the characters do in a tick touches shared game state
+ * (events, chat, score, teams) and stays on the main thread.
+ */
+class CTeamWorkers
+{
+	class CWorker
+	{
+	public:
+		CTeamWorkers *m_pPool;
+		void *m_pThread;
+		SEMAPHORE m_Start;
+	};
+
+	class CTask
+	{
+	public:
+		int m_First;
+		int m_End;
+	};
+
+	std::vector<std::unique_ptr<CWorker>> m_vpWorkers;
+	SEMAPHORE m_Done;
+	std::atomic<bool> m_Shutdown;
+	std::atomic<int> m_NextTask;
+
+	// the characters sorted by team, in list order within a team
+	std::vector<CCharacter *> m_vpCharacters;
+	// one task per team with characters
+	std::vector<CTask> m_vTasks;
+
+	static void WorkerThread(void *pUser);
+	void RunTasks();
+
+public:
+	CTeamWorkers();
+	~CTeamWorkers();
+
+	/**
+	 * Starts the worker threads.
+	 *
+	 * @param NumThreads Number of worker threads, the calling thread helps out as well.
+	 */
+	void Init(int NumThreads);
+	void Shutdown();
+	int NumThreads() const { return m_vpWorkers.size(); }
+
+	/**
+	 * Calls `CCharacter::MoveCore` of all characters and blocks until all of
+	 * them are done.
+	 *
+	 * Nothing is done if the characters can't be split into independent
+	 * teams, e.g. because of super characters that collide with everyone,
+	 * or if there is only one team.
+	 *
+	 * @param pTeams The teams of the characters.
+	 * @param pFirstCharacter The first character of the world's list.
+	 *
+	 * @return `true` if the characters were moved.
+	 */
+	bool MoveCores(const CTeamsCore *pTeams, CCharacter *pFirstCharacter);
+};
+
+#endif
@@ -10,7 +10,7 @@
 static const char TEEHISTORIAN_NAME[] = "teehistorian@ddnet.tw";
 static const CUuid TEEHISTORIAN_UUID = CalculateUuid(TEEHISTORIAN_NAME);
 static const char TEEHISTORIAN_VERSION[] = "2";
-static const char TEEHISTORIAN_VERSION_MINOR[] = "8";
+static const char TEEHISTORIAN_VERSION_MINOR[] = "9";
 
 #define UUID(id, name) static const CUuid UUID_##id = CalculateUuid(name);
 #include <engine/shared/teehistorian_ex_chunks.h>
@@ -57,6 +57,9 @@ void CTeeHistorian::Reset(const CGameInfo *pGameInfo, WRITE_CALLBACK pfnWriteCal
 		PrevPlayer.m_Alive = false;
 		// zero means no id
 		PrevPlayer.m_UniqueClientId = 0;
+		PrevPlayer.m_InputTick = -1;
+		PrevPlayer.m_FirstInputSkipped = false;
+		PrevPlayer.m_DirectUniqueClientId = 0;
 		PrevPlayer.m_Team = 0;
 	}
 	for(auto &PrevTeam : m_aPrevTeams)
@@ -427,14 +430,37 @@ void CTeeHistorian::RecordPlayerInput(int ClientId, uint32_t UniqueClientId, con
 	CPacker Buffer;
 
 	CTeehistorianPlayer *pPrev = &m_aPrevPlayers[ClientId];
+	const bool FirstOfTick = pPrev->m_InputTick != m_Tick;
+	pPrev->m_InputTick = m_Tick;
+	if(FirstOfTick)
+	{
+		pPrev->m_FirstInputSkipped = false;
+	}
 	CNetObj_PlayerInput DiffInput;
 	if(pPrev->m_UniqueClientId == UniqueClientId)
 	{
 		if(mem_comp(&pPrev->m_Input, pInput, sizeof(pPrev->m_Input)) == 0)
 		{
+			if(FirstOfTick)
+			{
+				pPrev->m_FirstInputSkipped = true;
+			}
 			return;
 		}
 		EnsureTickWritten();
+		if(pPrev->m_FirstInputSkipped)
+		{
+			// a different input follows the unchanged first one
+			Buffer.Reset();
+			Buffer.AddInt(-TEEHISTORIAN_INPUT_DIFF);
+			Buffer.AddInt(ClientId);
+			for(size_t i = 0; i < sizeof(DiffInput) / sizeof(int32_t); i++)
+			{
+				Buffer.AddInt(0);
+			}
+			Write(Buffer.Data(), Buffer.Size());
+			pPrev->m_FirstInputSkipped = false;
+		}
 		Buffer.Reset();
 
 		Buffer.AddInt(-TEEHISTORIAN_INPUT_DIFF);
@@ -469,6 +495,39 @@ void CTeeHistorian::RecordPlayerInput(int ClientId, uint32_t UniqueClientId, con
 	Write(Buffer.Data(), Buffer.Size());
 }
 
+void CTeeHistorian::RecordPlayerDirectInput(int ClientId, uint32_t UniqueClientId, const CNetObj_PlayerInput *pInput)
+{
+	EnsureTickWritten();
+
+	// unchanged direct inputs count for the game too, e.g. for automatic
+	// weapons, write all of them
+	CTeehistorianPlayer *pPrev = &m_aPrevPlayers[ClientId];
+	const bool New = pPrev->m_DirectUniqueClientId != UniqueClientId;
+	CNetObj_PlayerInput DiffInput;
+	if(New)
+		DiffInput = *pInput;
+	else
+		CSnapshotDelta::DiffItem((int *)&pPrev->m_DirectInput, (int *)pInput, (int *)&DiffInput, sizeof(DiffInput) / sizeof(int32_t));
+
+	CPacker Buffer;
+	Buffer.Reset();
+	Buffer.AddInt(ClientId);
+	Buffer.AddInt(New);
+	for(size_t i = 0; i < sizeof(DiffInput) / sizeof(int32_t); i++)
+	{
+		Buffer.AddInt(((int *)&DiffInput)[i]);
+	}
+	pPrev->m_DirectUniqueClientId = UniqueClientId;
+	pPrev->m_DirectInput = *pInput;
+
+	if(m_Debug)
+	{
+		dbg_msg("teehistorian", "direct_input cid=%d new=%d", ClientId, New);
+	}
+
+	WriteExtra(UUID_TEEHISTORIAN_PLAYER_DIRECT_INPUT, Buffer.Data(), Buffer.Size());
+}
+
 void CTeeHistorian::RecordPlayerMessage(int ClientId, const void *pMsg, int MsgSize)
 {
 	EnsureTickWritten();
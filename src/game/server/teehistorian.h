@@ -65,6 +65,7 @@ public:
 
 	void BeginInputs();
 	void RecordPlayerInput(int ClientId, uint32_t UniqueClientId, const CNetObj_PlayerInput *pInput);
+	void RecordPlayerDirectInput(int ClientId, uint32_t UniqueClientId, const CNetObj_PlayerInput *pInput);
 	void RecordPlayerMessage(int ClientId, const void *pMsg, int MsgSize);
 	void RecordPlayerJoin(int ClientId, int Protocol);
 	void RecordPlayerRejoin(int ClientId);
@@ -124,6 +125,14 @@ private:
 
 		CNetObj_PlayerInput m_Input;
 		uint32_t m_UniqueClientId;
+		// the server applies the first input of a tick, if it's unchanged
+		// it's only written if a different one follows
+		int m_InputTick;
+		bool m_FirstInputSkipped;
+
+		// the last input given to the game as soon as it was received
+		CNetObj_PlayerInput m_DirectInput;
+		uint32_t m_DirectUniqueClientId;
 
 		// DDNet team
 		int m_Team;
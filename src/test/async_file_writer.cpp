@@ -0,0 +1,169 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/async_file_writer.h>
+
+#include <zlib.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class AsyncFileWriter : public ::testing::Test
+{
+protected:
+	CAsyncFileWriter m_Writer;
+	CTestInfo m_Info;
+	std::vector<unsigned char> m_vExpected;
+
+	~AsyncFileWriter()
+	{
+		fs_remove(m_Info.m_aFilename);
+	}
+
+	void Open(int CompressionLevel, int MaxBufferSize = 0)
+	{
+		IOHANDLE File = io_open(m_Info.m_aFilename, IOFLAG_WRITE);
+		ASSERT_TRUE(File);
+		m_Writer.Open(File, CompressionLevel, MaxBufferSize);
+	}
+
+	void Write(int Size)
+	{
+		std::vector<unsigned char> vData(Size);
+		for(int i = 0; i < Size; i++)
+			vData[i] = (m_vExpected.size() + i) % 251 < 100 ? 'a' : (m_vExpected.size() + i) % 251;
+		m_Writer.Write(vData.data(), vData.size());
+		m_vExpected.insert(m_vExpected.end(), vData.begin(), vData.end());
+	}
+
+	std::vector<unsigned char> ReadFile()
+	{
+		std::vector<unsigned char> vData;
+		IOHANDLE File = io_open(m_Info.m_aFilename, IOFLAG_READ);
+		if(!File)
+			return vData;
+		unsigned char aBuf[4096];
+		unsigned Read;
+		while((Read = io_read(File, aBuf, sizeof(aBuf))) > 0)
+			vData.insert(vData.end(), aBuf, aBuf + Read);
+		io_close(File);
+		return vData;
+	}
+
+	// returns the data up to where the file could be decompressed
+	static std::vector<unsigned char> Inflate(const std::vector<unsigned char> &vCompressed, bool *pComplete)
+	{
+		z_stream Stream;
+		mem_zero(&Stream, sizeof(Stream));
+		EXPECT_EQ(inflateInit2(&Stream, MAX_WBITS + 16), Z_OK);
+		Stream.next_in = (Bytef *)vCompressed.data();
+		Stream.avail_in = vCompressed.size();
+		std::vector<unsigned char> vData;
+		unsigned char aBuf[4096];
+		int Result;
+		do
+		{
+			Stream.next_out = aBuf;
+			Stream.avail_out = sizeof(aBuf);
+			Result = inflate(&Stream, Z_NO_FLUSH);
+			vData.insert(vData.end(), aBuf, aBuf + sizeof(aBuf) - Stream.avail_out);
+		} while(Result == Z_OK);
+		inflateEnd(&Stream);
+		*pComplete = Result == Z_STREAM_END;
+		return vData;
+	}
+};
+
+TEST_F(AsyncFileWriter, Uncompressed)
+{
+	Open(CAsyncFileWriter::COMPRESSION_NONE);
+	Write(1);
+	Write(100000);
+	m_Writer.FlushPoint();
+	Write(1000);
+	m_Writer.Close();
+	EXPECT_EQ(m_Writer.Error(), 0);
+	EXPECT_EQ(ReadFile(), m_vExpected);
+
+	CAsyncFileWriter::CStats Stats = m_Writer.Stats();
+	EXPECT_EQ(Stats.m_BytesIn, 101001);
+	EXPECT_EQ(Stats.m_BytesOut, 101001);
+	EXPECT_EQ(Stats.m_NumFlushPoints, 1);
+}
+
+TEST_F(AsyncFileWriter, Compressed)
+{
+	Open(6);
+	for(int i = 0; i < 100; i++)
+	{
+		Write(1000 + i);
+		if(i % 10 == 0)
+			m_Writer.FlushPoint();
+	}
+	m_Writer.Close();
+	EXPECT_EQ(m_Writer.Error(), 0);
+
+	std::vector<unsigned char> vCompressed = ReadFile();
+	bool Complete;
+	EXPECT_EQ(Inflate(vCompressed, &Complete), m_vExpected);
+	EXPECT_TRUE(Complete);
+
+	CAsyncFileWriter::CStats Stats = m_Writer.Stats();
+	EXPECT_EQ(Stats.m_BytesIn, (int64_t)m_vExpected.size());
+	EXPECT_EQ(Stats.m_BytesOut, (int64_t)vCompressed.size());
+	EXPECT_LT(Stats.m_BytesOut, Stats.m_BytesIn);
+}
+
+TEST_F(AsyncFileWriter, CompressedEmpty)
+{
+	Open(1);
+	m_Writer.Close();
+	bool Complete;
+	EXPECT_TRUE(Inflate(ReadFile(), &Complete).empty());
+	EXPECT_TRUE(Complete);
+}
+
+TEST_F(AsyncFileWriter, FlushPointRecoverable)
+{
+	Open(9);
+	Write(50000);
+	m_Writer.FlushPoint();
+
+	// the file isn't finished, but everything up to the flush point can
+	// be decompressed once it's written
+	std::vector<unsigned char> vRecovered;
+	bool Complete = false;
+	for(int i = 0; i < 1000 && vRecovered.size() < m_vExpected.size(); i++)
+	{
+		vRecovered = Inflate(ReadFile(), &Complete);
+		if(vRecovered.size() < m_vExpected.size())
+			std::this_thread::sleep_for(10ms);
+	}
+	EXPECT_EQ(vRecovered, m_vExpected);
+	EXPECT_FALSE(Complete);
+
+	Write(1000);
+	m_Writer.Close();
+	EXPECT_EQ(Inflate(ReadFile(), &Complete), m_vExpected);
+	EXPECT_TRUE(Complete);
+}
+
+TEST_F(AsyncFileWriter, MaxBufferSize)
+{
+	Open(1, 4096);
+	for(int i = 0; i < 1000; i++)
+		Write(100);
+	// larger than the maximum, written once the buffer is empty
+	Write(10000);
+	m_Writer.Close();
+	EXPECT_EQ(m_Writer.Error(), 0);
+
+	bool Complete;
+	EXPECT_EQ(Inflate(ReadFile(), &Complete), m_vExpected);
+	EXPECT_TRUE(Complete);
+	EXPECT_LE(m_Writer.Stats().m_BufferPeak, 10000);
+}
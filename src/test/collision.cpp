@@ -0,0 +1,508 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/kernel.h>
+#include <engine/map.h>
+#include <engine/shared/config.h>
+#include <engine/storage.h>
+#include <game/collision.h>
+#include <game/gamecore.h>
+#include <game/layers.h>
+#include <game/mapitems.h>
+#include <game/prng.h>
+#include <game/teamscore.h>
+
+// The original pixel by pixel versions of the CCollision::Intersect*
+// functions, the empty space skipping must not change any result
+
+static int RefIntersectLine(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision)
+{
+	float Distance = distance(Pos0, Pos1);
+	int End(Distance + 1);
+	vec2 Last = Pos0;
+	for(int i = 0; i <= End; i++)
+	{
+		float a = i / (float)End;
+		vec2 Pos = mix(Pos0, Pos1, a);
+		int ix = round_to_int(Pos.x);
+		int iy = round_to_int(Pos.y);
+		if(Collision.CheckPoint(ix, iy))
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return Collision.GetCollisionAt(ix, iy);
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+static int RefIntersectLineTeleHook(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision, int *pTeleNr)
+{
+	float Distance = distance(Pos0, Pos1);
+	int End(Distance + 1);
+	vec2 Last = Pos0;
+	int dx = 0, dy = 0;
+	ThroughOffset(Pos0, Pos1, &dx, &dy);
+	for(int i = 0; i <= End; i++)
+	{
+		float a = i / (float)End;
+		vec2 Pos = mix(Pos0, Pos1, a);
+		int ix = round_to_int(Pos.x);
+		int iy = round_to_int(Pos.y);
+
+		int Index = Collision.GetPureMapIndex(Pos);
+		if(g_Config.m_SvOldTeleportHook)
+			*pTeleNr = Collision.IsTeleport(Index);
+		else
+			*pTeleNr = Collision.IsTeleportHook(Index);
+		if(*pTeleNr)
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return TILE_TELEINHOOK;
+		}
+
+		int hit = 0;
+		if(Collision.CheckPoint(ix, iy))
+		{
+			if(!Collision.IsThrough(ix, iy, dx, dy, Pos0, Pos1))
+				hit = Collision.GetCollisionAt(ix, iy);
+		}
+		else if(Collision.IsHookBlocker(ix, iy, Pos0, Pos1))
+		{
+			hit = TILE_NOHOOK;
+		}
+		if(hit)
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return hit;
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+static int RefIntersectLineTeleWeapon(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision, int *pTeleNr)
+{
+	float Distance = distance(Pos0, Pos1);
+	int End(Distance + 1);
+	vec2 Last = Pos0;
+	for(int i = 0; i <= End; i++)
+	{
+		float a = i / (float)End;
+		vec2 Pos = mix(Pos0, Pos1, a);
+		int ix = round_to_int(Pos.x);
+		int iy = round_to_int(Pos.y);
+
+		int Index = Collision.GetPureMapIndex(Pos);
+		if(g_Config.m_SvOldTeleportWeapons)
+			*pTeleNr = Collision.IsTeleport(Index);
+		else
+			*pTeleNr = Collision.IsTeleportWeapon(Index);
+		if(*pTeleNr)
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return TILE_TELEINWEAPON;
+		}
+
+		if(Collision.CheckPoint(ix, iy))
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return Collision.GetCollisionAt(ix, iy);
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+static int RefIntersectNoLaser(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision)
+{
+	float d = distance(Pos0, Pos1);
+	vec2 Last = Pos0;
+	for(int i = 0, id = std::ceil(d); i < id; i++)
+	{
+		float a = i / d;
+		vec2 Pos = mix(Pos0, Pos1, a);
+		int Nx = clamp(round_to_int(Pos.x) / 32, 0, Collision.GetWidth() - 1);
+		int Ny = clamp(round_to_int(Pos.y) / 32, 0, Collision.GetHeight() - 1);
+		if(Collision.GetIndex(Nx, Ny) == TILE_SOLID || Collision.GetIndex(Nx, Ny) == TILE_NOHOOK || Collision.GetIndex(Nx, Ny) == TILE_NOLASER || Collision.GetFIndex(Nx, Ny) == TILE_NOLASER)
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			if(Collision.GetFIndex(Nx, Ny) == TILE_NOLASER)
+				return Collision.GetFCollisionAt(Pos.x, Pos.y);
+			else
+				return Collision.GetCollisionAt(Pos.x, Pos.y);
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+static int RefIntersectNoLaserNW(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision)
+{
+	float d = distance(Pos0, Pos1);
+	vec2 Last = Pos0;
+	for(int i = 0, id = std::ceil(d); i < id; i++)
+	{
+		float a = (float)i / d;
+		vec2 Pos = mix(Pos0, Pos1, a);
+		if(Collision.IsNoLaser(round_to_int(Pos.x), round_to_int(Pos.y)) || Collision.IsFNoLaser(round_to_int(Pos.x), round_to_int(Pos.y)))
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			if(Collision.IsNoLaser(round_to_int(Pos.x), round_to_int(Pos.y)))
+				return Collision.GetCollisionAt(Pos.x, Pos.y);
+			else
+				return Collision.GetFCollisionAt(Pos.x, Pos.y);
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+// The previous `CCollision::GetMapIndices`
+static std::vector<int> RefGetMapIndices(const CCollision &Collision, vec2 PrevPos, vec2 Pos)
+{
+	std::vector<int> vIndices;
+	float d = distance(PrevPos, Pos);
+	int End(d + 1);
+	if(!d)
+	{
+		int Nx = clamp((int)Pos.x / 32, 0, Collision.GetWidth() - 1);
+		int Ny = clamp((int)Pos.y / 32, 0, Collision.GetHeight() - 1);
+		int Index = Ny * Collision.GetWidth() + Nx;
+		if(Collision.TileExists(Index))
+			vIndices.push_back(Index);
+		return vIndices;
+	}
+	int LastIndex = 0;
+	for(int i = 0; i < End; i++)
+	{
+		float a = i / d;
+		vec2 Tmp = mix(PrevPos, Pos, a);
+		int Nx = clamp((int)Tmp.x / 32, 0, Collision.GetWidth() - 1);
+		int Ny = clamp((int)Tmp.y / 32, 0, Collision.GetHeight() - 1);
+		int Index = Ny * Collision.GetWidth() + Nx;
+		if(Collision.TileExists(Index) && LastIndex != Index)
+		{
+			vIndices.push_back(Index);
+			LastIndex = Index;
+		}
+	}
+	return vIndices;
+}
+
+class Collision : public ::testing::Test
+{
+protected:
+	IKernel *m_pKernel = nullptr;
+	IEngineMap *m_pMap = nullptr;
+	CLayers m_Layers;
+	CCollision m_Collision;
+	CPrng m_Prng;
+
+	void SetUp() override
+	{
+		m_pKernel = IKernel::Create();
+		IStorage *pStorage = CreateLocalStorage();
+		ASSERT_TRUE(pStorage);
+		m_pKernel->RegisterInterface(pStorage);
+		m_pMap = CreateEngineMap();
+		m_pKernel->RegisterInterface(m_pMap);
+		m_pKernel->RegisterInterface(static_cast<IMap *>(m_pMap), false);
+
+		uint64_t aSeed[2] = {0xc011, 0x1510};
+		m_Prng.Seed(aSeed);
+	}
+
+	void TearDown() override
+	{
+		m_Collision.Unload();
+		m_Layers.Unload();
+		delete m_pKernel;
+	}
+
+	void LoadMap(const char *pMap)
+	{
+		char aPath[IO_MAX_PATH_LENGTH];
+		str_format(aPath, sizeof(aPath), "data/maps/%s.map", pMap);
+		ASSERT_TRUE(m_pMap->Load(aPath)) << pMap;
+		m_Layers.Init(m_pKernel);
+		m_Collision.Init(&m_Layers);
+	}
+
+	float RandomFloat(float Min, float Max)
+	{
+		return Min + (Max - Min) * m_Prng.RandomBits() / (float)0xffffffffu;
+	}
+
+	vec2 RandomPos()
+	{
+		// a bit outside of the map as well
+		vec2 Pos(RandomFloat(-64.0f, m_Collision.GetWidth() * 32.0f + 64.0f), RandomFloat(-64.0f, m_Collision.GetHeight() * 32.0f + 64.0f));
+		// exactly on pixels and in between, where the rounding decides
+		switch(m_Prng.RandomBits() % 4)
+		{
+		case 0: Pos = vec2(round_to_int(Pos.x), round_to_int(Pos.y)); break;
+		case 1: Pos = vec2(round_to_int(Pos.x) + 0.5f, round_to_int(Pos.y) + 0.5f); break;
+		}
+		return Pos;
+	}
+
+	vec2 RandomTo(vec2 From)
+	{
+		const float Length = RandomFloat(0.0f, 1200.0f);
+		switch(m_Prng.RandomBits() % 8)
+		{
+		case 0: return From + vec2(m_Prng.RandomBits() % 2 ? Length : -Length, 0.0f);
+		case 1: return From + vec2(0.0f, m_Prng.RandomBits() % 2 ? Length : -Length);
+		case 2: return From + vec2(Length, Length) * (m_Prng.RandomBits() % 2 ? 1.0f : -1.0f);
+		case 3: return From + vec2(m_Prng.RandomBits() % 3, m_Prng.RandomBits() % 3);
+		}
+		return From + direction(RandomFloat(0.0f, 2.0f * pi)) * Length;
+	}
+
+	void ExpectSameIntersections(int NumLines)
+	{
+		for(int Line = 0; Line < NumLines; Line++)
+		{
+			const vec2 From = RandomPos();
+			const vec2 To = RandomTo(From);
+			vec2 ExpectedCollision, ExpectedBefore, Col, Before;
+			int ExpectedTeleNr, TeleNr;
+
+			int Expected = RefIntersectLine(m_Collision, From, To, &ExpectedCollision, &ExpectedBefore);
+			ASSERT_EQ(m_Collision.IntersectLine(From, To, &Col, &Before), Expected) << "IntersectLine line " << Line;
+			ASSERT_EQ(ExpectedCollision, Col) << "IntersectLine line " << Line;
+			ASSERT_EQ(ExpectedBefore, Before) << "IntersectLine line " << Line;
+
+			Expected = RefIntersectLineTeleHook(m_Collision, From, To, &ExpectedCollision, &ExpectedBefore, &ExpectedTeleNr);
+			ASSERT_EQ(m_Collision.IntersectLineTeleHook(From, To, &Col, &Before, &TeleNr), Expected) << "IntersectLineTeleHook line " << Line;
+			ASSERT_EQ(ExpectedCollision, Col) << "IntersectLineTeleHook line " << Line;
+			ASSERT_EQ(ExpectedBefore, Before) << "IntersectLineTeleHook line " << Line;
+			ASSERT_EQ(ExpectedTeleNr, TeleNr) << "IntersectLineTeleHook line " << Line;
+
+			Expected = RefIntersectLineTeleWeapon(m_Collision, From, To, &ExpectedCollision, &ExpectedBefore, &ExpectedTeleNr);
+			ASSERT_EQ(m_Collision.IntersectLineTeleWeapon(From, To, &Col, &Before, &TeleNr), Expected) << "IntersectLineTeleWeapon line " << Line;
+			ASSERT_EQ(ExpectedCollision, Col) << "IntersectLineTeleWeapon line " << Line;
+			ASSERT_EQ(ExpectedBefore, Before) << "IntersectLineTeleWeapon line " << Line;
+			ASSERT_EQ(ExpectedTeleNr, TeleNr) << "IntersectLineTeleWeapon line " << Line;
+
+			Expected = RefIntersectNoLaser(m_Collision, From, To, &ExpectedCollision, &ExpectedBefore);
+			ASSERT_EQ(m_Collision.IntersectNoLaser(From, To, &Col, &Before), Expected) << "IntersectNoLaser line " << Line;
+			ASSERT_EQ(ExpectedCollision, Col) << "IntersectNoLaser line " << Line;
+			ASSERT_EQ(ExpectedBefore, Before) << "IntersectNoLaser line " << Line;
+
+			Expected = RefIntersectNoLaserNW(m_Collision, From, To, &ExpectedCollision, &ExpectedBefore);
+			ASSERT_EQ(m_Collision.IntersectNoLaserNW(From, To, &Col, &Before), Expected) << "IntersectNoLaserNW line " << Line;
+			ASSERT_EQ(ExpectedCollision, Col) << "IntersectNoLaserNW line " << Line;
+			ASSERT_EQ(ExpectedBefore, Before) << "IntersectNoLaserNW line " << Line;
+		}
+	}
+};
+
+static const char *const s_apMaps[] = {
+	"coverage",
+	"Tutorial",
+	"Gold Mine",
+	"Tsunami",
+	"ctf1",
+	"dm1",
+};
+
+TEST_F(Collision, IntersectEquivalence)
+{
+	for(const char *pMap : s_apMaps)
+	{
+		SCOPED_TRACE(pMap);
+		LoadMap(pMap);
+		ExpectSameIntersections(10000);
+
+		g_Config.m_SvOldTeleportHook = 1;
+		g_Config.m_SvOldTeleportWeapons = 1;
+		ExpectSameIntersections(2000);
+		g_Config.m_SvOldTeleportHook = 0;
+		g_Config.m_SvOldTeleportWeapons = 0;
+	}
+}
+
+TEST_F(Collision, IntersectEquivalenceSetCollisionAt)
+{
+	// tiles changed while the map is running, like lasers do
+	LoadMap("coverage");
+	for(int i = 0; i < 200; i++)
+	{
+		const vec2 Pos(RandomFloat(0.0f, m_Collision.GetWidth() * 32.0f), RandomFloat(0.0f, m_Collision.GetHeight() * 32.0f));
+		m_Collision.SetCollisionAt(Pos.x, Pos.y, m_Prng.RandomBits() % 2 ? TILE_SOLID : TILE_AIR);
+	}
+	ExpectSameIntersections(10000);
+}
+
+TEST_F(Collision, VisitMapIndices)
+{
+	for(const char *pMap : s_apMaps)
+	{
+		SCOPED_TRACE(pMap);
+		LoadMap(pMap);
+		for(int Line = 0; Line < 10000; Line++)
+		{
+			const vec2 From = RandomPos();
+			const vec2 To = RandomTo(From);
+			const std::vector<int> vExpected = RefGetMapIndices(m_Collision, From, To);
+
+			std::vector<int> vIndices;
+			const bool Found = m_Collision.VisitMapIndices(From, To, [&](int Index) {
+				vIndices.push_back(Index);
+				return true;
+			});
+			ASSERT_EQ(Found, !vExpected.empty()) << "line " << Line;
+			ASSERT_EQ(vIndices, vExpected) << "line " << Line;
+
+			// stopping early
+			if(vExpected.size() > 1)
+			{
+				const size_t Stop = m_Prng.RandomBits() % vExpected.size();
+				vIndices.clear();
+				m_Collision.VisitMapIndices(From, To, [&](int Index) {
+					vIndices.push_back(Index);
+					return vIndices.size() <= Stop;
+				});
+				ASSERT_EQ(vIndices, std::vector<int>(vExpected.begin(), vExpected.begin() + Stop + 1)) << "line " << Line;
+			}
+		}
+	}
+}
+
+TEST_F(Collision, VisitMapIndicesNoAllocations)
+{
+	LoadMap("coverage");
+	std::vector<vec2> vPositions;
+	for(int i = 0; i < 10000; i++)
+	{
+		vPositions.push_back(RandomPos());
+		vPositions.push_back(RandomTo(vPositions.back()));
+	}
+
+	// characters run this every tick, it must not touch the heap
+	const size_t AllocationsBefore = NumAllocations();
+	int NumIndices = 0;
+	for(size_t i = 0; i < vPositions.size(); i += 2)
+	{
+		m_Collision.VisitMapIndices(vPositions[i], vPositions[i + 1], [&](int Index) {
+			NumIndices++;
+			return true;
+		});
+	}
+	EXPECT_EQ(NumAllocations(), AllocationsBefore);
+	EXPECT_GT(NumIndices, 0);
+}
+
+TEST_F(Collision, CharacterTickNoAllocations)
+{
+	LoadMap("coverage");
+	CWorldCore World;
+	CTeamsCore Teams;
+	World.m_UseBroadphase = true;
+	// zeroed like the game's characters
+	CCharacterCore aCores[8] = {};
+	for(int i = 0; i < (int)std::size(aCores); i++)
+	{
+		aCores[i].Init(&World, &m_Collision, &Teams);
+		aCores[i].Reset();
+		aCores[i].m_Id = i;
+		World.m_apCharacters[i] = &aCores[i];
+	}
+
+	// a whole tick of the characters on a map with all the special tiles,
+	// hooking each other and getting teleported around, must not touch the
+	// heap
+	const size_t AllocationsBefore = NumAllocations();
+	int NumHookAttaches = 0;
+	for(int Tick = 0; Tick < 5000; Tick++)
+	{
+		for(auto &Core : aCores)
+		{
+			if(Tick % 500 == 0)
+				Core.m_Pos = vec2(RandomFloat(32.0f, (m_Collision.GetWidth() - 1) * 32.0f), RandomFloat(32.0f, (m_Collision.GetHeight() - 1) * 32.0f));
+			CNetObj_PlayerInput &Input = Core.m_Input;
+			Input.m_Jump = m_Prng.RandomBits() % 40 == 0;
+			if(m_Prng.RandomBits() % 25 == 0)
+				Input.m_Direction = (int)(m_Prng.RandomBits() % 3) - 1;
+			if(m_Prng.RandomBits() % 15 == 0)
+			{
+				Input.m_Hook = !Input.m_Hook;
+				const vec2 Dir = aCores[m_Prng.RandomBits() % std::size(aCores)].m_Pos - Core.m_Pos;
+				Input.m_TargetX = Dir.x != 0.0f || Dir.y != 0.0f ? (int)Dir.x : 1;
+				Input.m_TargetY = (int)Dir.y;
+			}
+		}
+		World.UpdateBroadphase();
+		for(int i = 0; i < (int)std::size(aCores); i++)
+		{
+			aCores[i].Tick(true);
+			World.UpdateBroadphase(i);
+		}
+		for(auto &Core : aCores)
+		{
+			Core.Move();
+			Core.Quantize();
+			if(Core.m_TriggeredEvents & COREEVENT_HOOK_ATTACH_PLAYER)
+				NumHookAttaches++;
+		}
+	}
+	EXPECT_EQ(NumAllocations(), AllocationsBefore);
+	EXPECT_GT(NumHookAttaches, 0);
+}
+
+TEST_F(Collision, TileInfo)
+{
+	int aNumFlags[7] = {};
+	for(const char *pMap : s_apMaps)
+	{
+		SCOPED_TRACE(pMap);
+		LoadMap(pMap);
+		for(int i = 0; i < m_Collision.GetWidth() * m_Collision.GetHeight(); i++)
+		{
+			const int Info = m_Collision.GetTileInfo(i);
+			const int Tile = m_Collision.GetTileIndex(i);
+			const int FTile = m_Collision.GetFTileIndex(i);
+			ASSERT_EQ((bool)(Info & TILEINFO_GAME), Tile != 0) << i;
+			ASSERT_EQ((bool)(Info & TILEINFO_FRONT), FTile != 0) << i;
+			ASSERT_EQ((bool)(Info & TILEINFO_TELE), m_Collision.TeleLayer() && m_Collision.TeleLayer()[i].m_Type) << i;
+			ASSERT_EQ((bool)(Info & TILEINFO_SPEEDUP), m_Collision.IsSpeedup(i) != 0) << i;
+			ASSERT_EQ((bool)(Info & TILEINFO_SWITCH), m_Collision.GetSwitchType(i) != 0) << i;
+			ASSERT_EQ((bool)(Info & TILEINFO_TUNE), m_Collision.TuneLayer() && m_Collision.TuneLayer()[i].m_Type) << i;
+			const bool Stopper = Tile == TILE_STOP || Tile == TILE_STOPS || Tile == TILE_STOPA || FTile == TILE_STOP || FTile == TILE_STOPS || FTile == TILE_STOPA;
+			ASSERT_EQ((bool)(Info & TILEINFO_STOPPER), Stopper) << i;
+			for(int Flag = 0; Flag < 7; Flag++)
+				aNumFlags[Flag] += (bool)(Info & (1 << Flag));
+		}
+	}
+	// the maps must cover all layers
+	for(int Flag = 0; Flag < 7; Flag++)
+		EXPECT_GT(aNumFlags[Flag], 0) << Flag;
+
+	// tiles changed while the map is running
+	const int Index = 3 * m_Collision.GetWidth() + 3;
+	const vec2 Pos = m_Collision.GetPos(Index);
+	m_Collision.SetCollisionAt(Pos.x, Pos.y, TILE_STOPA);
+	EXPECT_TRUE(m_Collision.GetTileInfo(Index) & TILEINFO_STOPPER);
+	m_Collision.SetCollisionAt(Pos.x, Pos.y, TILE_AIR);
+	EXPECT_FALSE(m_Collision.GetTileInfo(Index) & (TILEINFO_GAME | TILEINFO_STOPPER));
+}
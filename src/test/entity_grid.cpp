@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <game/prng.h>
+#include <game/server/entity_grid.h>
+
+#include <cmath>
+#include <iterator>
+#include <list>
+#include <vector>
+
+class CGridEntity
+{
+public:
+	int m_ObjType;
+	vec2 m_Pos;
+	float m_ProximityRadius;
+	int64_t m_ListOrder;
+	int m_GridCell = -1;
+	CGridEntity *m_pPrevCellEntity = nullptr;
+	CGridEntity *m_pNextCellEntity = nullptr;
+};
+
+// Keeps the entities like the type lists of the game world do, the newest
+// entity first, and checks the grid queries against walking these lists.
+class EntityGrid : public ::testing::Test
+{
+protected:
+	enum
+	{
+		NUM_TYPES = 3,
+		MAP_WIDTH = 40 * 32,
+		MAP_HEIGHT = 25 * 32,
+	};
+
+	CEntityGrid<CGridEntity> m_Grid;
+	std::list<CGridEntity> m_aEntities[NUM_TYPES];
+	int64_t m_NextListOrder = 0;
+	CPrng m_Prng;
+
+	void SetUp() override
+	{
+		m_Grid.Init(NUM_TYPES, MAP_WIDTH, MAP_HEIGHT);
+		uint64_t aSeed[2] = {0x4772696420, 0x66757a7a};
+		m_Prng.Seed(aSeed);
+	}
+
+	float RandomFloat(float Min, float Max)
+	{
+		return Min + (Max - Min) * (m_Prng.RandomBits() % 100001) / 100000.0f;
+	}
+
+	vec2 RandomPos()
+	{
+		// also outside of the map, where the border cells are used
+		return vec2(RandomFloat(-600.0f, MAP_WIDTH + 600.0f), RandomFloat(-600.0f, MAP_HEIGHT + 600.0f));
+	}
+
+	void Insert(int Type)
+	{
+		m_aEntities[Type].push_front(CGridEntity());
+		CGridEntity *pEnt = &m_aEntities[Type].front();
+		pEnt->m_ObjType = Type;
+		pEnt->m_Pos = RandomPos();
+		pEnt->m_ProximityRadius = RandomFloat(0.0f, 28.0f);
+		pEnt->m_ListOrder = ++m_NextListOrder;
+		m_Grid.Insert(pEnt);
+	}
+
+	CGridEntity *RandomEntity(int Type)
+	{
+		auto It = m_aEntities[Type].begin();
+		std::advance(It, m_Prng.RandomBits() % m_aEntities[Type].size());
+		return &*It;
+	}
+
+	static bool Hits(const CGridEntity *pEnt, vec2 Pos, float Radius)
+	{
+		return distance(pEnt->m_Pos, Pos) < Radius + pEnt->m_ProximityRadius;
+	}
+
+	// the same margin as the queries of the game world use
+	std::vector<CGridEntity *> Query(int Type, vec2 Pos, float Radius)
+	{
+		float MaxRadius = 0.0f;
+		for(const CGridEntity &Ent : m_aEntities[Type])
+			MaxRadius = maximum(MaxRadius, Ent.m_ProximityRadius);
+		const float Margin = Radius + MaxRadius;
+
+		CGridEntity *apCandidates[256];
+		const int NumCandidates = m_Grid.Collect(Type, Pos - vec2(Margin, Margin), Pos + vec2(Margin, Margin), apCandidates, std::size(apCandidates));
+		EXPECT_GE(NumCandidates, 0); // there are never more entities
+		std::vector<CGridEntity *> vpFound;
+		for(int i = 0; i < NumCandidates; i++)
+		{
+			if(Hits(apCandidates[i], Pos, Radius))
+				vpFound.push_back(apCandidates[i]);
+		}
+		return vpFound;
+	}
+
+	std::vector<CGridEntity *> ListWalk(int Type, vec2 Pos, float Radius)
+	{
+		std::vector<CGridEntity *> vpFound;
+		for(CGridEntity &Ent : m_aEntities[Type])
+		{
+			if(Hits(&Ent, Pos, Radius))
+				vpFound.push_back(&Ent);
+		}
+		return vpFound;
+	}
+};
+
+TEST_F(EntityGrid, MatchesListWalk)
+{
+	for(int Round = 0; Round < 20000; Round++)
+	{
+		const int Type = m_Prng.RandomBits() % NUM_TYPES;
+		const unsigned Action = m_Prng.RandomBits() % 10;
+		if(m_aEntities[Type].empty() || (Action < 3 && m_aEntities[Type].size() < 100))
+		{
+			Insert(Type);
+		}
+		else if(Action < 5)
+		{
+			CGridEntity *pEnt = RandomEntity(Type);
+			m_Grid.Remove(pEnt);
+			m_aEntities[Type].remove_if([pEnt](const CGridEntity &Ent) { return &Ent == pEnt; });
+		}
+		else
+		{
+			// small steps stay in the cell most of the time
+			CGridEntity *pEnt = RandomEntity(Type);
+			if(Action < 8)
+				pEnt->m_Pos += vec2(RandomFloat(-40.0f, 40.0f), RandomFloat(-40.0f, 40.0f));
+			else
+				pEnt->m_Pos = RandomPos();
+			m_Grid.Update(pEnt);
+		}
+
+		for(const std::list<CGridEntity> &Entities : m_aEntities)
+		{
+			for(const CGridEntity &Ent : Entities)
+				ASSERT_EQ(Ent.m_GridCell, m_Grid.Cell(Ent.m_ObjType, Ent.m_Pos));
+		}
+
+		const vec2 Pos = RandomPos();
+		const float Radius = RandomFloat(0.0f, 300.0f);
+		ASSERT_EQ(Query(Type, Pos, Radius), ListWalk(Type, Pos, Radius)) << "round=" << Round;
+	}
+}
+
+TEST_F(EntityGrid, ForEachVisitsOverlappingCells)
+{
+	for(int i = 0; i < 200; i++)
+		Insert(0);
+	Insert(1);
+
+	// the whole map and beyond
+	int Num = 0;
+	m_Grid.ForEach(0, vec2(-1e9f, -1e9f), vec2(1e9f, 1e9f), [&](CGridEntity *pEnt) {
+		EXPECT_EQ(pEnt->m_ObjType, 0);
+		Num++;
+	});
+	EXPECT_EQ(Num, 200);
+
+	// NaN boxes end up in the first cell instead of crashing
+	m_Grid.ForEach(0, vec2(NAN, NAN), vec2(NAN, NAN), [&](CGridEntity *pEnt) {
+		EXPECT_EQ(pEnt->m_GridCell, m_Grid.Cell(0, vec2(0.0f, 0.0f)));
+	});
+}
+
+TEST_F(EntityGrid, CollectTooMany)
+{
+	for(int i = 0; i < 10; i++)
+		Insert(2);
+	std::vector<CGridEntity *> vpCandidates(4);
+	EXPECT_EQ(m_Grid.Collect(2, vec2(-1e9f, -1e9f), vec2(1e9f, 1e9f), vpCandidates.data(), vpCandidates.size()), -1);
+	std::vector<CGridEntity *> vpAll(10);
+	ASSERT_EQ(m_Grid.Collect(2, vec2(-1e9f, -1e9f), vec2(1e9f, 1e9f), vpAll.data(), vpAll.size()), 10);
+	for(int i = 1; i < 10; i++)
+		EXPECT_GT(vpAll[i - 1]->m_ListOrder, vpAll[i]->m_ListOrder);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/client/laser_data.h>
+#include <game/client/pickup_data.h>
+#include <game/client/prediction/entities/character.h>
+#include <game/client/prediction/entities/dragger.h>
+#include <game/client/prediction/entities/laser.h>
+#include <game/client/prediction/entities/pickup.h>
+#include <game/client/prediction/entities/projectile.h>
+#include <game/client/prediction/entity_pool.h>
+#include <game/client/prediction/gameworld.h>
+#include <game/client/projectile_data.h>
+
+#include <vector>
+
+// A world like the one the client builds from the snapshot, without a map,
+// which none of the entities need to be created or copied.
+class EntityPool : public ::testing::Test
+{
+protected:
+	CTuningParams m_aTuningList[256]; // like CGameClient
+	CGameWorld m_World;
+
+	void SetUp() override
+	{
+		mem_zero(&m_World.m_WorldConfig, sizeof(m_World.m_WorldConfig));
+		m_World.m_pTuningList = m_aTuningList;
+		m_World.m_GameTick = 1000;
+	}
+
+	void Populate(int Num)
+	{
+		for(int i = 0; i < Num; i++)
+		{
+			const vec2 Pos(100.0f + i * 64.0f, 200.0f);
+
+			CNetObj_Character CharObj = {};
+			CharObj.m_X = Pos.x;
+			CharObj.m_Y = Pos.y;
+			CharObj.m_HookedPlayer = -1;
+			m_World.InsertEntity(new(&m_World) CCharacter(&m_World, i, &CharObj, nullptr));
+
+			CProjectileData ProjData = {};
+			ProjData.m_StartPos = Pos;
+			ProjData.m_StartVel = vec2(1.0f, 0.0f);
+			ProjData.m_Type = WEAPON_GRENADE;
+			ProjData.m_StartTick = m_World.GameTick();
+			m_World.InsertEntity(new(&m_World) CProjectile(&m_World, i, &ProjData));
+
+			CLaserData LaserData = {};
+			LaserData.m_From = Pos;
+			LaserData.m_To = Pos + vec2(100.0f, 0.0f);
+			LaserData.m_StartTick = m_World.GameTick();
+			LaserData.m_Type = LASERTYPE_RIFLE;
+			m_World.InsertEntity(new(&m_World) CLaser(&m_World, i, &LaserData));
+			LaserData.m_Type = LASERTYPE_DRAGGER;
+			LaserData.m_Owner = -1;
+			m_World.InsertEntity(new(&m_World) CDragger(&m_World, Num + i, &LaserData));
+
+			CPickupData PickupData = {};
+			PickupData.m_Pos = Pos;
+			PickupData.m_Type = POWERUP_WEAPON;
+			PickupData.m_Subtype = WEAPON_LASER;
+			m_World.InsertEntity(new(&m_World) CPickup(&m_World, i, &PickupData));
+		}
+		m_World.NetObjEnd();
+	}
+};
+
+TEST_F(EntityPool, CopyWorldReusesMemory)
+{
+	Populate(MAX_CLIENTS);
+	const int NumEntities = m_World.EntityPool()->NumUsed();
+	EXPECT_EQ(NumEntities, MAX_CLIENTS * 5);
+
+	CGameWorld Copy;
+	Copy.CopyWorld(&m_World);
+	EXPECT_EQ(Copy.EntityPool()->NumUsed(), NumEntities);
+	const int64_t NumChunkAllocations = Copy.EntityPool()->NumChunkAllocations();
+	EXPECT_GT(NumChunkAllocations, 0);
+
+	for(int i = 0; i < 10; i++)
+	{
+		Copy.CopyWorld(&m_World);
+		EXPECT_EQ(Copy.EntityPool()->NumUsed(), NumEntities);
+	}
+	EXPECT_EQ(Copy.EntityPool()->NumChunkAllocations(), NumChunkAllocations);
+	EXPECT_EQ(Copy.EntityPool()->NumAllocations(), 11 * NumEntities);
+
+	// the copies are usable entities of the new world
+	ASSERT_TRUE(Copy.GetCharacterById(MAX_CLIENTS - 1));
+	EXPECT_EQ(Copy.GetCharacterById(MAX_CLIENTS - 1)->GameWorld(), &Copy);
+	EXPECT_EQ(Copy.GetCharacterById(MAX_CLIENTS - 1)->m_Pos, m_World.GetCharacterById(MAX_CLIENTS - 1)->m_Pos);
+
+	Copy.Clear();
+	EXPECT_EQ(Copy.EntityPool()->NumUsed(), 0);
+	m_World.Clear();
+	EXPECT_EQ(m_World.EntityPool()->NumUsed(), 0);
+}
+
+TEST_F(EntityPool, SmallerWorldReusesMemory)
+{
+	Populate(MAX_CLIENTS);
+	CGameWorld Copy;
+	Copy.CopyWorld(&m_World);
+	const int64_t NumChunkAllocations = Copy.EntityPool()->NumChunkAllocations();
+
+	// fewer entities fit into the free lists of the bigger world
+	m_World.Clear();
+	Populate(MAX_CLIENTS / 2);
+	Copy.CopyWorld(&m_World);
+	EXPECT_EQ(Copy.EntityPool()->NumUsed(), MAX_CLIENTS / 2 * 5);
+	EXPECT_EQ(Copy.EntityPool()->NumChunkAllocations(), NumChunkAllocations);
+
+	Copy.Clear();
+	EXPECT_EQ(Copy.EntityPool()->NumUsed(), 0);
+}
+
+TEST_F(EntityPool, DestroyTickInCopyOfCopy)
+{
+	// like the client's prediction, which continues in a copy of the cached
+	// predicted world, itself a copy of the world from the snapshot
+	Populate(2);
+	CGameWorld Cached;
+	Cached.CopyWorld(&m_World);
+	Cached.m_GameTick = m_World.GameTick() + 3;
+	CGameWorld Predicted;
+	Predicted.CopyWorld(&Cached);
+	Predicted.m_GameTick = Cached.GameTick() + 2;
+
+	CEntity *pProj = Predicted.FindFirst(CGameWorld::ENTTYPE_PROJECTILE);
+	ASSERT_TRUE(pProj);
+	Predicted.RemoveEntity(pProj);
+	pProj->Destroy();
+
+	// the original entity is the one the smoke trails are rendered from
+	int NumDestroyed = 0;
+	for(CEntity *pEnt = m_World.FindFirst(CGameWorld::ENTTYPE_PROJECTILE); pEnt; pEnt = pEnt->TypeNext())
+	{
+		if(pEnt->m_DestroyTick >= 0)
+		{
+			EXPECT_EQ(pEnt->m_DestroyTick, Predicted.GameTick());
+			NumDestroyed++;
+		}
+	}
+	EXPECT_EQ(NumDestroyed, 1);
+
+	// nothing is passed on once the original world changed
+	m_World.OnModified();
+	pProj = Predicted.FindFirst(CGameWorld::ENTTYPE_PROJECTILE);
+	ASSERT_TRUE(pProj);
+	Predicted.RemoveEntity(pProj);
+	pProj->Destroy();
+	NumDestroyed = 0;
+	for(CEntity *pEnt = m_World.FindFirst(CGameWorld::ENTTYPE_PROJECTILE); pEnt; pEnt = pEnt->TypeNext())
+		NumDestroyed += pEnt->m_DestroyTick >= 0;
+	EXPECT_EQ(NumDestroyed, 1);
+}
+
+TEST(EntityPoolAllocate, ZeroedAndReused)
+{
+	CEntityPool Pool;
+	std::vector<void *> vpData;
+	for(int i = 0; i < 1000; i++)
+	{
+		const size_t Size = i % 2 ? 48 : 200;
+		unsigned char *pData = static_cast<unsigned char *>(Pool.Allocate(Size));
+		for(size_t j = 0; j < Size; j++)
+			ASSERT_EQ(pData[j], 0);
+		pData[0] = 0xff;
+		vpData.push_back(pData);
+	}
+	EXPECT_EQ(Pool.NumUsed(), 1000);
+	const int64_t NumChunkAllocations = Pool.NumChunkAllocations();
+
+	for(void *pData : vpData)
+		CEntityPool::Free(pData);
+	EXPECT_EQ(Pool.NumUsed(), 0);
+
+	for(int i = 0; i < 1000; i++)
+	{
+		const size_t Size = i % 2 ? 48 : 200;
+		unsigned char *pData = static_cast<unsigned char *>(Pool.Allocate(Size));
+		EXPECT_EQ(pData[0], 0);
+		vpData[i] = pData;
+	}
+	EXPECT_EQ(Pool.NumChunkAllocations(), NumChunkAllocations);
+	for(void *pData : vpData)
+		CEntityPool::Free(pData);
+	EXPECT_EQ(Pool.NumUsed(), 0);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <base/math.h>
+#include <game/prng.h>
+#include <game/server/event_index.h>
+
+#include <vector>
+
+// Checks the index against the linear filter the event handler uses
+// without it, the client mask and the clip test of NetworkClipped.
+class EventIndex : public ::testing::Test
+{
+protected:
+	enum
+	{
+		MAP_WIDTH = 300 * 32,
+		MAP_HEIGHT = 200 * 32,
+		NUM_TEAMS = 4,
+	};
+
+	CEventIndex m_Index;
+	int m_NumEvents = 0;
+	vec2 m_aPositions[CEventIndex::MAX_EVENTS];
+	CClientMask m_aMasks[CEventIndex::MAX_EVENTS];
+	CClientMask m_aTeamMasks[NUM_TEAMS];
+	CPrng m_Prng;
+
+	void SetUp() override
+	{
+		uint64_t aSeed[2] = {0x4576656e74, 0x696e646578};
+		m_Prng.Seed(aSeed);
+	}
+
+	int RandomInt(int Min, int Max)
+	{
+		return Min + (int)(m_Prng.RandomBits() % (unsigned)(Max - Min + 1));
+	}
+
+	// events are networked with integer positions
+	vec2 RandomPos()
+	{
+		if(m_Prng.RandomBits() % 8 == 0)
+		{
+			// on a cell border
+			return vec2(RandomInt(-2, MAP_WIDTH / CEventIndex::CELL_SIZE + 2) * CEventIndex::CELL_SIZE, RandomInt(-2, MAP_HEIGHT / CEventIndex::CELL_SIZE + 2) * CEventIndex::CELL_SIZE);
+		}
+		// also outside of the map, where the border cells are used
+		return vec2(RandomInt(-1000, MAP_WIDTH + 1000), RandomInt(-1000, MAP_HEIGHT + 1000));
+	}
+
+	void RandomTeams()
+	{
+		for(CClientMask &Mask : m_aTeamMasks)
+			Mask.reset();
+		for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+			m_aTeamMasks[m_Prng.RandomBits() % NUM_TEAMS].set(ClientId);
+	}
+
+	CClientMask RandomMask()
+	{
+		switch(m_Prng.RandomBits() % 4)
+		{
+		case 0:
+			return CClientMask().set();
+		case 1:
+		{
+			CClientMask Mask;
+			for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+			{
+				if(m_Prng.RandomBits() % 2)
+					Mask.set(ClientId);
+			}
+			return Mask;
+		}
+		default:
+			return m_aTeamMasks[m_Prng.RandomBits() % NUM_TEAMS];
+		}
+	}
+
+	void RandomEvents()
+	{
+		RandomTeams();
+		m_NumEvents = RandomInt(0, CEventIndex::MAX_EVENTS);
+		for(int i = 0; i < m_NumEvents; i++)
+		{
+			m_aPositions[i] = RandomPos();
+			m_aMasks[i] = RandomMask();
+		}
+		m_Index.Build(MAP_WIDTH, MAP_HEIGHT, m_NumEvents, m_aPositions, m_aMasks);
+	}
+
+	std::vector<int> Collect(int ClientId, vec2 ViewPos, vec2 ShowDistance)
+	{
+		int aEvents[CEventIndex::MAX_EVENTS];
+		int64_t NumTested = 0;
+		const int NumEvents = m_Index.Collect(ClientId, ViewPos, ShowDistance, aEvents, &NumTested);
+		EXPECT_LE(NumTested, m_NumEvents);
+		return std::vector<int>(aEvents, aEvents + NumEvents);
+	}
+
+	std::vector<int> LinearFilter(int ClientId, vec2 ViewPos, vec2 ShowDistance)
+	{
+		std::vector<int> vEvents;
+		for(int i = 0; i < m_NumEvents; i++)
+		{
+			const float dx = ViewPos.x - m_aPositions[i].x;
+			const float dy = ViewPos.y - m_aPositions[i].y;
+			if(m_aMasks[i].test(ClientId) && absolute(dx) <= ShowDistance.x && absolute(dy) <= ShowDistance.y)
+				vEvents.push_back(i);
+		}
+		return vEvents;
+	}
+};
+
+TEST_F(EventIndex, MatchesLinearFilter)
+{
+	for(int Snapshot = 0; Snapshot < 500; Snapshot++)
+	{
+		RandomEvents();
+		for(int Client = 0; Client < 32; Client++)
+		{
+			const int ClientId = RandomInt(0, MAX_CLIENTS - 1);
+			vec2 ViewPos = m_Prng.RandomBits() % 4 == 0 ? m_aPositions[RandomInt(0, maximum(0, m_NumEvents - 1))] : RandomPos();
+			if(m_Prng.RandomBits() % 8 == 0)
+				ViewPos += vec2(0.5f, 0.25f); // spectators can look anywhere
+			const vec2 ShowDistance = m_Prng.RandomBits() % 4 == 0 ? vec2(RandomInt(0, 3000), RandomInt(0, 3000)) : vec2(1000, 800);
+			ASSERT_EQ(Collect(ClientId, ViewPos, ShowDistance), LinearFilter(ClientId, ViewPos, ShowDistance)) << "snapshot=" << Snapshot << " client=" << ClientId;
+		}
+	}
+}
+
+TEST_F(EventIndex, SkipsFarCells)
+{
+	m_NumEvents = 2;
+	m_aPositions[0] = vec2(100, 100);
+	m_aPositions[1] = vec2(MAP_WIDTH - 100, MAP_HEIGHT - 100);
+	m_aMasks[0].set();
+	m_aMasks[1].set();
+	m_Index.Build(MAP_WIDTH, MAP_HEIGHT, m_NumEvents, m_aPositions, m_aMasks);
+
+	int aEvents[CEventIndex::MAX_EVENTS];
+	int64_t NumTested = 0;
+	ASSERT_EQ(m_Index.Collect(0, vec2(0, 0), vec2(1000, 800), aEvents, &NumTested), 1);
+	EXPECT_EQ(aEvents[0], 0);
+	EXPECT_EQ(NumTested, 1);
+}
+
+TEST_F(EventIndex, Empty)
+{
+	m_Index.Build(0, 0, 0, m_aPositions, m_aMasks);
+	EXPECT_TRUE(Collect(0, vec2(0, 0), vec2(1000, 800)).empty());
+}
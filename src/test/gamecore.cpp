@@ -0,0 +1,287 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/kernel.h>
+#include <engine/map.h>
+#include <engine/shared/datafile.h>
+#include <engine/storage.h>
+#include <game/collision.h>
+#include <game/gamecore.h>
+#include <game/layers.h>
+#include <game/mapitems.h>
+#include <game/prng.h>
+#include <game/teamscore.h>
+
+#include <memory>
+
+static const int MAP_WIDTH = 100;
+static const int MAP_HEIGHT = 60;
+
+class GameCore : public ::testing::Test
+{
+protected:
+	CTestInfo m_Info;
+	IKernel *m_pKernel = nullptr;
+	CLayers m_Layers;
+	CCollision m_Collision;
+
+	// solid border, a few floating platforms and some unhookable tiles
+	static unsigned char MapTile(int x, int y)
+	{
+		if(x == 0 || y == 0 || x == MAP_WIDTH - 1 || y == MAP_HEIGHT - 1)
+			return TILE_SOLID;
+		if(y % 12 == 0 && x % 20 >= 4 && x % 20 < 14)
+			return x % 20 < 8 ? TILE_NOHOOK : TILE_SOLID;
+		return TILE_AIR;
+	}
+
+	void WriteMap(IStorage *pStorage, const char *pFilename)
+	{
+		CDataFileWriter Writer;
+		ASSERT_TRUE(Writer.Open(pStorage, pFilename));
+
+		CMapItemVersion Version;
+		Version.m_Version = CMapItemVersion::CURRENT_VERSION;
+		Writer.AddItem(MAPITEMTYPE_VERSION, 0, sizeof(Version), &Version);
+
+		CMapItemGroup_v1 Group;
+		Group.m_Version = 1;
+		Group.m_OffsetX = 0;
+		Group.m_OffsetY = 0;
+		Group.m_ParallaxX = 100;
+		Group.m_ParallaxY = 100;
+		Group.m_StartLayer = 0;
+		Group.m_NumLayers = 1;
+		Writer.AddItem(MAPITEMTYPE_GROUP, 0, sizeof(Group), &Group);
+
+		std::vector<CTile> vTiles(MAP_WIDTH * MAP_HEIGHT);
+		for(int y = 0; y < MAP_HEIGHT; y++)
+		{
+			for(int x = 0; x < MAP_WIDTH; x++)
+			{
+				CTile &Tile = vTiles[y * MAP_WIDTH + x];
+				Tile.m_Index = MapTile(x, y);
+				Tile.m_Flags = 0;
+				Tile.m_Skip = 0;
+				Tile.m_Reserved = 0;
+			}
+		}
+		const int TilesData = Writer.AddData(vTiles.size() * sizeof(CTile), vTiles.data());
+
+		CMapItemLayerTilemap GameLayer;
+		GameLayer.m_Layer.m_Version = 0;
+		GameLayer.m_Layer.m_Type = LAYERTYPE_TILES;
+		GameLayer.m_Layer.m_Flags = 0;
+		GameLayer.m_Version = 2;
+		GameLayer.m_Width = MAP_WIDTH;
+		GameLayer.m_Height = MAP_HEIGHT;
+		GameLayer.m_Flags = TILESLAYERFLAG_GAME;
+		GameLayer.m_Color.r = 0;
+		GameLayer.m_Color.g = 0;
+		GameLayer.m_Color.b = 0;
+		GameLayer.m_Color.a = 0;
+		GameLayer.m_ColorEnv = -1;
+		GameLayer.m_ColorEnvOffset = 0;
+		GameLayer.m_Image = -1;
+		GameLayer.m_Data = TilesData;
+		Writer.AddItem(MAPITEMTYPE_LAYER, 0, sizeof(GameLayer) - sizeof(GameLayer.m_aName) - sizeof(GameLayer.m_Tele) - sizeof(GameLayer.m_Speedup) - sizeof(GameLayer.m_Front) - sizeof(GameLayer.m_Switch) - sizeof(GameLayer.m_Tune), &GameLayer);
+
+		Writer.Finish();
+	}
+
+	void SetUp() override
+	{
+		m_Info.m_DeleteTestStorageFilesOnSuccess = true;
+		IStorage *pStorage = m_Info.CreateTestStorage();
+		ASSERT_TRUE(pStorage);
+		WriteMap(pStorage, "gamecore.map");
+
+		m_pKernel = IKernel::Create();
+		m_pKernel->RegisterInterface(pStorage);
+		IEngineMap *pMap = CreateEngineMap();
+		m_pKernel->RegisterInterface(pMap);
+		m_pKernel->RegisterInterface(static_cast<IMap *>(pMap), false);
+		ASSERT_TRUE(pMap->Load("gamecore.map"));
+
+		m_Layers.Init(m_pKernel);
+		m_Collision.Init(&m_Layers);
+	}
+
+	void TearDown() override
+	{
+		m_Collision.Unload();
+		m_Layers.Unload();
+		delete m_pKernel;
+	}
+};
+
+// Simulates a crowd of characters the way the game worlds tick them
+class CTestWorld
+{
+public:
+	enum
+	{
+		NUM_CHARACTERS = MAX_CLIENTS,
+	};
+
+	CWorldCore m_World;
+	CTeamsCore m_Teams;
+	// zeroed like the game's characters, `Reset` doesn't cover everything
+	// (e.g. the move restrictions)
+	CCharacterCore m_aCores[NUM_CHARACTERS] = {};
+	bool m_aPresent[NUM_CHARACTERS];
+
+	CTestWorld(CCollision *pCollision, bool UseBroadphase)
+	{
+		m_World.m_UseBroadphase = UseBroadphase;
+		for(int i = 0; i < NUM_CHARACTERS; i++)
+		{
+			m_aCores[i].Init(&m_World, pCollision, &m_Teams);
+			m_aCores[i].Reset();
+			m_aCores[i].m_Id = i;
+			m_aCores[i].m_Pos = vec2(64.0f + (i % 32) * 96.0f, 64.0f + (i / 32) * 320.0f);
+			m_World.m_apCharacters[i] = &m_aCores[i];
+			m_aPresent[i] = true;
+			// a few characters in other teams, they don't interact with the rest
+			m_Teams.Team(i, i % 8 == 7 ? 1 : 0);
+		}
+	}
+
+	void SetPresent(int ClientId, bool Present)
+	{
+		m_aPresent[ClientId] = Present;
+		m_World.m_apCharacters[ClientId] = Present ? &m_aCores[ClientId] : nullptr;
+	}
+
+	// what a game world does with the characters in a tick, `pTeleports`
+	// contains the positions characters move to at the end of their tick
+	void Tick(const CNetObj_PlayerInput *pInputs, const vec2 *pTeleports, bool NoWeakHook)
+	{
+		if(m_World.m_UseBroadphase)
+			m_World.UpdateBroadphase();
+
+		if(NoWeakHook)
+		{
+			for(int i = 0; i < NUM_CHARACTERS; i++)
+			{
+				if(!m_aPresent[i])
+					continue;
+				m_aCores[i].m_Input = pInputs[i];
+				m_aCores[i].Tick(true, false);
+			}
+		}
+		for(int i = 0; i < NUM_CHARACTERS; i++)
+		{
+			if(!m_aPresent[i])
+				continue;
+			if(NoWeakHook)
+			{
+				m_aCores[i].TickDeferred();
+			}
+			else
+			{
+				m_aCores[i].m_Input = pInputs[i];
+				m_aCores[i].Tick(true);
+			}
+			if(pTeleports[i] != vec2(0.0f, 0.0f))
+				m_aCores[i].m_Pos = pTeleports[i];
+			if(m_World.m_UseBroadphase)
+				m_World.UpdateBroadphase(i);
+		}
+		for(int i = 0; i < NUM_CHARACTERS; i++)
+		{
+			if(!m_aPresent[i])
+				continue;
+			m_aCores[i].Move();
+			m_aCores[i].Quantize();
+		}
+	}
+};
+
+static void RunDeterminism(CCollision *pCollision, bool NoWeakHook)
+{
+	// the broadphase must not change anything, compare against the plain
+	// iteration over all characters tick by tick
+	std::unique_ptr<CTestWorld> pReference = std::make_unique<CTestWorld>(pCollision, false);
+	std::unique_ptr<CTestWorld> pBroadphase = std::make_unique<CTestWorld>(pCollision, true);
+
+	CPrng Prng;
+	uint64_t aSeed[2] = {0x5eed, NoWeakHook};
+	Prng.Seed(aSeed);
+
+	CNetObj_PlayerInput aInputs[CTestWorld::NUM_CHARACTERS] = {};
+	int NumHookAttaches = 0;
+	int NumTeleports = 0;
+	for(int Tick = 0; Tick < 2000; Tick++)
+	{
+		vec2 aTeleports[CTestWorld::NUM_CHARACTERS];
+		for(int i = 0; i < CTestWorld::NUM_CHARACTERS; i++)
+		{
+			CNetObj_PlayerInput &Input = aInputs[i];
+			Input.m_Jump = 0;
+			if(Prng.RandomBits() % 25 == 0)
+				Input.m_Direction = (int)(Prng.RandomBits() % 3) - 1;
+			if(Prng.RandomBits() % 40 == 0)
+				Input.m_Jump = 1;
+			if(Prng.RandomBits() % 15 == 0)
+			{
+				// mostly aim at other characters to get hooks between them
+				Input.m_Hook = !Input.m_Hook;
+				const int Target = Prng.RandomBits() % CTestWorld::NUM_CHARACTERS;
+				const vec2 Dir = pReference->m_aCores[Target].m_Pos - pReference->m_aCores[i].m_Pos;
+				Input.m_TargetX = Dir.x != 0.0f || Dir.y != 0.0f ? (int)Dir.x : 1;
+				Input.m_TargetY = (int)Dir.y;
+			}
+
+			aTeleports[i] = vec2(0.0f, 0.0f);
+			if(Prng.RandomBits() % 500 == 0)
+			{
+				aTeleports[i] = vec2(32.0f + Prng.RandomBits() % ((MAP_WIDTH - 2) * 32), 32.0f + Prng.RandomBits() % ((MAP_HEIGHT - 2) * 32));
+				NumTeleports++;
+			}
+		}
+
+		// characters leaving and joining between ticks
+		if(Prng.RandomBits() % 20 == 0)
+		{
+			const int ClientId = Prng.RandomBits() % CTestWorld::NUM_CHARACTERS;
+			const bool Present = !pReference->m_aPresent[ClientId];
+			pReference->SetPresent(ClientId, Present);
+			pBroadphase->SetPresent(ClientId, Present);
+		}
+
+		pReference->Tick(aInputs, aTeleports, NoWeakHook);
+		pBroadphase->Tick(aInputs, aTeleports, NoWeakHook);
+
+		for(int i = 0; i < CTestWorld::NUM_CHARACTERS; i++)
+		{
+			const CCharacterCore &Expected = pReference->m_aCores[i];
+			const CCharacterCore &Actual = pBroadphase->m_aCores[i];
+			// `Write` doesn't fill the tick
+			CNetObj_CharacterCore ExpectedObj = {};
+			CNetObj_CharacterCore ActualObj = {};
+			Expected.Write(&ExpectedObj);
+			Actual.Write(&ActualObj);
+			ASSERT_EQ(mem_comp(&ExpectedObj, &ActualObj, sizeof(ExpectedObj)), 0) << "tick " << Tick << " client " << i;
+			ASSERT_EQ(Expected.m_Vel, Actual.m_Vel) << "tick " << Tick << " client " << i;
+			ASSERT_EQ(Expected.m_TriggeredEvents, Actual.m_TriggeredEvents) << "tick " << Tick << " client " << i;
+			if(Expected.m_TriggeredEvents & COREEVENT_HOOK_ATTACH_PLAYER)
+				NumHookAttaches++;
+		}
+	}
+
+	// make sure the interesting cases actually happened
+	EXPECT_GT(NumHookAttaches, 50);
+	EXPECT_GT(NumTeleports, 50);
+}
+
+TEST_F(GameCore, BroadphaseDeterminism)
+{
+	RunDeterminism(&m_Collision, false);
+}
+
+TEST_F(GameCore, BroadphaseDeterminismNoWeakHook)
+{
+	RunDeterminism(&m_Collision, true);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <base/system.h>
+#include <engine/shared/network_recv_thread.h>
 
 TEST(Net, Ipv4AndIpv6Work)
 {
@@ -48,3 +49,122 @@ TEST(Net, Ipv4AndIpv6Work)
 	net_udp_close(Socket1);
 	net_udp_close(Socket2);
 }
+
+TEST(Net, SendBatching)
+{
+	NETADDR Bindaddr = {};
+	NETSOCKET Socket1;
+	NETSOCKET Socket2;
+
+	Bindaddr.type = NETTYPE_IPV4;
+	Socket2 = net_udp_create(Bindaddr);
+	ASSERT_TRUE(Socket2);
+	do
+	{
+		Bindaddr.port = secure_rand() % 64511 + 1024;
+	} while(!(Socket1 = net_udp_create(Bindaddr)));
+
+	NETADDR Target;
+	ASSERT_FALSE(net_addr_from_str(&Target, "127.0.0.1"));
+	Target.port = Bindaddr.port;
+
+	const bool Batching = net_udp_set_send_batching(Socket2, true);
+#if defined(CONF_PLATFORM_LINUX)
+	EXPECT_TRUE(Batching);
+#endif
+
+	const char *apPackets[] = {"abc", "def", "ghi"};
+	for(const char *pPacket : apPackets)
+		EXPECT_EQ(net_udp_send(Socket2, &Target, pPacket, 3), 3);
+
+	if(Batching)
+	{
+		EXPECT_EQ(net_socket_read_wait(Socket1, 0), 0);
+		EXPECT_EQ(net_udp_flush(Socket2), 3);
+	}
+	EXPECT_EQ(net_udp_flush(Socket2), 0);
+
+	// received packets are buffered, only wait for the first one
+	EXPECT_EQ(net_socket_read_wait(Socket1, 10000000), 1);
+	for(const char *pPacket : apPackets)
+	{
+		NETADDR Addr;
+		unsigned char *pData;
+		ASSERT_EQ(net_udp_recv(Socket1, &Addr, &pData), 3);
+		EXPECT_EQ(mem_comp(pData, pPacket, 3), 0);
+	}
+
+	// packets that aren't batched send the queued ones first
+	NETADDR Ipv6Target;
+	ASSERT_FALSE(net_addr_from_str(&Ipv6Target, "[::1]:8303"));
+	EXPECT_EQ(net_udp_send(Socket2, &Target, "jkl", 3), 3);
+	net_udp_send(Socket2, &Ipv6Target, "mno", 3);
+	EXPECT_EQ(net_udp_flush(Socket2), 0);
+	NETADDR Addr;
+	unsigned char *pData;
+	EXPECT_EQ(net_socket_read_wait(Socket1, 10000000), 1);
+	ASSERT_EQ(net_udp_recv(Socket1, &Addr, &pData), 3);
+	EXPECT_EQ(mem_comp(pData, "jkl", 3), 0);
+
+	net_udp_close(Socket1);
+	net_udp_close(Socket2);
+}
+
+TEST(Net, RecvThread)
+{
+	NETADDR Bindaddr = {};
+	NETSOCKET Socket1;
+	NETSOCKET Socket2;
+
+	Bindaddr.type = NETTYPE_IPV4;
+	Socket2 = net_udp_create(Bindaddr);
+	ASSERT_TRUE(Socket2);
+	do
+	{
+		Bindaddr.port = secure_rand() % 64511 + 1024;
+	} while(!(Socket1 = net_udp_create(Bindaddr)));
+
+	NETADDR Target;
+	ASSERT_FALSE(net_addr_from_str(&Target, "127.0.0.1"));
+	Target.port = Bindaddr.port;
+
+	CNetRecvThread RecvThread(Socket1);
+	EXPECT_FALSE(RecvThread.Wait(std::chrono::milliseconds(1)));
+	const int64_t SendTime = time_get();
+	const char *apPackets[] = {"abc", "def", "ghi"};
+	for(const char *pPacket : apPackets)
+		EXPECT_EQ(net_udp_send(Socket2, &Target, pPacket, 3), 3);
+	// wakes up for the first datagram instead of running into the timeout
+	EXPECT_TRUE(RecvThread.Wait(std::chrono::seconds(10)));
+	EXPECT_LT(time_get() - SendTime, time_freq() * 5);
+
+	int64_t LastRecvTime = SendTime;
+	for(const char *pPacket : apPackets)
+	{
+		NETADDR Addr;
+		unsigned char *pData;
+		int64_t RecvTime;
+		int Bytes;
+		const int64_t Timeout = time_get() + time_freq() * 10;
+		while(!(Bytes = RecvThread.Recv(&Addr, &pData, &RecvTime)) && time_get() < Timeout)
+			thread_yield();
+		ASSERT_EQ(Bytes, 3);
+		EXPECT_EQ(mem_comp(pData, pPacket, 3), 0);
+		EXPECT_GE(RecvTime, LastRecvTime);
+		LastRecvTime = RecvTime;
+	}
+
+	// after stopping, the datagrams stay in the socket
+	RecvThread.Stop();
+	EXPECT_EQ(net_udp_send(Socket2, &Target, "jkl", 3), 3);
+	NETADDR Addr;
+	unsigned char *pData;
+	int64_t RecvTime;
+	EXPECT_EQ(RecvThread.Recv(&Addr, &pData, &RecvTime), 0);
+	EXPECT_EQ(net_socket_read_wait(Socket1, 10000000), 1);
+	ASSERT_EQ(net_udp_recv(Socket1, &Addr, &pData), 3);
+	EXPECT_EQ(mem_comp(pData, "jkl", 3), 0);
+
+	net_udp_close(Socket1);
+	net_udp_close(Socket2);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/config.h>
+#include <engine/shared/network.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Connects real clients over localhost. The server finds the slot of every
+// received packet through its address index, which is checked here by the
+// client ids of the received chunks.
+class NetServer : public ::testing::Test
+{
+protected:
+	CNetServer m_Server;
+	NETADDR m_ServerAddr;
+	std::vector<int> m_vNewClients;
+	std::vector<int> m_vDelClients;
+	int m_OldConnTimeout;
+
+	static int NewClient(int ClientId, void *pUser, bool Sixup)
+	{
+		static_cast<NetServer *>(pUser)->m_vNewClients.push_back(ClientId);
+		return 0;
+	}
+
+	static int DelClient(int ClientId, const char *pReason, void *pUser)
+	{
+		static_cast<NetServer *>(pUser)->m_vDelClients.push_back(ClientId);
+		return 0;
+	}
+
+	void SetUp() override
+	{
+		// the config isn't loaded with its defaults in the tests
+		m_OldConnTimeout = g_Config.m_ConnTimeout;
+		g_Config.m_ConnTimeout = 100;
+		CNetBase::Init();
+		NETADDR BindAddr;
+		ASSERT_FALSE(net_addr_from_str(&BindAddr, "127.0.0.1"));
+		do
+		{
+			BindAddr.port = secure_rand() % 64511 + 1024;
+		} while(!m_Server.Open(BindAddr, nullptr, 4, 4));
+		m_Server.SetCallbacks(NewClient, DelClient, this);
+		m_ServerAddr = BindAddr;
+	}
+
+	void TearDown() override
+	{
+		m_Server.Close();
+		g_Config.m_ConnTimeout = m_OldConnTimeout;
+	}
+
+	// returns the port the client sends from
+	static int OpenClient(CNetClient *pClient)
+	{
+		NETADDR BindAddr = {};
+		BindAddr.type = NETTYPE_IPV4;
+		do
+		{
+			BindAddr.port = secure_rand() % 64511 + 1024;
+		} while(!pClient->Open(BindAddr));
+		return BindAddr.port;
+	}
+
+	// pumps the server and the clients, returns the client ids of the
+	// received chunks with the given payload
+	std::vector<int> Pump(std::vector<CNetClient *> vpClients, int Milliseconds, const char *pPayload = nullptr)
+	{
+		std::vector<int> vIds;
+		const int64_t End = time_get() + time_freq() * Milliseconds / 1000;
+		while(time_get() < End)
+		{
+			m_Server.Update();
+			CNetChunk Chunk;
+			SECURITY_TOKEN ResponseToken;
+			while(m_Server.Recv(&Chunk, &ResponseToken))
+			{
+				if(pPayload && Chunk.m_ClientId >= 0 && Chunk.m_DataSize == str_length(pPayload) && mem_comp(Chunk.m_pData, pPayload, Chunk.m_DataSize) == 0)
+					vIds.push_back(Chunk.m_ClientId);
+			}
+			for(CNetClient *pClient : vpClients)
+			{
+				pClient->Update();
+				while(pClient->Recv(&Chunk, &ResponseToken, false))
+				{
+				}
+			}
+			std::this_thread::sleep_for(1ms);
+		}
+		return vIds;
+	}
+
+	bool Connect(CNetClient *pClient)
+	{
+		pClient->Connect(&m_ServerAddr, 1);
+		const int64_t End = time_get() + time_freq() * 5;
+		while(pClient->State() != NETSTATE_ONLINE && time_get() < End)
+			Pump({pClient}, 5);
+		return pClient->State() == NETSTATE_ONLINE;
+	}
+
+	static void SendPayload(CNetClient *pClient, const char *pPayload)
+	{
+		CNetChunk Chunk = {};
+		Chunk.m_ClientId = 0;
+		Chunk.m_Flags = NETSENDFLAG_VITAL | NETSENDFLAG_FLUSH;
+		Chunk.m_pData = pPayload;
+		Chunk.m_DataSize = str_length(pPayload);
+		pClient->Send(&Chunk);
+	}
+
+	int SlotOf(int Port)
+	{
+		for(int i = 0; i < m_Server.MaxClients(); i++)
+		{
+			if(m_vDelClients.end() == std::find(m_vDelClients.begin(), m_vDelClients.end(), i) && m_Server.ClientAddr(i)->port == Port)
+				return i;
+		}
+		return -1;
+	}
+};
+
+TEST_F(NetServer, AddressIndex)
+{
+	CNetClient Client1;
+	CNetClient Client2;
+	const int Port1 = OpenClient(&Client1);
+	const int Port2 = OpenClient(&Client2);
+	ASSERT_NE(Port1, Port2);
+
+	// two clients on the same ip with different ports
+	ASSERT_TRUE(Connect(&Client1));
+	ASSERT_TRUE(Connect(&Client2));
+	ASSERT_EQ(m_vNewClients.size(), 2u);
+	const int Slot1 = m_vNewClients[0];
+	const int Slot2 = m_vNewClients[1];
+	EXPECT_NE(Slot1, Slot2);
+	EXPECT_EQ(SlotOf(Port1), Slot1);
+	EXPECT_EQ(SlotOf(Port2), Slot2);
+
+	SendPayload(&Client1, "one");
+	SendPayload(&Client2, "two");
+	EXPECT_EQ(Pump({&Client1, &Client2}, 50, "one"), std::vector<int>{Slot1});
+	SendPayload(&Client2, "two");
+	EXPECT_EQ(Pump({&Client1, &Client2}, 50, "two"), std::vector<int>{Slot2});
+
+	// packets of a dropped client aren't assigned to its old slot anymore
+	m_Server.Drop(Slot1, "test");
+	EXPECT_EQ(m_vDelClients, std::vector<int>{Slot1});
+	SendPayload(&Client1, "one");
+	EXPECT_TRUE(Pump({&Client1, &Client2}, 50, "one").empty());
+	SendPayload(&Client2, "two");
+	EXPECT_EQ(Pump({&Client1, &Client2}, 50, "two"), std::vector<int>{Slot2});
+
+	// reconnecting from the same address gets a slot again
+	Client1.Disconnect("reconnect");
+	Pump({&Client1, &Client2}, 20);
+	ASSERT_TRUE(Connect(&Client1));
+	ASSERT_EQ(m_vNewClients.size(), 3u);
+	const int NewSlot1 = m_vNewClients[2];
+	EXPECT_NE(NewSlot1, Slot2);
+	m_vDelClients.clear();
+	EXPECT_EQ(SlotOf(Port1), NewSlot1);
+	SendPayload(&Client1, "one");
+	EXPECT_EQ(Pump({&Client1, &Client2}, 50, "one"), std::vector<int>{NewSlot1});
+	SendPayload(&Client2, "two");
+	EXPECT_EQ(Pump({&Client1, &Client2}, 50, "two"), std::vector<int>{Slot2});
+
+	Client1.Close();
+	Client2.Close();
+}
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
 #include <base/system.h>
+#include <engine/shared/compression.h>
 #include <engine/shared/snapshot.h>
 #include <game/generated/protocol.h>
+#include <game/prng.h>
+
+#include <climits>
+#include <iterator>
 
 TEST(Snapshot, CrcOneInt)
 {
@@ -83,3 +88,318 @@ TEST(Snapshot, CrcOverflow)
 
 	ASSERT_EQ(pSnapshot->Crc(), 1);
 }
+
+static int BuildProjectileSnapshot(CSnapshot *pSnapshot, int NumItems, int IdOffset, int Value)
+{
+	CSnapshotBuilder Builder;
+	Builder.Init();
+	for(int i = 0; i < NumItems; i++)
+	{
+		CNetObj_Projectile *pProj = static_cast<CNetObj_Projectile *>(Builder.NewItem(CNetObj_Projectile::ms_MsgId, i + IdOffset, sizeof(CNetObj_Projectile)));
+		EXPECT_TRUE(pProj != nullptr);
+		if(!pProj)
+			break;
+		pProj->m_X = i * 32;
+		pProj->m_Y = Value;
+		pProj->m_VelX = i % 3;
+		pProj->m_VelY = -i;
+		pProj->m_Type = i % 4;
+		pProj->m_StartTick = Value;
+	}
+	return Builder.Finish(pSnapshot);
+}
+
+TEST(Snapshot, ItemIndexMatchesLinearSearch)
+{
+	char aData[CSnapshot::MAX_SIZE];
+	CSnapshot *pSnapshot = (CSnapshot *)aData;
+	for(int NumItems : {0, 1, 7, 100, (int)CSnapshot::MAX_ITEMS})
+	{
+		BuildProjectileSnapshot(pSnapshot, NumItems, 5, 1);
+		CSnapshotItemIndex Index;
+		Index.Build(pSnapshot);
+		for(int Id = 0; Id < NumItems + 10; Id++)
+		{
+			const int Key = (CNetObj_Projectile::ms_MsgId << 16) | Id;
+			EXPECT_EQ(Index.Find(Key), pSnapshot->GetItemIndex(Key));
+			EXPECT_EQ(pSnapshot->FindItem(CNetObj_Projectile::ms_MsgId, Id, &Index), pSnapshot->FindItem(CNetObj_Projectile::ms_MsgId, Id));
+		}
+		EXPECT_EQ(Index.Find(-1), -1);
+	}
+}
+
+TEST(Snapshot, ItemIndexDuplicateKeys)
+{
+	CSnapshotItemIndex Index;
+	Index.Clear(4);
+	Index.Add(7, 0);
+	Index.Add(7, 1);
+	Index.Add(8, 2);
+	EXPECT_EQ(Index.Find(7), 0);
+	EXPECT_EQ(Index.Find(8), 2);
+	EXPECT_EQ(Index.Find(9), -1);
+}
+
+TEST(Snapshot, DeltaRoundtrip)
+{
+	char aFrom[CSnapshot::MAX_SIZE];
+	char aTo[CSnapshot::MAX_SIZE];
+	char aDelta[CSnapshot::MAX_SIZE];
+	char aUnpacked[CSnapshot::MAX_SIZE];
+	CSnapshot *pFrom = (CSnapshot *)aFrom;
+	CSnapshot *pTo = (CSnapshot *)aTo;
+
+	// ids 0-9 get deleted, 10-299 updated, 300-309 added
+	BuildProjectileSnapshot(pFrom, 300, 0, 1);
+	const int ToSize = BuildProjectileSnapshot(pTo, 300, 10, 2);
+
+	CSnapshotDelta Delta;
+	const int DeltaSize = Delta.CreateDelta(pFrom, pTo, aDelta);
+	ASSERT_GT(DeltaSize, 0);
+	EXPECT_EQ(((CSnapshotDelta::CData *)aDelta)->m_NumDeletedItems, 10);
+
+	const int UnpackedSize = Delta.UnpackDelta(pFrom, (CSnapshot *)aUnpacked, aDelta, DeltaSize, false);
+	ASSERT_EQ(UnpackedSize, ToSize);
+
+	// the unpacked snapshot keeps the items of the old one first, so compare by key
+	const CSnapshot *pUnpacked = (CSnapshot *)aUnpacked;
+	ASSERT_EQ(pUnpacked->NumItems(), pTo->NumItems());
+	for(int i = 0; i < pTo->NumItems(); i++)
+	{
+		const CSnapshotItem *pItem = pTo->GetItem(i);
+		const void *pUnpackedData = pUnpacked->FindItem(pItem->Type(), pItem->Id());
+		ASSERT_TRUE(pUnpackedData != nullptr);
+		EXPECT_EQ(mem_comp(pUnpackedData, pItem->Data(), pTo->GetItemSize(i)), 0);
+	}
+	EXPECT_EQ(pUnpacked->Crc(), pTo->Crc());
+}
+
+TEST(Snapshot, ItemIndexBenchmark)
+{
+	char aData[CSnapshot::MAX_SIZE];
+	CSnapshot *pSnapshot = (CSnapshot *)aData;
+	for(int NumItems : {256, 512, 1024})
+	{
+		BuildProjectileSnapshot(pSnapshot, NumItems, 0, 1);
+
+		// look up every item once, like CreateDelta does
+		int64_t Found = 0;
+		const int64_t LinearStart = time_get_nanoseconds().count();
+		for(int i = 0; i < NumItems; i++)
+			Found += pSnapshot->GetItemIndex(pSnapshot->GetItem(i)->Key());
+		const int64_t LinearTime = time_get_nanoseconds().count() - LinearStart;
+
+		const int64_t IndexedStart = time_get_nanoseconds().count();
+		CSnapshotItemIndex Index;
+		Index.Build(pSnapshot);
+		for(int i = 0; i < NumItems; i++)
+			Found -= Index.Find(pSnapshot->GetItem(i)->Key());
+		const int64_t IndexedTime = time_get_nanoseconds().count() - IndexedStart;
+
+		EXPECT_EQ(Found, 0);
+		dbg_msg("snapshot", "item lookups items=%d linear=%" PRId64 "ns indexed=%" PRId64 "ns", NumItems, LinearTime, IndexedTime);
+	}
+}
+
+TEST(Snapshot, StorageSteadyStateAllocations)
+{
+	char aData[CSnapshot::MAX_SIZE];
+	CSnapshot *pSnapshot = (CSnapshot *)aData;
+	CSnapshotStorage Storage;
+
+	// keep 150 snapshots like the server does with 3 seconds at 50 ticks
+	int64_t WarmupAllocations = 0;
+	for(int Tick = 0; Tick < 1000; Tick++)
+	{
+		const int Size = BuildProjectileSnapshot(pSnapshot, 1 + Tick % 100, 0, Tick);
+		Storage.PurgeUntil(Tick - 150);
+		Storage.Add(Tick, Tick, Size, pSnapshot, 0, nullptr);
+		ASSERT_EQ(Storage.m_pLast->m_Crc, pSnapshot->Crc());
+		ASSERT_EQ(Storage.Find(Tick), Storage.m_pLast);
+		if(Tick == 500)
+			WarmupAllocations = Storage.NumAllocations();
+
+		const CSnapshot *pStored;
+		ASSERT_EQ(Storage.Get(Tick, nullptr, &pStored, nullptr), Size);
+		ASSERT_EQ(mem_comp(pStored, pSnapshot, Size), 0);
+	}
+	EXPECT_EQ(Storage.NumAllocations(), WarmupAllocations);
+
+	int64_t Tagtime;
+	const CSnapshot *pOld;
+	EXPECT_EQ(Storage.Get(999 - 151, &Tagtime, &pOld, nullptr), -1);
+	ASSERT_GT(Storage.Get(999 - 150, &Tagtime, &pOld, nullptr), 0);
+	EXPECT_EQ(Tagtime, 999 - 150);
+
+	Storage.PurgeAll();
+	EXPECT_EQ(Storage.NumBlocks(), 0);
+	EXPECT_EQ(Storage.NumFrees(), Storage.NumAllocations());
+}
+
+TEST(Snapshot, StorageAltSnapshot)
+{
+	char aData[CSnapshot::MAX_SIZE];
+	char aAltData[CSnapshot::MAX_SIZE];
+	CSnapshot *pSnapshot = (CSnapshot *)aData;
+	CSnapshot *pAltSnapshot = (CSnapshot *)aAltData;
+	CSnapshotStorage Storage;
+
+	for(int Tick = 0; Tick < 10; Tick++)
+	{
+		const int Size = BuildProjectileSnapshot(pSnapshot, CSnapshot::MAX_ITEMS, 0, Tick);
+		const int AltSize = BuildProjectileSnapshot(pAltSnapshot, 3, 0, -Tick);
+		Storage.PurgeUntil(Tick - 2);
+		Storage.Add(Tick, 0, Size, pSnapshot, AltSize, pAltSnapshot);
+
+		const CSnapshot *pStored;
+		const CSnapshot *pAltStored;
+		ASSERT_EQ(Storage.Get(Tick, nullptr, &pStored, &pAltStored), Size);
+		EXPECT_EQ(mem_comp(pStored, pSnapshot, Size), 0);
+		EXPECT_EQ(mem_comp(pAltStored, pAltSnapshot, AltSize), 0);
+	}
+}
+
+TEST(Snapshot, DiffItemMatchesScalar)
+{
+	CPrng Prng;
+	uint64_t aSeed[2] = {1, 2};
+	Prng.Seed(aSeed);
+	// values around the boundaries of the packed sizes
+	const int aEdges[] = {0, 1, -1, 63, 64, -64, -65, 8191, 8192, -8192, -8193, (1 << 20) - 1, 1 << 20, -(1 << 20) - 1, (1 << 27) - 1, 1 << 27, -(1 << 27) - 1, INT_MAX, INT_MIN};
+
+	int aPast[64];
+	int aCurrent[64];
+	int aDiff[64];
+	int aScalarDiff[64];
+	int aOut[64];
+	int aScalarOut[64];
+	for(int Round = 0; Round < 1000; Round++)
+	{
+		// sizes that leave every possible rest for the scalar tail
+		const int Size = Round % 41;
+		for(int i = 0; i < Size; i++)
+		{
+			aPast[i] = (int)Prng.RandomBits();
+			if(Prng.RandomBits() % 4 == 0)
+				aCurrent[i] = aPast[i];
+			else if(Prng.RandomBits() % 2)
+				aCurrent[i] = (unsigned)aPast[i] + (unsigned)aEdges[Prng.RandomBits() % std::size(aEdges)];
+			else
+				aCurrent[i] = (int)Prng.RandomBits();
+		}
+
+		const int Needed = CSnapshotDelta::DiffItem(aPast, aCurrent, aDiff, Size);
+		const int ScalarNeeded = CSnapshotDelta::DiffItemScalar(aPast, aCurrent, aScalarDiff, Size);
+		ASSERT_EQ(Needed, ScalarNeeded);
+		ASSERT_EQ(mem_comp(aDiff, aScalarDiff, Size * sizeof(int)), 0);
+
+		int DataRate = 5;
+		int ScalarDataRate = 5;
+		CSnapshotDelta::UndiffItem(aPast, aDiff, aOut, Size, &DataRate);
+		CSnapshotDelta::UndiffItemScalar(aPast, aDiff, aScalarOut, Size, &ScalarDataRate);
+		ASSERT_EQ(DataRate, ScalarDataRate);
+		ASSERT_EQ(mem_comp(aOut, aScalarOut, Size * sizeof(int)), 0);
+		ASSERT_EQ(mem_comp(aOut, aCurrent, Size * sizeof(int)), 0);
+	}
+}
+
+TEST(Snapshot, UndiffItemDataRateEdges)
+{
+	const int aDiffs[] = {0, 1, -1, 63, 64, -64, -65, 8191, 8192, -8192, -8193, (1 << 20) - 1, 1 << 20, (1 << 27) - 1, 1 << 27, INT_MAX, INT_MIN};
+	for(int Diff : aDiffs)
+	{
+		unsigned char aBuf[CVariableInt::MAX_BYTES_PACKED];
+		const int Bits = Diff == 0 ? 1 : (int)(CVariableInt::Pack(aBuf, Diff, sizeof(aBuf)) - aBuf) * 8;
+		const int aPast[4] = {};
+		const int aDiff[4] = {Diff, Diff, Diff, Diff};
+		int aOut[4];
+		int DataRate = 0;
+		CSnapshotDelta::UndiffItem(aPast, aDiff, aOut, 4, &DataRate);
+		EXPECT_EQ(DataRate, 4 * Bits) << "diff=" << Diff;
+	}
+}
+
+static int BuildCharacterSnapshot(CSnapshot *pSnapshot, int Tick)
+{
+	CSnapshotBuilder Builder;
+	Builder.Init();
+	for(int i = 0; i < 64; i++)
+	{
+		CNetObj_Character *pChar = static_cast<CNetObj_Character *>(Builder.NewItem(CNetObj_Character::ms_MsgId, i, sizeof(CNetObj_Character)));
+		EXPECT_TRUE(pChar != nullptr);
+		if(!pChar)
+			break;
+		mem_zero(pChar, sizeof(*pChar));
+		// moving players, most of the other fields stay the same
+		pChar->m_Tick = Tick;
+		pChar->m_X = i * 100 + Tick * (i % 5);
+		pChar->m_Y = 1000 - Tick * (i % 3);
+		pChar->m_VelX = (i % 5) * 256;
+		pChar->m_VelY = -(i % 3) * 256;
+		pChar->m_Angle = (Tick * 7 + i) % 628;
+		pChar->m_Direction = i % 3 - 1;
+		pChar->m_HookState = i % 2;
+		pChar->m_HookTick = Tick - i;
+		pChar->m_Health = 10;
+		pChar->m_Armor = i % 11;
+		pChar->m_Weapon = i % 6;
+		pChar->m_AttackTick = Tick - Tick % 20;
+	}
+	return Builder.Finish(pSnapshot);
+}
+
+TEST(Snapshot, DiffItemBenchmark)
+{
+	char aFrom[CSnapshot::MAX_SIZE];
+	char aTo[CSnapshot::MAX_SIZE];
+	CSnapshot *pFrom = (CSnapshot *)aFrom;
+	CSnapshot *pTo = (CSnapshot *)aTo;
+	BuildCharacterSnapshot(pFrom, 1000);
+	BuildCharacterSnapshot(pTo, 1001);
+	ASSERT_EQ(pFrom->NumItems(), pTo->NumItems());
+
+	const int Size = sizeof(CNetObj_Character) / sizeof(int);
+	int aaDiffs[64][sizeof(CNetObj_Character) / sizeof(int)];
+	int aOut[sizeof(CNetObj_Character) / sizeof(int)];
+	ASSERT_EQ(pTo->NumItems(), (int)std::size(aaDiffs));
+	const int NumRounds = 2000;
+	int64_t aDiffTimes[2];
+	int64_t aUndiffTimes[2];
+	int aDataRates[2];
+	for(int Scalar = 0; Scalar < 2; Scalar++)
+	{
+		int Needed = 0;
+		aDataRates[Scalar] = 0;
+		const int64_t DiffStart = time_get_nanoseconds().count();
+		for(int Round = 0; Round < NumRounds; Round++)
+		{
+			for(int i = 0; i < pTo->NumItems(); i++)
+			{
+				const int *pPast = (const int *)pFrom->GetItem(i)->Data();
+				const int *pCurrent = (const int *)pTo->GetItem(i)->Data();
+				Needed |= Scalar ? CSnapshotDelta::DiffItemScalar(pPast, pCurrent, aaDiffs[i], Size) : CSnapshotDelta::DiffItem(pPast, pCurrent, aaDiffs[i], Size);
+			}
+		}
+		aDiffTimes[Scalar] = time_get_nanoseconds().count() - DiffStart;
+		EXPECT_NE(Needed, 0);
+
+		const int64_t UndiffStart = time_get_nanoseconds().count();
+		for(int Round = 0; Round < NumRounds; Round++)
+		{
+			for(int i = 0; i < pTo->NumItems(); i++)
+			{
+				const int *pPast = (const int *)pFrom->GetItem(i)->Data();
+				if(Scalar)
+					CSnapshotDelta::UndiffItemScalar(pPast, aaDiffs[i], aOut, Size, &aDataRates[Scalar]);
+				else
+					CSnapshotDelta::UndiffItem(pPast, aaDiffs[i], aOut, Size, &aDataRates[Scalar]);
+			}
+		}
+		aUndiffTimes[Scalar] = time_get_nanoseconds().count() - UndiffStart;
+	}
+	EXPECT_EQ(aDataRates[0], aDataRates[1]);
+
+	const int64_t Bytes = (int64_t)NumRounds * pTo->NumItems() * sizeof(CNetObj_Character);
+	dbg_msg("snapshot", "diff items=%d bytes=%" PRId64 " vector=%" PRId64 "ns scalar=%" PRId64 "ns", pTo->NumItems(), Bytes, aDiffTimes[0], aDiffTimes[1]);
+	dbg_msg("snapshot", "undiff items=%d bytes=%" PRId64 " vector=%" PRId64 "ns scalar=%" PRId64 "ns", pTo->NumItems(), Bytes, aUndiffTimes[0], aUndiffTimes[1]);
+}
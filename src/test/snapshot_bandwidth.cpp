@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/snapshot_bandwidth.h>
+#include <engine/shared/compression.h>
+#include <engine/shared/snapshot.h>
+#include <game/generated/protocol.h>
+
+#include <memory>
+
+class SnapshotBandwidth : public ::testing::Test
+{
+protected:
+	std::unique_ptr<CSnapshotDelta> m_pDelta = std::make_unique<CSnapshotDelta>();
+	CSnapshotBuilder m_Builder;
+	char m_aFromData[CSnapshot::MAX_SIZE];
+	char m_aToData[CSnapshot::MAX_SIZE];
+	CSnapshot *m_pFrom = (CSnapshot *)m_aFromData;
+	CSnapshot *m_pTo = (CSnapshot *)m_aToData;
+	int m_ToSize;
+
+	void AddFlag(int Id, int X)
+	{
+		CNetObj_Flag *pFlag = static_cast<CNetObj_Flag *>(m_Builder.NewItem(CNetObj_Flag::ms_MsgId, Id, sizeof(CNetObj_Flag)));
+		ASSERT_TRUE(pFlag);
+		pFlag->m_X = X;
+		pFlag->m_Y = 100;
+		pFlag->m_Team = 0;
+	}
+
+	void AddPickup(int Id)
+	{
+		CNetObj_Pickup *pPickup = static_cast<CNetObj_Pickup *>(m_Builder.NewItem(CNetObj_Pickup::ms_MsgId, Id, sizeof(CNetObj_Pickup)));
+		ASSERT_TRUE(pPickup);
+		mem_zero(pPickup, sizeof(*pPickup));
+	}
+
+	void AddDDNetCharacter(int Id)
+	{
+		CNetObj_DDNetCharacter *pCharacter = static_cast<CNetObj_DDNetCharacter *>(m_Builder.NewItem(NETOBJTYPE_DDNETCHARACTER, Id, sizeof(CNetObj_DDNetCharacter)));
+		ASSERT_TRUE(pCharacter);
+		mem_zero(pCharacter, sizeof(*pCharacter));
+		pCharacter->m_Jumps = 2;
+	}
+
+	void BuildSnapshots()
+	{
+		m_Builder.Init();
+		AddFlag(0, 1000);
+		AddFlag(1, 2000);
+		AddPickup(0);
+		m_Builder.Finish(m_pFrom);
+
+		// one flag moved, the other one removed, the pickup unchanged
+		m_Builder.Init();
+		AddFlag(0, 1200);
+		AddPickup(0);
+		AddDDNetCharacter(3);
+		m_ToSize = m_Builder.Finish(m_pTo);
+	}
+
+	int Slot(bool Sixup, int Type)
+	{
+		for(int i = 0; i < m_Stats.NumTypes(); i++)
+		{
+			if(m_Stats.TypeSixup(i) == Sixup && m_Stats.Type(i) == Type)
+				return i;
+		}
+		return -1;
+	}
+
+	CSnapshotBandwidth m_Stats;
+};
+
+TEST_F(SnapshotBandwidth, MeasureDelta)
+{
+	BuildSnapshots();
+	// sizes of static items are not part of the delta
+	for(bool Static : {false, true})
+	{
+		if(Static)
+			m_pDelta->SetStaticsize(CNetObj_Flag::ms_MsgId, sizeof(CNetObj_Flag));
+
+		char aDelta[CSnapshot::MAX_SIZE];
+		char aComp[CSnapshot::MAX_SIZE];
+		const int DeltaSize = m_pDelta->CreateDelta(m_pFrom, m_pTo, aDelta);
+		ASSERT_GT(DeltaSize, 0);
+		const int CompSize = CVariableInt::Compress(aDelta, DeltaSize, aComp, sizeof(aComp));
+
+		CSnapshotBandwidth::CDeltaSizes Sizes;
+		CSnapshotBandwidth::MeasureDelta(*m_pDelta, m_pTo, aDelta, DeltaSize, &Sizes);
+		int SumDelta = Sizes.m_HeaderDeltaBytes;
+		int SumComp = Sizes.m_HeaderCompBytes;
+		int NumUpdates = 0;
+		for(const auto &Entry : Sizes.m_vEntries)
+		{
+			SumDelta += Entry.m_DeltaBytes;
+			SumComp += Entry.m_CompBytes;
+			NumUpdates += Entry.m_NumUpdates;
+		}
+		EXPECT_EQ(SumDelta, DeltaSize);
+		EXPECT_EQ(SumComp, CompSize);
+		// moved flag, removed flag, new character and the registration of its type
+		EXPECT_EQ(NumUpdates, 4);
+		EXPECT_EQ(Sizes.m_HeaderDeltaBytes, 3 * (int)sizeof(int32_t));
+	}
+}
+
+TEST_F(SnapshotBandwidth, MeasureEmptyDelta)
+{
+	BuildSnapshots();
+	char aDelta[CSnapshot::MAX_SIZE];
+	const int DeltaSize = m_pDelta->CreateDelta(m_pTo, m_pTo, aDelta);
+	EXPECT_EQ(DeltaSize, 0);
+	CSnapshotBandwidth::CDeltaSizes Sizes;
+	CSnapshotBandwidth::MeasureDelta(*m_pDelta, m_pTo, aDelta, DeltaSize, &Sizes);
+	EXPECT_TRUE(Sizes.m_vEntries.empty());
+	EXPECT_EQ(Sizes.m_HeaderDeltaBytes, 0);
+}
+
+TEST_F(SnapshotBandwidth, AddSnapshot)
+{
+	BuildSnapshots();
+	char aDelta[CSnapshot::MAX_SIZE];
+	char aComp[CSnapshot::MAX_SIZE];
+	const int DeltaSize = m_pDelta->CreateDelta(m_pFrom, m_pTo, aDelta);
+	const int CompSize = CVariableInt::Compress(aDelta, DeltaSize, aComp, sizeof(aComp));
+	CSnapshotBandwidth::CDeltaSizes Sizes;
+	CSnapshotBandwidth::MeasureDelta(*m_pDelta, m_pTo, aDelta, DeltaSize, &Sizes);
+
+	m_Stats.AddSnapshot(5, false, m_pFrom, m_pTo, m_ToSize, Sizes, CompSize);
+	m_Stats.AddSnapshot(5, false, m_pTo, m_pTo, m_ToSize, CSnapshotBandwidth::CDeltaSizes(), 0);
+
+	const int FlagSlot = Slot(false, CNetObj_Flag::ms_MsgId);
+	ASSERT_GE(FlagSlot, 0);
+	EXPECT_EQ(m_Stats.TypeTotal(FlagSlot).m_NumItems, 2);
+	EXPECT_EQ(m_Stats.TypeTotal(FlagSlot).m_SnapBytes, 2 * (int)(sizeof(CSnapshotItem) + sizeof(CNetObj_Flag)));
+	EXPECT_EQ(m_Stats.TypeTotal(FlagSlot).m_NumUpdates, 2);
+
+	const int PickupSlot = Slot(false, CNetObj_Pickup::ms_MsgId);
+	ASSERT_GE(PickupSlot, 0);
+	EXPECT_EQ(m_Stats.TypeTotal(PickupSlot).m_NumItems, 2);
+	EXPECT_EQ(m_Stats.TypeTotal(PickupSlot).m_NumUpdates, 0);
+
+	// extended types are counted by their UUID type, not the internal one
+	const int CharacterSlot = Slot(false, NETOBJTYPE_DDNETCHARACTER);
+	ASSERT_GE(CharacterSlot, 0);
+	EXPECT_EQ(m_Stats.TypeTotal(CharacterSlot).m_NumItems, 2);
+	EXPECT_EQ(m_Stats.TypeTotal(CharacterSlot).m_NumUpdates, 1);
+	char aName[64];
+	CSnapshotBandwidth::TypeName(false, NETOBJTYPE_DDNETCHARACTER, aName, sizeof(aName));
+	EXPECT_STREQ(aName, "DDNetCharacter");
+
+	const CSnapshotBandwidth::CClientTotal &Total = m_Stats.ClientTotal(5);
+	EXPECT_EQ(Total.m_NumSnapshots, 2);
+	EXPECT_EQ(Total.m_NumEmpty, 1);
+	EXPECT_EQ(Total.m_Counter.m_SnapBytes, 2 * m_ToSize);
+	EXPECT_EQ(Total.m_Counter.m_DeltaBytes, DeltaSize);
+	EXPECT_EQ(Total.m_Counter.m_CompBytes, CompSize);
+
+	ASSERT_TRUE(m_Stats.ClientType(5, FlagSlot));
+	EXPECT_EQ(m_Stats.ClientType(5, FlagSlot)->m_CompBytes, m_Stats.TypeTotal(FlagSlot).m_CompBytes);
+	EXPECT_FALSE(m_Stats.ClientType(4, FlagSlot));
+
+	m_Stats.ResetClient(5);
+	EXPECT_EQ(m_Stats.ClientTotal(5).m_NumSnapshots, 0);
+	EXPECT_FALSE(m_Stats.ClientType(5, FlagSlot));
+	EXPECT_EQ(m_Stats.TypeTotal(FlagSlot).m_NumItems, 2);
+
+	m_Stats.Reset();
+	EXPECT_EQ(m_Stats.NumTypes(), 0);
+}
+
+TEST_F(SnapshotBandwidth, SeparateProtocols)
+{
+	BuildSnapshots();
+	m_Stats.AddSnapshot(0, false, m_pTo, m_pTo, m_ToSize, CSnapshotBandwidth::CDeltaSizes(), 0);
+	m_Stats.AddSnapshot(1, true, m_pTo, m_pTo, m_ToSize, CSnapshotBandwidth::CDeltaSizes(), 0);
+	const int Slot6 = Slot(false, CNetObj_Flag::ms_MsgId);
+	const int Slot7 = Slot(true, CNetObj_Flag::ms_MsgId);
+	ASSERT_GE(Slot6, 0);
+	ASSERT_GE(Slot7, 0);
+	EXPECT_NE(Slot6, Slot7);
+	EXPECT_TRUE(m_Stats.ClientType(0, Slot6));
+	EXPECT_FALSE(m_Stats.ClientType(0, Slot7));
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/client/snapshot_unpacker.h>
+#include <engine/shared/compression.h>
+#include <engine/shared/snapshot.h>
+#include <game/generated/protocol.h>
+
+#include <memory>
+
+class SnapshotUnpacker : public ::testing::Test
+{
+protected:
+	enum
+	{
+		NUM_SNAPSHOTS = 8,
+	};
+
+	std::unique_ptr<CSnapshotDelta> m_pDelta = std::make_unique<CSnapshotDelta>();
+	char m_aaSnapshots[NUM_SNAPSHOTS][CSnapshot::MAX_SIZE];
+	int m_aSnapshotSizes[NUM_SNAPSHOTS];
+	// snapshot i compressed as delta to snapshot i - 1, the first one to the empty snapshot
+	char m_aaCompData[NUM_SNAPSHOTS][CSnapshot::MAX_SIZE];
+	int m_aCompSizes[NUM_SNAPSHOTS];
+
+	const CSnapshot *Snapshot(int Index) const { return (const CSnapshot *)m_aaSnapshots[Index]; }
+	const CSnapshot *DeltaShot(int Index) const { return Index == 0 ? CSnapshot::EmptySnapshot() : Snapshot(Index - 1); }
+	int DeltaShotSize(int Index) const { return Index == 0 ? (int)sizeof(CSnapshot) : m_aSnapshotSizes[Index - 1]; }
+
+	void SetUp() override
+	{
+		for(int s = 0; s < NUM_SNAPSHOTS; s++)
+		{
+			CSnapshotBuilder Builder;
+			Builder.Init();
+			for(int i = 0; i < 40 + s * 5; i++)
+			{
+				CNetObj_Projectile *pProj = static_cast<CNetObj_Projectile *>(Builder.NewItem(CNetObj_Projectile::ms_MsgId, i, sizeof(CNetObj_Projectile)));
+				ASSERT_TRUE(pProj);
+				pProj->m_X = i * 32 + s * (i % 4);
+				pProj->m_Y = 100 - s * (i % 3);
+				pProj->m_VelX = i % 5;
+				pProj->m_VelY = -i;
+				pProj->m_Type = i % 4;
+				pProj->m_StartTick = 1000 + i;
+			}
+			m_aSnapshotSizes[s] = Builder.Finish(m_aaSnapshots[s]);
+
+			char aDeltaData[CSnapshot::MAX_SIZE];
+			const int DeltaSize = m_pDelta->CreateDelta(DeltaShot(s), Snapshot(s), aDeltaData);
+			ASSERT_GT(DeltaSize, 0);
+			m_aCompSizes[s] = CVariableInt::Compress(aDeltaData, DeltaSize, m_aaCompData[s], sizeof(m_aaCompData[s]));
+			ASSERT_GT(m_aCompSizes[s], 0);
+		}
+	}
+
+	void FillJob(CSnapshotUnpacker::CJob *pJob, int Index, bool Corrupt = false) const
+	{
+		pJob->m_Conn = Index % 2;
+		pJob->m_Dummy = Index % 2;
+		pJob->m_Generation = 0;
+		pJob->m_GameTick = Index;
+		pJob->m_DeltaTick = Index - 1;
+		pJob->m_Crc = Snapshot(Index)->Crc() + (Corrupt ? 1 : 0);
+		pJob->m_CheckCrc = true;
+		pJob->m_Sixup = false;
+		pJob->m_RecvTime = Index;
+	}
+
+	// the decompression and unpacking as done on the main thread before
+	int UnpackDirectly(int Index, CSnapshot *pSnap) const
+	{
+		char aDeltaData[CSnapshot::MAX_SIZE];
+		const int DeltaSize = CVariableInt::Decompress(m_aaCompData[Index], m_aCompSizes[Index], aDeltaData, sizeof(aDeltaData));
+		EXPECT_GT(DeltaSize, 0);
+		return m_pDelta->UnpackDelta(DeltaShot(Index), pSnap, aDeltaData, DeltaSize, false);
+	}
+};
+
+TEST_F(SnapshotUnpacker, UnpackMatchesDirect)
+{
+	for(int s = 0; s < NUM_SNAPSHOTS; s++)
+	{
+		char aSnap[CSnapshot::MAX_SIZE];
+		char aExpected[CSnapshot::MAX_SIZE];
+		char aDeltaData[CSnapshot::MAX_SIZE];
+		CSnapshotUnpacker::CJob Job;
+		Job.m_pData = m_aaCompData[s];
+		Job.m_DataSize = m_aCompSizes[s];
+		Job.m_pDeltaShot = DeltaShot(s);
+		Job.m_pSnap = (CSnapshot *)aSnap;
+		FillJob(&Job, s);
+		CSnapshotUnpacker::Unpack(m_pDelta.get(), aDeltaData, &Job);
+
+		const int ExpectedSize = UnpackDirectly(s, (CSnapshot *)aExpected);
+		ASSERT_EQ(Job.m_Result, CSnapshotUnpacker::RESULT_OK) << "snapshot=" << s;
+		ASSERT_EQ(Job.m_SnapSize, ExpectedSize);
+		EXPECT_EQ(Job.m_SnapSize, m_aSnapshotSizes[s]);
+		EXPECT_EQ(mem_comp(aSnap, aExpected, ExpectedSize), 0);
+	}
+}
+
+TEST_F(SnapshotUnpacker, UnpackErrors)
+{
+	char aSnap[CSnapshot::MAX_SIZE];
+	char aDeltaData[CSnapshot::MAX_SIZE];
+	CSnapshotUnpacker::CJob Job;
+	Job.m_pData = m_aaCompData[1];
+	Job.m_DataSize = m_aCompSizes[1];
+	Job.m_pDeltaShot = DeltaShot(1);
+	Job.m_pSnap = (CSnapshot *)aSnap;
+	FillJob(&Job, 1, true);
+	CSnapshotUnpacker::Unpack(m_pDelta.get(), aDeltaData, &Job);
+	EXPECT_EQ(Job.m_Result, CSnapshotUnpacker::RESULT_CRC_ERROR);
+
+	// cut off in the middle of a packed int
+	const unsigned char aTruncated[] = {0x80};
+	Job.m_pData = aTruncated;
+	Job.m_DataSize = sizeof(aTruncated);
+	FillJob(&Job, 1);
+	CSnapshotUnpacker::Unpack(m_pDelta.get(), aDeltaData, &Job);
+	EXPECT_EQ(Job.m_Result, CSnapshotUnpacker::RESULT_DECOMPRESS_FAILED);
+}
+
+TEST_F(SnapshotUnpacker, ThreadKeepsOrder)
+{
+	CSnapshotUnpacker Unpacker;
+	Unpacker.Init(*m_pDelta);
+	int NumPushed = 0;
+	int NumTaken = 0;
+	// fill the queue, then take the jobs out with and without waiting
+	while(NumTaken < NUM_SNAPSHOTS)
+	{
+		while(NumPushed < NUM_SNAPSHOTS && !Unpacker.IsFull())
+		{
+			CSnapshotUnpacker::CJob *pJob = Unpacker.NewJob(m_aaCompData[NumPushed], m_aCompSizes[NumPushed], DeltaShot(NumPushed), DeltaShotSize(NumPushed));
+			FillJob(pJob, NumPushed, NumPushed == 5);
+			Unpacker.Push();
+			NumPushed++;
+		}
+		EXPECT_EQ(Unpacker.NumPending(), NumPushed - NumTaken);
+
+		CSnapshotUnpacker::CJob *pJob = Unpacker.Finished(NumTaken % 2 == 0);
+		if(!pJob)
+			pJob = Unpacker.Finished(true);
+		ASSERT_TRUE(pJob);
+		EXPECT_EQ(pJob->m_GameTick, NumTaken);
+		EXPECT_EQ(pJob->m_Dummy, NumTaken % 2 == 1);
+		EXPECT_EQ(pJob->m_RecvTime, NumTaken);
+		if(NumTaken == 5)
+		{
+			EXPECT_EQ(pJob->m_Result, CSnapshotUnpacker::RESULT_CRC_ERROR);
+		}
+		else
+		{
+			ASSERT_EQ(pJob->m_Result, CSnapshotUnpacker::RESULT_OK) << "snapshot=" << NumTaken;
+			ASSERT_EQ(pJob->m_SnapSize, m_aSnapshotSizes[NumTaken]);
+			EXPECT_EQ(mem_comp(pJob->m_pSnap, Snapshot(NumTaken), pJob->m_SnapSize), 0);
+		}
+		Unpacker.Pop();
+		NumTaken++;
+	}
+	EXPECT_EQ(Unpacker.NumPending(), 0);
+	EXPECT_FALSE(Unpacker.Finished(false));
+	Unpacker.Shutdown();
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/snapshot_workers.h>
+#include <engine/shared/snapshot.h>
+#include <game/generated/protocol.h>
+
+#include <memory>
+
+class SnapshotWorkers : public ::testing::Test
+{
+protected:
+	enum
+	{
+		NUM_SNAPSHOTS = 6,
+		NUM_TASKS = 24,
+	};
+
+	std::unique_ptr<CSnapshotDelta> m_pDelta = std::make_unique<CSnapshotDelta>();
+	char m_aaSnapshots[NUM_SNAPSHOTS][CSnapshot::MAX_SIZE];
+	int m_aSnapshotSizes[NUM_SNAPSHOTS];
+	char m_aDeltaData[CSnapshot::MAX_SIZE];
+
+	const CSnapshot *Snapshot(int Index) const { return (const CSnapshot *)m_aaSnapshots[Index]; }
+
+	void SetUp() override
+	{
+		// snapshots of a few ticks, the items move and appear over time
+		for(int s = 0; s < NUM_SNAPSHOTS; s++)
+		{
+			CSnapshotBuilder Builder;
+			Builder.Init();
+			for(int i = 0; i < 50 + s * 10; i++)
+			{
+				CNetObj_Projectile *pProj = static_cast<CNetObj_Projectile *>(Builder.NewItem(CNetObj_Projectile::ms_MsgId, i, sizeof(CNetObj_Projectile)));
+				ASSERT_TRUE(pProj);
+				pProj->m_X = i * 32 + s * (i % 4);
+				pProj->m_Y = 100 - s * (i % 3);
+				pProj->m_VelX = i % 5;
+				pProj->m_VelY = -i;
+				pProj->m_Type = i % 4;
+				pProj->m_StartTick = 1000 + i;
+			}
+			m_aSnapshotSizes[s] = Builder.Finish(m_aaSnapshots[s]);
+		}
+	}
+
+	void FillTasks(CSnapshotWorkers *pWorkers)
+	{
+		for(int i = 0; i < NUM_TASKS; i++)
+		{
+			// every client gets the newest snapshot, but acked a different one
+			const int From = i % NUM_SNAPSHOTS;
+			const int To = NUM_SNAPSHOTS - 1 - (i / (NUM_TASKS / 2));
+			CSnapshotWorkers::CTask *pTask = pWorkers->Task(i);
+			pTask->m_ClientId = i;
+			pTask->m_Crc = Snapshot(To)->Crc();
+			pTask->m_DeltaTick = From;
+			pTask->m_Sixup = i % 3 == 0;
+			pTask->m_pFrom = Snapshot(From);
+			pTask->m_FromSize = m_aSnapshotSizes[From];
+			pTask->m_FromCrc = Snapshot(From)->Crc();
+			pTask->m_pTo = Snapshot(To);
+			pTask->m_ToSize = m_aSnapshotSizes[To];
+			pTask->m_MeasureDelta = true;
+			pTask->m_pSource = nullptr;
+		}
+	}
+};
+
+TEST_F(SnapshotWorkers, ThreadedMatchesSingleThreaded)
+{
+	CSnapshotWorkers Single;
+	Single.Init(0, *m_pDelta);
+	FillTasks(&Single);
+	Single.Run(m_pDelta.get(), m_aDeltaData, NUM_TASKS);
+
+	for(int NumThreads : {1, 3, 8})
+	{
+		CSnapshotWorkers Threaded;
+		Threaded.Init(NumThreads, *m_pDelta);
+		FillTasks(&Threaded);
+		// run several times, the tasks are picked up in a different order each time
+		for(int Round = 0; Round < 5; Round++)
+		{
+			Threaded.Run(m_pDelta.get(), m_aDeltaData, NUM_TASKS);
+			for(int i = 0; i < NUM_TASKS; i++)
+			{
+				const CSnapshotWorkers::CTask *pExpected = Single.Task(i);
+				const CSnapshotWorkers::CTask *pTask = Threaded.Task(i);
+				// deltas against the same snapshot are empty
+				EXPECT_EQ(pExpected->m_CompSize == 0, pTask->m_pFrom == pTask->m_pTo);
+				ASSERT_EQ(pTask->m_CompSize, pExpected->m_CompSize) << "threads=" << NumThreads << " task=" << i;
+				EXPECT_EQ(mem_comp(pTask->m_aCompData, pExpected->m_aCompData, pExpected->m_CompSize), 0) << "threads=" << NumThreads << " task=" << i;
+				EXPECT_EQ(pTask->m_DeltaSizes.m_HeaderDeltaBytes, pExpected->m_DeltaSizes.m_HeaderDeltaBytes);
+				EXPECT_EQ(pTask->m_DeltaSizes.m_vEntries.size(), pExpected->m_DeltaSizes.m_vEntries.size());
+			}
+		}
+		Threaded.Shutdown();
+	}
+	Single.Shutdown();
+}
+
+TEST_F(SnapshotWorkers, MatchesProcess)
+{
+	CSnapshotWorkers Workers;
+	Workers.Init(2, *m_pDelta);
+	FillTasks(&Workers);
+	Workers.Run(m_pDelta.get(), m_aDeltaData, NUM_TASKS);
+
+	// the plain single task path, as used without workers
+	CSnapshotWorkers::CTask Task;
+	for(int i = 0; i < NUM_TASKS; i++)
+	{
+		Task = *Workers.Task(i);
+		CSnapshotWorkers::Process(m_pDelta.get(), m_aDeltaData, &Task);
+		ASSERT_EQ(Task.m_CompSize, Workers.Task(i)->m_CompSize);
+		EXPECT_EQ(mem_comp(Task.m_aCompData, Workers.Task(i)->m_aCompData, Task.m_CompSize), 0);
+	}
+	Workers.Shutdown();
+}
+
+static int BuildFlagSnapshot(void *pData, int X, int Y)
+{
+	CSnapshotBuilder Builder;
+	Builder.Init();
+	CNetObj_Flag *pFlag = static_cast<CNetObj_Flag *>(Builder.NewItem(CNetObj_Flag::ms_MsgId, 0, sizeof(CNetObj_Flag)));
+	EXPECT_TRUE(pFlag);
+	pFlag->m_X = X;
+	pFlag->m_Y = Y;
+	pFlag->m_Team = 0;
+	return Builder.Finish(pData);
+}
+
+TEST_F(SnapshotWorkers, Deduplicate)
+{
+	// A and its copy are identical, B differs but has the same crc and size
+	char aA[CSnapshot::MAX_SIZE];
+	char aACopy[CSnapshot::MAX_SIZE];
+	char aB[CSnapshot::MAX_SIZE];
+	const CSnapshot *pA = (const CSnapshot *)aA;
+	const CSnapshot *pACopy = (const CSnapshot *)aACopy;
+	const CSnapshot *pB = (const CSnapshot *)aB;
+	const int Size = BuildFlagSnapshot(aA, 1, 1);
+	ASSERT_EQ(BuildFlagSnapshot(aACopy, 1, 1), Size);
+	ASSERT_EQ(BuildFlagSnapshot(aB, 2, 0), Size);
+	ASSERT_EQ(pA->Crc(), pB->Crc());
+	ASSERT_NE(mem_comp(pA, pB, Size), 0);
+
+	CSnapshotWorkers Workers;
+	int NumTasks = 0;
+	const auto &&Add = [&](const CSnapshot *pTo, const CSnapshot *pFrom, bool Sixup) {
+		CSnapshotWorkers::CTask *pTask = Workers.Task(NumTasks);
+		pTask->m_ClientId = NumTasks;
+		pTask->m_Crc = pTo->Crc();
+		pTask->m_DeltaTick = 0;
+		pTask->m_Sixup = Sixup;
+		pTask->m_pFrom = pFrom;
+		pTask->m_FromSize = Size;
+		pTask->m_FromCrc = pFrom->Crc();
+		pTask->m_pTo = pTo;
+		pTask->m_ToSize = Size;
+		pTask->m_MeasureDelta = false;
+		return Workers.Deduplicate(NumTasks++);
+	};
+
+	EXPECT_FALSE(Add(pA, pB, false));
+	// identical contents in other buffers
+	EXPECT_TRUE(Add(pACopy, pB, false));
+	EXPECT_EQ(Workers.Task(1)->Result(), Workers.Task(0));
+	// same crc and size, but different contents
+	EXPECT_FALSE(Add(pB, pB, false));
+	EXPECT_FALSE(Add(pA, pA, false));
+	EXPECT_TRUE(Add(pA, pACopy, false));
+	EXPECT_EQ(Workers.Task(4)->Result(), Workers.Task(3));
+	// same contents, different protocol
+	EXPECT_FALSE(Add(pA, pB, true));
+	EXPECT_EQ(Workers.NumCacheHits(), 2);
+	EXPECT_EQ(Workers.NumCacheMisses(), 4);
+
+	// the cache is started anew with the first task of a tick
+	NumTasks = 0;
+	EXPECT_FALSE(Add(pA, pA, false));
+	EXPECT_TRUE(Add(pACopy, pA, false));
+
+	Workers.Init(2, *m_pDelta);
+	Workers.Run(m_pDelta.get(), m_aDeltaData, NumTasks);
+	EXPECT_EQ(Workers.Task(1)->Result()->m_CompSize, Workers.Task(0)->m_CompSize);
+	Workers.Shutdown();
+}
@@ -1,12 +1,17 @@
+#include "test.h"
 #include <gtest/gtest.h>
 
 #include <base/detect.h>
 #include <engine/external/json-parser/json.h>
 #include <engine/server.h>
 #include <engine/shared/config.h>
+#include <engine/shared/teehistorian_reader.h>
 #include <game/gamecore.h>
 #include <game/server/teehistorian.h>
 
+#include <zlib.h>
+
+#include <algorithm>
 #include <vector>
 
 void RegisterGameUuids(CUuidManager *pManager);
@@ -105,7 +110,7 @@ protected:
 	void Expect(const unsigned char *pOutput, size_t OutputSize)
 	{
 		static CUuid TEEHISTORIAN_UUID = CalculateUuid("teehistorian@ddnet.tw");
-		static const char PREFIX1[] = "{\"comment\":\"teehistorian@ddnet.tw\",\"version\":\"2\",\"version_minor\":\"8\",\"game_uuid\":\"a1eb7182-796e-3b3e-941d-38ca71b2a4a8\",\"server_version\":\"DDNet test\",\"start_time\":\"";
+		static const char PREFIX1[] = "{\"comment\":\"teehistorian@ddnet.tw\",\"version\":\"2\",\"version_minor\":\"9\",\"game_uuid\":\"a1eb7182-796e-3b3e-941d-38ca71b2a4a8\",\"server_version\":\"DDNet test\",\"start_time\":\"";
 		static const char PREFIX2[] = "\",\"server_name\":\"server name\",\"server_port\":\"8303\",\"game_type\":\"game type\",\"map_name\":\"Kobra 3 Solo\",\"map_size\":\"903514\",\"map_sha256\":\"0123456789012345678901234567890123456789012345678901234567890123\",\"map_crc\":\"eceaf25c\",\"prng_description\":\"test-prng:02468ace\",\"config\":{},\"tuning\":{},\"uuids\":[";
 		static const char PREFIX3[] = "]}";
 
@@ -515,6 +520,99 @@ TEST_F(TeeHistorian, Input)
 	Expect(EXPECTED, sizeof(EXPECTED));
 }
 
+TEST_F(TeeHistorian, InputUnchangedFirst)
+{
+	CNetObj_PlayerInput Input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	const unsigned char EXPECTED[] = {
+		// TICK_SKIP dt=0
+		0x41, 0x00,
+		// new player -> InputNew
+		0x45,
+		0x00, // ClientId 0
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+		// TICK_SKIP dt=0
+		0x41, 0x00,
+		// unchanged first input of the tick, followed by a different one
+		// -> InputDiff without difference
+		0x44,
+		0x00, // ClientId 0
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		// InputDiff
+		0x44,
+		0x00, // ClientId 0
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		// unchanged first input of the tick alone -> nothing
+		// FINISH
+		0x40};
+
+	Tick(1);
+	m_TH.RecordPlayerInput(0, 1, &Input);
+
+	Tick(2);
+	m_TH.RecordPlayerInput(0, 1, &Input);
+	m_TH.RecordPlayerInput(0, 1, &Input);
+	Input.m_Direction = 0;
+	m_TH.RecordPlayerInput(0, 1, &Input);
+
+	Tick(3);
+	m_TH.RecordPlayerInput(0, 1, &Input);
+
+	Finish();
+	Expect(EXPECTED, sizeof(EXPECTED));
+}
+
+TEST_F(TeeHistorian, DirectInput)
+{
+	CNetObj_PlayerInput Input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	const unsigned char EXPECTED[] = {
+		// TICK_SKIP dt=0
+		0x41, 0x00,
+		// EX uuid=6b36a486-f14f-3a54-b5a5-2eb3859018ea datalen=12
+		0x4a,
+		0x6b, 0x36, 0xa4, 0x86, 0xf1, 0x4f, 0x3a, 0x54,
+		0xb5, 0xa5, 0x2e, 0xb3, 0x85, 0x90, 0x18, 0xea,
+		0x0c,
+		// (PLAYER_DIRECT_INPUT) cid=0 new=1
+		0x00, 0x01,
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+		// same unique id, same input -> written as difference
+		0x4a,
+		0x6b, 0x36, 0xa4, 0x86, 0xf1, 0x4f, 0x3a, 0x54,
+		0xb5, 0xa5, 0x2e, 0xb3, 0x85, 0x90, 0x18, 0xea,
+		0x0c,
+		0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		// same unique id, different input -> written as difference
+		0x4a,
+		0x6b, 0x36, 0xa4, 0x86, 0xf1, 0x4f, 0x3a, 0x54,
+		0xb5, 0xa5, 0x2e, 0xb3, 0x85, 0x90, 0x18, 0xea,
+		0x0c,
+		0x00, 0x00,
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		// different unique id, same input -> new
+		0x4a,
+		0x6b, 0x36, 0xa4, 0x86, 0xf1, 0x4f, 0x3a, 0x54,
+		0xb5, 0xa5, 0x2e, 0xb3, 0x85, 0x90, 0x18, 0xea,
+		0x0c,
+		0x00, 0x01,
+		0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+		// FINISH
+		0x40};
+
+	Tick(1);
+
+	m_TH.RecordPlayerDirectInput(0, 1, &Input);
+	m_TH.RecordPlayerDirectInput(0, 1, &Input);
+
+	Input.m_Direction = 0;
+
+	m_TH.RecordPlayerDirectInput(0, 1, &Input);
+	m_TH.RecordPlayerDirectInput(0, 2, &Input);
+
+	Finish();
+	Expect(EXPECTED, sizeof(EXPECTED));
+}
+
 TEST_F(TeeHistorian, SaveSuccess)
 {
 	const unsigned char EXPECTED[] = {
@@ -904,3 +1002,331 @@ TEST_F(TeeHistorian, PrevGameUuid)
 	EXPECT_STREQ(JsonPrevGameUuid, "fe19c218-f555-4002-a273-126c59ccc17a");
 	json_value_free(pJson);
 }
+
+TEST_F(TeeHistorian, Reader)
+{
+	CNetObj_PlayerInput Input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	m_TH.RecordPlayerJoin(3, CTeeHistorian::PROTOCOL_7);
+	Tick(1);
+	Player(0, 10, 20);
+	Player(3, 30, 40);
+	Inputs();
+	m_TH.RecordPlayerInput(3, 1, &Input);
+	Tick(2);
+	Player(0, 11, 20);
+	Player(3, 30, 40);
+	Inputs();
+	Input.m_Direction = -1;
+	m_TH.RecordPlayerInput(3, 1, &Input);
+	m_TH.RecordPlayerMessage(3, "\x01\x02", 2);
+	Tick(5);
+	DeadPlayer(0);
+	Player(3, 31, 39);
+	Inputs();
+	m_TH.RecordPlayerDrop(3, "bye");
+	Finish();
+
+	CTeeHistorianReader Reader;
+	ASSERT_TRUE(Reader.Load(m_vBuffer.data(), m_vBuffer.size())) << Reader.Error();
+	EXPECT_STREQ(Reader.HeaderString("map_name"), "Kobra 3 Solo");
+	EXPECT_STREQ(Reader.HeaderString("prng_description"), "test-prng:02468ace");
+	EXPECT_STREQ(Reader.HeaderString("nonexistent"), "");
+
+	CTeeHistorianReader::CChunk Chunk;
+	auto ExpectChunk = [&](int Type, int Tick, int ClientId) {
+		ASSERT_TRUE(Reader.NextChunk(&Chunk)) << Reader.Error();
+		EXPECT_EQ(Chunk.m_Type, Type);
+		EXPECT_EQ(Chunk.m_Tick, Tick);
+		EXPECT_EQ(Chunk.m_ClientId, ClientId);
+	};
+
+	ExpectChunk(CTeeHistorianReader::CHUNK_EX, 0, -1);
+	EXPECT_EQ(Chunk.m_Uuid, CalculateUuid("teehistorian-joinver7@ddnet.tw"));
+	ExpectChunk(CTeeHistorianReader::CHUNK_JOIN, 0, 3);
+
+	ExpectChunk(CTeeHistorianReader::CHUNK_PLAYER_NEW, 1, 0);
+	EXPECT_EQ(Chunk.m_X, 10);
+	EXPECT_EQ(Chunk.m_Y, 20);
+	ExpectChunk(CTeeHistorianReader::CHUNK_PLAYER_NEW, 1, 3);
+	ExpectChunk(CTeeHistorianReader::CHUNK_INPUT_NEW, 1, 3);
+	EXPECT_EQ(Chunk.m_Input.m_Direction, 1);
+	EXPECT_EQ(Chunk.m_Input.m_PrevWeapon, 10);
+
+	// implicit tick, only the changed position is recorded
+	ExpectChunk(CTeeHistorianReader::CHUNK_PLAYER_DIFF, 2, 0);
+	EXPECT_EQ(Chunk.m_X, 11);
+	EXPECT_EQ(Chunk.m_Y, 20);
+	ExpectChunk(CTeeHistorianReader::CHUNK_INPUT_DIFF, 2, 3);
+	EXPECT_EQ(Chunk.m_Input.m_Direction, -1);
+	EXPECT_EQ(Chunk.m_Input.m_PrevWeapon, 10);
+	ExpectChunk(CTeeHistorianReader::CHUNK_MESSAGE, 2, 3);
+	ASSERT_EQ(Chunk.m_DataSize, 2);
+	EXPECT_EQ(mem_comp(Chunk.m_pData, "\x01\x02", 2), 0);
+
+	ExpectChunk(CTeeHistorianReader::CHUNK_TICK_SKIP, 5, -1);
+	EXPECT_EQ(Chunk.m_Dt, 2);
+	ExpectChunk(CTeeHistorianReader::CHUNK_PLAYER_OLD, 5, 0);
+	ExpectChunk(CTeeHistorianReader::CHUNK_PLAYER_DIFF, 5, 3);
+	EXPECT_EQ(Chunk.m_X, 31);
+	EXPECT_EQ(Chunk.m_Y, 39);
+	ExpectChunk(CTeeHistorianReader::CHUNK_DROP, 5, 3);
+	EXPECT_STREQ(Chunk.m_pString, "bye");
+
+	ExpectChunk(CTeeHistorianReader::CHUNK_FINISH, 5, -1);
+	EXPECT_FALSE(Reader.NextChunk(&Chunk));
+	EXPECT_STREQ(Reader.Error(), "");
+}
+
+TEST_F(TeeHistorian, ReaderTruncated)
+{
+	Tick(1);
+	Player(0, 1000, 2000);
+	Finish();
+
+	CTeeHistorianReader Reader;
+	ASSERT_TRUE(Reader.Load(m_vBuffer.data(), m_vBuffer.size() - 3));
+	CTeeHistorianReader::CChunk Chunk;
+	EXPECT_FALSE(Reader.NextChunk(&Chunk));
+	EXPECT_STREQ(Reader.Error(), "truncated chunk");
+
+	EXPECT_FALSE(Reader.Load("not a teehistorian file", 24));
+	EXPECT_STREQ(Reader.Error(), "not a teehistorian file");
+}
+
+TEST_F(TeeHistorian, ReaderCompressed)
+{
+	Tick(1);
+	Player(0, 1000, 2000);
+	Finish();
+
+	std::vector<unsigned char> vCompressed(m_vBuffer.size() + 128);
+	z_stream Stream;
+	mem_zero(&Stream, sizeof(Stream));
+	ASSERT_EQ(deflateInit2(&Stream, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+	Stream.next_in = m_vBuffer.data();
+	Stream.avail_in = m_vBuffer.size();
+	Stream.next_out = vCompressed.data();
+	Stream.avail_out = vCompressed.size();
+	ASSERT_EQ(deflate(&Stream, Z_FINISH), Z_STREAM_END);
+	vCompressed.resize(Stream.total_out);
+	deflateEnd(&Stream);
+
+	CTeeHistorianReader Reader;
+	ASSERT_TRUE(Reader.Load(vCompressed.data(), vCompressed.size())) << Reader.Error();
+	EXPECT_STREQ(Reader.HeaderString("map_name"), "Kobra 3 Solo");
+	CTeeHistorianReader::CChunk Chunk;
+	ASSERT_TRUE(Reader.NextChunk(&Chunk));
+	EXPECT_EQ(Chunk.m_Type, CTeeHistorianReader::CHUNK_PLAYER_NEW);
+	EXPECT_EQ(Chunk.m_X, 1000);
+	ASSERT_TRUE(Reader.NextChunk(&Chunk));
+	EXPECT_EQ(Chunk.m_Type, CTeeHistorianReader::CHUNK_FINISH);
+
+	vCompressed[vCompressed.size() / 2] ^= 0xff;
+	EXPECT_FALSE(Reader.Load(vCompressed.data(), vCompressed.size()));
+}
+
+TEST_F(TeeHistorian, ReaderIndex)
+{
+	CNetObj_PlayerInput Input = {};
+	for(int t = 1; t <= 40; t++)
+	{
+		// nothing happens in some ticks
+		if(t % 7 == 0)
+			continue;
+		Tick(t);
+		Player(0, t, -t);
+		if(t >= 10 && t < 20)
+			Player(1, 100 + t, 100);
+		else if(t == 20)
+			DeadPlayer(1);
+		Inputs();
+		Input.m_Direction = t % 3 - 1;
+		m_TH.RecordPlayerInput(0, 1, &Input);
+	}
+	Finish();
+
+	CTeeHistorianReader Reader;
+	ASSERT_TRUE(Reader.Load(m_vBuffer.data(), m_vBuffer.size()));
+	std::vector<CTeeHistorianReader::CChunk> vChunks;
+	CTeeHistorianReader::CChunk Chunk;
+	while(Reader.NextChunk(&Chunk))
+		vChunks.push_back(Chunk);
+	ASSERT_STREQ(Reader.Error(), "");
+
+	ASSERT_TRUE(Reader.Load(m_vBuffer.data(), m_vBuffer.size()));
+	ASSERT_TRUE(Reader.BuildIndex(4));
+
+	auto ExpectSeek = [&](CTeeHistorianReader *pReader, int Tick) {
+		ASSERT_TRUE(pReader->SeekTick(Tick)) << Tick;
+		size_t First = 0;
+		while(vChunks[First].m_Tick < Tick)
+			First++;
+		for(size_t i = First; i < vChunks.size(); i++)
+		{
+			ASSERT_TRUE(pReader->NextChunk(&Chunk)) << Tick;
+			EXPECT_EQ(Chunk.m_Type, vChunks[i].m_Type) << Tick;
+			EXPECT_EQ(Chunk.m_Tick, vChunks[i].m_Tick) << Tick;
+			EXPECT_EQ(Chunk.m_ClientId, vChunks[i].m_ClientId) << Tick;
+			if(Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_DIFF)
+			{
+				EXPECT_EQ(Chunk.m_X, vChunks[i].m_X) << Tick;
+				EXPECT_EQ(Chunk.m_Y, vChunks[i].m_Y) << Tick;
+			}
+			if(Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_DIFF)
+			{
+				EXPECT_EQ(Chunk.m_Input.m_Direction, vChunks[i].m_Input.m_Direction) << Tick;
+			}
+		}
+		EXPECT_FALSE(pReader->NextChunk(&Chunk));
+	};
+	for(int t = 0; t <= 40; t++)
+		ExpectSeek(&Reader, t);
+	EXPECT_FALSE(Reader.SeekTick(41));
+
+	// the position before the first chunk of the tick, tick 14 is skipped
+	ASSERT_TRUE(Reader.SeekTick(15));
+	int X, Y;
+	ASSERT_TRUE(Reader.PlayerPosition(1, &X, &Y));
+	EXPECT_EQ(X, 113);
+	EXPECT_FALSE(Reader.PlayerPosition(2, &X, &Y));
+
+	int Start, End;
+	ASSERT_TRUE(Reader.ActiveRange(1, 0, &Start, &End));
+	EXPECT_LE(Start, 10);
+	EXPECT_GE(End, 21);
+	EXPECT_LE(End, 25);
+	EXPECT_FALSE(Reader.ActiveRange(1, End, &Start, &End));
+	ASSERT_TRUE(Reader.ActiveRange(0, 5, &Start, &End));
+	EXPECT_EQ(Start, 5);
+	EXPECT_EQ(End, -1);
+	EXPECT_FALSE(Reader.ActiveRange(2, 0, &Start, &End));
+
+	CTestInfo Info;
+	IOHANDLE File = io_open(Info.m_aFilename, IOFLAG_WRITE);
+	ASSERT_TRUE(File);
+	ASSERT_TRUE(Reader.SaveIndex(File));
+	io_close(File);
+
+	CTeeHistorianReader Loaded;
+	ASSERT_TRUE(Loaded.Load(m_vBuffer.data(), m_vBuffer.size()));
+	File = io_open(Info.m_aFilename, IOFLAG_READ);
+	ASSERT_TRUE(File);
+	EXPECT_TRUE(Loaded.LoadIndex(File));
+	io_close(File);
+	for(int t = 0; t <= 40; t++)
+		ExpectSeek(&Loaded, t);
+
+	// the index doesn't belong to a different file
+	ASSERT_TRUE(Loaded.Load(m_vBuffer.data(), m_vBuffer.size() - 1));
+	File = io_open(Info.m_aFilename, IOFLAG_READ);
+	ASSERT_TRUE(File);
+	EXPECT_FALSE(Loaded.LoadIndex(File));
+	io_close(File);
+	EXPECT_FALSE(Loaded.HasIndex());
+	fs_remove(Info.m_aFilename);
+}
+
+TEST_F(TeeHistorian, ReaderCompressedIndex)
+{
+	// more data than the reader keeps in memory
+	CNetObj_PlayerInput Input = {};
+	for(int t = 1; t <= 2000; t++)
+	{
+		Tick(t);
+		for(int ClientId = 0; ClientId < 16; ClientId++)
+		{
+			if((t / 100 + ClientId) % 5 == 0)
+				DeadPlayer(ClientId);
+			else
+				Player(ClientId, t * (ClientId + 1), t % (ClientId + 7));
+		}
+		Inputs();
+		for(int ClientId = 0; ClientId < 16; ClientId++)
+		{
+			Input.m_Direction = (t + ClientId) % 3 - 1;
+			Input.m_TargetX = t * ClientId;
+			m_TH.RecordPlayerInput(ClientId, 1, &Input);
+		}
+	}
+	Finish();
+	ASSERT_GT(m_vBuffer.size(), 256u * 1024u);
+
+	// full flushes every 16 KiB like the server's flush points
+	std::vector<unsigned char> vCompressed(m_vBuffer.size() + 1024);
+	z_stream Stream;
+	mem_zero(&Stream, sizeof(Stream));
+	ASSERT_EQ(deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+	Stream.next_out = vCompressed.data();
+	Stream.avail_out = vCompressed.size();
+	for(size_t Offset = 0; Offset < m_vBuffer.size(); Offset += 16 * 1024)
+	{
+		Stream.next_in = m_vBuffer.data() + Offset;
+		Stream.avail_in = std::min<size_t>(16 * 1024, m_vBuffer.size() - Offset);
+		const bool Last = Offset + Stream.avail_in == m_vBuffer.size();
+		ASSERT_EQ(deflate(&Stream, Last ? Z_FINISH : Z_FULL_FLUSH), Last ? Z_STREAM_END : Z_OK);
+	}
+	vCompressed.resize(Stream.total_out);
+	deflateEnd(&Stream);
+
+	CTeeHistorianReader Reader;
+	ASSERT_TRUE(Reader.Load(m_vBuffer.data(), m_vBuffer.size()));
+	std::vector<CTeeHistorianReader::CChunk> vChunks;
+	CTeeHistorianReader::CChunk Chunk;
+	while(Reader.NextChunk(&Chunk))
+		vChunks.push_back(Chunk);
+	ASSERT_STREQ(Reader.Error(), "");
+
+	CTeeHistorianReader Compressed;
+	ASSERT_TRUE(Compressed.Load(vCompressed.data(), vCompressed.size())) << Compressed.Error();
+	ASSERT_TRUE(Compressed.BuildIndex(50)) << Compressed.Error();
+	EXPECT_GT(Compressed.NumRestartPoints(), (int)(m_vBuffer.size() / (16 * 1024)) / 2);
+
+	auto ExpectSeek = [&](CTeeHistorianReader *pReader, int Tick) {
+		ASSERT_TRUE(pReader->SeekTick(Tick)) << Tick;
+		size_t First = 0;
+		while(vChunks[First].m_Tick < Tick)
+			First++;
+		for(size_t i = First; i < std::min(vChunks.size(), First + 100); i++)
+		{
+			ASSERT_TRUE(pReader->NextChunk(&Chunk)) << Tick << " " << pReader->Error();
+			ASSERT_EQ(Chunk.m_Type, vChunks[i].m_Type) << Tick;
+			ASSERT_EQ(Chunk.m_Tick, vChunks[i].m_Tick) << Tick;
+			ASSERT_EQ(Chunk.m_ClientId, vChunks[i].m_ClientId) << Tick;
+			if(Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_DIFF)
+			{
+				EXPECT_EQ(Chunk.m_X, vChunks[i].m_X) << Tick;
+				EXPECT_EQ(Chunk.m_Y, vChunks[i].m_Y) << Tick;
+			}
+			if(Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_DIFF)
+			{
+				EXPECT_EQ(Chunk.m_Input.m_TargetX, vChunks[i].m_Input.m_TargetX) << Tick;
+			}
+		}
+	};
+	// backwards and forwards, within and outside of the reader's window
+	for(int Tick : {1999, 1500, 1, 17, 1000, 1001, 740, 2000, 3})
+		ExpectSeek(&Compressed, Tick);
+
+	CTestInfo Info;
+	IOHANDLE File = io_open(Info.m_aFilename, IOFLAG_WRITE);
+	ASSERT_TRUE(File);
+	ASSERT_TRUE(Compressed.SaveIndex(File));
+	io_close(File);
+
+	CTeeHistorianReader Loaded;
+	ASSERT_TRUE(Loaded.Load(vCompressed.data(), vCompressed.size()));
+	File = io_open(Info.m_aFilename, IOFLAG_READ);
+	ASSERT_TRUE(File);
+	EXPECT_TRUE(Loaded.LoadIndex(File));
+	io_close(File);
+	EXPECT_EQ(Loaded.NumRestartPoints(), Compressed.NumRestartPoints());
+	for(int Tick : {1200, 600, 1999})
+		ExpectSeek(&Loaded, Tick);
+
+	// the index of the compressed file doesn't belong to the uncompressed one
+	File = io_open(Info.m_aFilename, IOFLAG_READ);
+	ASSERT_TRUE(File);
+	EXPECT_FALSE(Reader.LoadIndex(File));
+	io_close(File);
+	fs_remove(Info.m_aFilename);
+}
@@ -6,6 +6,46 @@
 #include <engine/storage.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <new>
+
+static thread_local size_t gs_NumAllocations = 0;
+
+size_t NumAllocations()
+{
+	return gs_NumAllocations;
+}
+
+// count the allocations of all tests, the default versions of the other
+// `new` and `delete` operators go through these
+void *operator new(size_t Size)
+{
+	gs_NumAllocations++;
+	void *pMemory = malloc(Size ? Size : 1);
+	dbg_assert(pMemory != nullptr, "out of memory");
+	return pMemory;
+}
+
+void *operator new(size_t Size, const std::nothrow_t &) noexcept
+{
+	gs_NumAllocations++;
+	return malloc(Size ? Size : 1);
+}
+
+void operator delete(void *pMemory) noexcept
+{
+	free(pMemory);
+}
+
+void operator delete(void *pMemory, size_t Size) noexcept
+{
+	free(pMemory);
+}
+
+void operator delete(void *pMemory, const std::nothrow_t &) noexcept
+{
+	free(pMemory);
+}
 
 CTestInfo::CTestInfo()
 {
@@ -16,4 +16,7 @@ public:
 	char m_aFilenamePrefix[128];
 	char m_aFilename[128];
 };
+
+// Number of allocations with `new` the calling thread did so far
+size_t NumAllocations();
 #endif // TEST_TEST_H
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <engine/server/tick_profiler.h>
+
+TEST(TickProfiler, Stats)
+{
+	CTickProfiler Profiler;
+	EXPECT_EQ(Profiler.Stats(CTickProfiler::PHASE_SNAPSHOT).m_NumSamples, 0);
+
+	for(int i = 1; i <= 100; i++)
+		Profiler.Add(CTickProfiler::PHASE_SNAPSHOT, i * 1000);
+
+	const CTickProfiler::CStats Stats = Profiler.Stats(CTickProfiler::PHASE_SNAPSHOT);
+	EXPECT_EQ(Stats.m_NumSamples, 100);
+	EXPECT_EQ(Stats.m_P50, 50000);
+	EXPECT_EQ(Stats.m_P99, 99000);
+	EXPECT_EQ(Stats.m_Max, 100000);
+	EXPECT_EQ(Profiler.Stats(CTickProfiler::PHASE_NETWORK).m_NumSamples, 0);
+}
+
+TEST(TickProfiler, RollingWindow)
+{
+	CTickProfiler Profiler;
+	Profiler.Add(CTickProfiler::PHASE_GAME_TICK, 1000000000);
+	for(int i = 0; i < CTickProfiler::WINDOW_SIZE; i++)
+		Profiler.Add(CTickProfiler::PHASE_GAME_TICK, 1000);
+
+	// the slow sample dropped out of the window
+	const CTickProfiler::CStats Stats = Profiler.Stats(CTickProfiler::PHASE_GAME_TICK);
+	EXPECT_EQ(Stats.m_NumSamples, CTickProfiler::WINDOW_SIZE);
+	EXPECT_EQ(Stats.m_Max, 1000);
+}
+
+TEST(TickProfiler, Histogram)
+{
+	CTickProfiler Profiler;
+	Profiler.Add(CTickProfiler::PHASE_INPUT, 500); // 0.5us
+	Profiler.Add(CTickProfiler::PHASE_INPUT, 3000); // 3us
+	Profiler.Add(CTickProfiler::PHASE_INPUT, 3999);
+	Profiler.Add(CTickProfiler::PHASE_INPUT, 1000000000); // 1s
+
+	int aBuckets[CTickProfiler::NUM_BUCKETS];
+	Profiler.Histogram(CTickProfiler::PHASE_INPUT, aBuckets);
+	EXPECT_EQ(aBuckets[0], 1);
+	EXPECT_EQ(aBuckets[1], 2);
+	EXPECT_EQ(aBuckets[CTickProfiler::NUM_BUCKETS - 1], 1);
+}
+
+TEST(TickProfiler, Overruns)
+{
+	CTickProfiler Profiler;
+	Profiler.AddTick(10000000, 20000000, 1);
+	Profiler.AddTick(30000000, 20000000, 3);
+	EXPECT_EQ(Profiler.NumTicks(), 4);
+	EXPECT_EQ(Profiler.NumOverruns(), 1);
+	EXPECT_EQ(Profiler.NumLateTicks(), 2);
+	EXPECT_EQ(Profiler.Stats(CTickProfiler::PHASE_TICK).m_NumSamples, 2);
+
+	Profiler.Reset();
+	EXPECT_EQ(Profiler.NumTicks(), 0);
+	EXPECT_EQ(Profiler.Stats(CTickProfiler::PHASE_TICK).m_NumSamples, 0);
+}
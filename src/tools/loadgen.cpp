@@ -0,0 +1,817 @@
+#include <base/logger.h>
+#include <base/system.h>
+
+#include <engine/shared/compression.h>
+#include <engine/shared/config.h>
+#include <engine/shared/network.h>
+#include <engine/shared/packer.h>
+#include <engine/shared/protocol.h>
+#include <engine/shared/protocol_ex.h>
+#include <engine/shared/snapshot.h>
+#include <engine/shared/teehistorian_reader.h>
+#include <engine/shared/uuid_manager.h>
+#include <engine/storage.h>
+
+#include <game/generated/protocol.h>
+#include <game/prng.h>
+#include <game/version.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static const char *TOOL_NAME = "loadgen";
+
+enum
+{
+	PATTERN_IDLE = 0,
+	PATTERN_RUN,
+	PATTERN_RANDOM,
+	PATTERN_TEEHISTORIAN,
+};
+
+static const char *const s_apPatternNames[] = {"idle", "run", "random"};
+
+// the inputs of the players of a teehistorian file, read in step with the
+// server's ticks and started over at the end of the file
+class CRecordedInputs
+{
+	CTeeHistorianReader m_Reader;
+	// recorded clients that sent inputs
+	std::vector<int> m_vClientIds;
+	CNetObj_PlayerInput m_aInputs[MAX_CLIENTS] = {};
+	int m_FirstTick = 0;
+	int m_Tick = 0;
+	CTeeHistorianReader::CChunk m_Chunk;
+	bool m_HaveChunk = false;
+
+public:
+	bool Load(IStorage *pStorage, const char *pFilename)
+	{
+		if(!m_Reader.Open(pStorage, pFilename, IStorage::TYPE_ALL_OR_ABSOLUTE) || !m_Reader.BuildIndex(10 * SERVER_TICK_SPEED))
+		{
+			log_error(TOOL_NAME, "failed to read '%s': %s", pFilename, m_Reader.Error());
+			return false;
+		}
+		m_FirstTick = std::numeric_limits<int>::max();
+		for(int ClientId = 0; ClientId < MAX_CLIENTS; ClientId++)
+		{
+			int Start;
+			int End;
+			if(!m_Reader.ActiveRange(ClientId, 0, &Start, &End))
+				continue;
+			m_vClientIds.push_back(ClientId);
+			m_FirstTick = std::min(m_FirstTick, Start);
+		}
+		if(m_vClientIds.empty())
+		{
+			log_error(TOOL_NAME, "'%s' contains no players", pFilename);
+			return false;
+		}
+		log_info(TOOL_NAME, "replaying the inputs of %d recorded players", (int)m_vClientIds.size());
+		return Restart();
+	}
+
+	bool Restart()
+	{
+		m_HaveChunk = false;
+		m_Tick = m_FirstTick;
+		return m_Reader.SeekTick(m_FirstTick);
+	}
+
+	// reads the inputs recorded up to the next tick
+	void Tick()
+	{
+		m_Tick++;
+		while(true)
+		{
+			if(!m_HaveChunk && !m_Reader.NextChunk(&m_Chunk))
+			{
+				if(m_Reader.Error()[0])
+					log_error(TOOL_NAME, "failed to read the teehistorian file: %s", m_Reader.Error());
+				else if(!Restart())
+					log_error(TOOL_NAME, "failed to restart the teehistorian file: %s", m_Reader.Error());
+				return;
+			}
+			m_HaveChunk = true;
+			// an input recorded in a tick is used in the next one
+			if(m_Chunk.m_Tick >= m_Tick)
+				return;
+			if(m_Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_NEW || m_Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_DIFF)
+				m_aInputs[m_Chunk.m_ClientId] = m_Chunk.m_Input;
+			m_HaveChunk = false;
+		}
+	}
+
+	// simulated client `Index` plays the `Index`-th recorded player
+	const CNetObj_PlayerInput &Input(int Index) const { return m_aInputs[m_vClientIds[Index % m_vClientIds.size()]]; }
+};
+
+// a simulated player speaking the 0.6 protocol, only keeping the state needed
+// to take part in the game: snapshot deltas are unpacked and acked like a
+// real client does, everything else the server sends is ignored
+class CLoadClient
+{
+public:
+	enum
+	{
+		STATE_CONNECTING = 0,
+		STATE_LOADING,
+		STATE_INGAME,
+		STATE_DROPPED,
+	};
+
+	int m_Index;
+	int m_State = STATE_CONNECTING;
+	CNetClient m_NetClient;
+	bool m_Online = false;
+
+	CSnapshotDelta *m_pSnapshotDelta;
+	CSnapshotStorage m_SnapshotStorage;
+	int m_AckGameTick = -1;
+	int m_CurrentRecvTick = 0;
+	uint64_t m_SnapshotParts = 0;
+	int m_SnapshotIncomingDataSize = 0;
+	char m_aSnapshotIncomingData[CSnapshot::MAX_SIZE];
+	int m_LastSnapTick = -1;
+	int64_t m_LastSnapTime = 0;
+
+	int m_Pattern;
+	const CRecordedInputs *m_pRecordedInputs = nullptr;
+	// watches the game from the spectators instead of playing
+	bool m_Spectator = false;
+	int64_t m_NextSpectateTime = 0;
+	CPrng m_Prng;
+	CNetObj_PlayerInput m_Input = {};
+	int m_InputTick = 0;
+	int64_t m_NextInputTime = 0;
+
+	bool m_RconAuthed = false;
+	bool m_PrintRconLines = false;
+
+	// statistics of the measurement period
+	int64_t m_RecvBytes = 0;
+	int64_t m_SentBytes = 0;
+	std::vector<int> m_vSnapSizes;
+	std::vector<int> m_vUnpackedSnapSizes;
+	std::vector<int64_t> m_vSnapIntervals;
+	int m_NumSnapCrcErrors = 0;
+
+	CLoadClient(int Index, CSnapshotDelta *pSnapshotDelta, int Pattern, uint64_t Seed) :
+		m_Index(Index), m_pSnapshotDelta(pSnapshotDelta), m_Pattern(Pattern)
+	{
+		uint64_t aSeed[2] = {Seed, (uint64_t)Index};
+		m_Prng.Seed(aSeed);
+	}
+
+	void ResetStats()
+	{
+		m_RecvBytes = 0;
+		m_SentBytes = 0;
+		m_vSnapSizes.clear();
+		m_vUnpackedSnapSizes.clear();
+		m_vSnapIntervals.clear();
+		m_NumSnapCrcErrors = 0;
+	}
+
+	void SendMsg(CMsgPacker *pMsg, int Flags)
+	{
+		CPacker Packer;
+		Packer.Reset();
+		if(pMsg->m_MsgId < OFFSET_UUID)
+		{
+			Packer.AddInt((pMsg->m_MsgId << 1) | (pMsg->m_System ? 1 : 0));
+		}
+		else
+		{
+			Packer.AddInt(pMsg->m_System ? 1 : 0); // NETMSG_EX, NETMSGTYPE_EX
+			g_UuidManager.PackUuid(pMsg->m_MsgId, &Packer);
+		}
+		Packer.AddRaw(pMsg->Data(), pMsg->Size());
+
+		CNetChunk Packet;
+		mem_zero(&Packet, sizeof(Packet));
+		Packet.m_ClientId = 0;
+		Packet.m_pData = Packer.Data();
+		Packet.m_DataSize = Packer.Size();
+		if(Flags & MSGFLAG_VITAL)
+			Packet.m_Flags |= NETSENDFLAG_VITAL;
+		if(Flags & MSGFLAG_FLUSH)
+			Packet.m_Flags |= NETSENDFLAG_FLUSH;
+		m_NetClient.Send(&Packet);
+		m_SentBytes += Packet.m_DataSize;
+	}
+
+	void SendInfo(const char *pPassword)
+	{
+		CMsgPacker MsgVer(NETMSG_CLIENTVER, true);
+		const CUuid ConnectionId = RandomUuid();
+		MsgVer.AddRaw(&ConnectionId, sizeof(ConnectionId));
+		MsgVer.AddInt(DDNET_VERSION_NUMBER);
+		MsgVer.AddString(GAME_NAME " " GAME_RELEASE_VERSION " (loadgen)");
+		SendMsg(&MsgVer, MSGFLAG_VITAL);
+
+		CMsgPacker Msg(NETMSG_INFO, true);
+		Msg.AddString(GAME_NETVERSION);
+		Msg.AddString(pPassword);
+		SendMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+	}
+
+	void SendStartInfo()
+	{
+		char aName[16];
+		str_format(aName, sizeof(aName), "loadgen %d", m_Index);
+		CNetMsg_Cl_StartInfo StartInfo;
+		StartInfo.m_pName = aName;
+		StartInfo.m_pClan = "";
+		StartInfo.m_Country = -1;
+		StartInfo.m_pSkin = "default";
+		StartInfo.m_UseCustomColor = 0;
+		StartInfo.m_ColorBody = 0;
+		StartInfo.m_ColorFeet = 0;
+		CMsgPacker Msg(&StartInfo);
+		StartInfo.Pack(&Msg);
+		SendMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+
+		CMsgPacker MsgEnter(NETMSG_ENTERGAME, true);
+		SendMsg(&MsgEnter, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+	}
+
+	void RconAuth(const char *pPassword)
+	{
+		CMsgPacker Msg(NETMSG_RCON_AUTH, true);
+		Msg.AddString("");
+		Msg.AddString(pPassword);
+		Msg.AddInt(0); // no command list
+		SendMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+	}
+
+	void Rcon(const char *pCommand)
+	{
+		CMsgPacker Msg(NETMSG_RCON_CMD, true);
+		Msg.AddString(pCommand);
+		SendMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+	}
+
+	int Random(int Max) { return m_Prng.RandomBits() % Max; }
+
+	void Spectate()
+	{
+		// the server ignores it while the client is a spectator already
+		CNetMsg_Cl_SetTeam SetTeam;
+		SetTeam.m_Team = TEAM_SPECTATORS;
+		CMsgPacker MsgTeam(&SetTeam);
+		SetTeam.Pack(&MsgTeam);
+		SendMsg(&MsgTeam, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+
+		// look around freely or follow one of the clients connected before
+		CNetMsg_Cl_SetSpectatorMode SpectatorMode;
+		SpectatorMode.m_SpectatorId = m_Index == 0 || Random(2) == 0 ? SPEC_FREEVIEW : Random(m_Index);
+		CMsgPacker MsgMode(&SpectatorMode);
+		SpectatorMode.Pack(&MsgMode);
+		SendMsg(&MsgMode, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+	}
+
+	void UpdateInput()
+	{
+		// jumping and firing only trigger on a change
+		m_Input.m_Jump = 0;
+		m_Input.m_Fire &= ~1;
+		m_Input.m_PlayerFlags = PLAYERFLAG_PLAYING;
+
+		switch(m_Pattern)
+		{
+		case PATTERN_IDLE:
+			m_Input.m_TargetX = 100;
+			m_Input.m_TargetY = 0;
+			break;
+		case PATTERN_RUN:
+			if(m_InputTick % (4 * SERVER_TICK_SPEED) == 0)
+				m_Input.m_Direction = m_Input.m_Direction == 1 ? -1 : 1;
+			m_Input.m_Jump = m_InputTick % SERVER_TICK_SPEED == 0;
+			m_Input.m_TargetX = 100 * m_Input.m_Direction;
+			m_Input.m_TargetY = -50;
+			break;
+		case PATTERN_TEEHISTORIAN:
+			m_Input = m_pRecordedInputs->Input(m_Index);
+			break;
+		case PATTERN_RANDOM:
+			if(Random(SERVER_TICK_SPEED / 2) == 0)
+				m_Input.m_Direction = Random(3) - 1;
+			if(Random(SERVER_TICK_SPEED) == 0)
+				m_Input.m_Jump = 1;
+			if(Random(SERVER_TICK_SPEED / 2) == 0)
+				m_Input.m_Hook = !m_Input.m_Hook;
+			if(Random(SERVER_TICK_SPEED) == 0)
+				m_Input.m_Fire = (m_Input.m_Fire + 1) | 1;
+			if(Random(SERVER_TICK_SPEED / 5) == 0)
+			{
+				m_Input.m_TargetX = Random(401) - 200;
+				m_Input.m_TargetY = Random(401) - 200;
+			}
+			break;
+		}
+		if(m_Spectator)
+		{
+			// the free view of a spectator is at the target, anywhere in
+			// and around the map
+			m_Input.m_PlayerFlags = 0;
+			if(Random(SERVER_TICK_SPEED) == 0)
+			{
+				m_Input.m_TargetX = Random(300 * 32) - 50 * 32;
+				m_Input.m_TargetY = Random(200 * 32) - 50 * 32;
+			}
+		}
+		m_InputTick++;
+	}
+
+	void SendInput(int64_t Now)
+	{
+		UpdateInput();
+
+		// aim slightly ahead of the server like a client with low latency
+		const int PredTick = m_LastSnapTick + (Now - m_LastSnapTime) * SERVER_TICK_SPEED / time_freq() + 2;
+
+		CMsgPacker Msg(NETMSG_INPUT, true);
+		Msg.AddInt(m_AckGameTick);
+		Msg.AddInt(PredTick);
+		Msg.AddInt(sizeof(m_Input));
+		const int *pData = (const int *)&m_Input;
+		for(size_t i = 0; i < sizeof(m_Input) / sizeof(int); i++)
+			Msg.AddInt(pData[i]);
+		SendMsg(&Msg, MSGFLAG_FLUSH);
+	}
+
+	void OnSnapshot(int Msg, CUnpacker *pUnpacker, int64_t Now, bool Measure)
+	{
+		const int GameTick = pUnpacker->GetInt();
+		const int DeltaTick = GameTick - pUnpacker->GetInt();
+
+		int NumParts = 1;
+		int Part = 0;
+		if(Msg == NETMSG_SNAP)
+		{
+			NumParts = pUnpacker->GetInt();
+			Part = pUnpacker->GetInt();
+		}
+
+		unsigned int Crc = 0;
+		int PartSize = 0;
+		if(Msg != NETMSG_SNAPEMPTY)
+		{
+			Crc = pUnpacker->GetInt();
+			PartSize = pUnpacker->GetInt();
+		}
+
+		const char *pData = (const char *)pUnpacker->GetRaw(PartSize);
+		if(pUnpacker->Error() || NumParts < 1 || NumParts > CSnapshot::MAX_PARTS || Part < 0 || Part >= NumParts || PartSize < 0 || PartSize > MAX_SNAPSHOT_PACKSIZE)
+			return;
+		if(GameTick < m_CurrentRecvTick || GameTick <= m_AckGameTick)
+			return;
+
+		if(GameTick != m_CurrentRecvTick)
+		{
+			m_SnapshotParts = 0;
+			m_CurrentRecvTick = GameTick;
+			m_SnapshotIncomingDataSize = 0;
+		}
+
+		mem_copy(m_aSnapshotIncomingData + Part * MAX_SNAPSHOT_PACKSIZE, pData, std::clamp(PartSize, 0, (int)sizeof(m_aSnapshotIncomingData) - Part * MAX_SNAPSHOT_PACKSIZE));
+		m_SnapshotParts |= (uint64_t)1 << Part;
+		if(Part == NumParts - 1)
+			m_SnapshotIncomingDataSize = (NumParts - 1) * MAX_SNAPSHOT_PACKSIZE + PartSize;
+
+		if(!((NumParts < CSnapshot::MAX_PARTS && m_SnapshotParts == (((uint64_t)1 << NumParts) - 1)) ||
+			   (NumParts == CSnapshot::MAX_PARTS && m_SnapshotParts == std::numeric_limits<uint64_t>::max())))
+			return;
+		m_SnapshotParts = 0;
+
+		const CSnapshot *pDeltaShot = CSnapshot::EmptySnapshot();
+		if(DeltaTick >= 0 && m_SnapshotStorage.Get(DeltaTick, nullptr, &pDeltaShot, nullptr) < 0)
+		{
+			// lost the delta base, make the server resync
+			m_AckGameTick = -1;
+			return;
+		}
+
+		unsigned char aDeltaData[CSnapshot::MAX_SIZE];
+		const void *pDeltaData = m_pSnapshotDelta->EmptyDelta();
+		int DeltaSize = sizeof(int) * 3;
+		if(m_SnapshotIncomingDataSize)
+		{
+			DeltaSize = CVariableInt::Decompress(m_aSnapshotIncomingData, m_SnapshotIncomingDataSize, aDeltaData, sizeof(aDeltaData));
+			if(DeltaSize < 0)
+				return;
+			pDeltaData = aDeltaData;
+		}
+
+		unsigned char aSnap[CSnapshot::MAX_SIZE];
+		CSnapshot *pSnap = (CSnapshot *)aSnap;
+		const int SnapSize = m_pSnapshotDelta->UnpackDelta(pDeltaShot, pSnap, pDeltaData, DeltaSize, false);
+		if(SnapSize < 0 || !pSnap->IsValid(SnapSize))
+			return;
+		if(Msg != NETMSG_SNAPEMPTY && pSnap->Crc() != Crc)
+		{
+			if(Measure)
+				m_NumSnapCrcErrors++;
+			m_AckGameTick = -1;
+			return;
+		}
+
+		m_SnapshotStorage.PurgeUntil(std::min(DeltaTick, m_AckGameTick));
+		m_SnapshotStorage.Add(GameTick, Now, SnapSize, pSnap, 0, nullptr);
+
+		if(Measure)
+		{
+			m_vSnapSizes.push_back(m_SnapshotIncomingDataSize);
+			m_vUnpackedSnapSizes.push_back(SnapSize);
+			if(m_LastSnapTick >= 0)
+				m_vSnapIntervals.push_back(Now - m_LastSnapTime);
+		}
+		m_AckGameTick = GameTick;
+		m_LastSnapTick = GameTick;
+		m_LastSnapTime = Now;
+	}
+
+	void OnPacket(CNetChunk *pPacket, int64_t Now, bool Measure)
+	{
+		if(Measure)
+			m_RecvBytes += pPacket->m_DataSize;
+
+		CUnpacker Unpacker;
+		Unpacker.Reset(pPacket->m_pData, pPacket->m_DataSize);
+		CMsgPacker Packer(NETMSG_EX, true);
+		int Msg;
+		bool Sys;
+		CUuid Uuid;
+		const int Result = UnpackMessageId(&Msg, &Sys, &Uuid, &Unpacker, &Packer);
+		if(Result == UNPACKMESSAGE_ERROR)
+			return;
+		else if(Result == UNPACKMESSAGE_ANSWER)
+			SendMsg(&Packer, MSGFLAG_VITAL);
+
+		// game messages are of no interest
+		if(!Sys)
+			return;
+
+		const bool Vital = (pPacket->m_Flags & NET_CHUNKFLAG_VITAL) != 0;
+		if(Msg == NETMSG_MAP_CHANGE && Vital)
+		{
+			// the map is never loaded, the server doesn't check that
+			m_State = STATE_LOADING;
+			m_AckGameTick = -1;
+			m_SnapshotStorage.PurgeAll();
+			CMsgPacker MsgReady(NETMSG_READY, true);
+			SendMsg(&MsgReady, MSGFLAG_VITAL | MSGFLAG_FLUSH);
+		}
+		else if(Msg == NETMSG_CON_READY && Vital)
+		{
+			SendStartInfo();
+			m_State = STATE_INGAME;
+		}
+		else if(Msg == NETMSG_SNAP || Msg == NETMSG_SNAPSINGLE || Msg == NETMSG_SNAPEMPTY)
+		{
+			if(m_State == STATE_INGAME)
+				OnSnapshot(Msg, &Unpacker, Now, Measure);
+		}
+		else if(Msg == NETMSG_PING)
+		{
+			CMsgPacker MsgPong(NETMSG_PING_REPLY, true);
+			SendMsg(&MsgPong, MSGFLAG_FLUSH);
+		}
+		else if(Msg == NETMSG_RCON_AUTH_STATUS)
+		{
+			m_RconAuthed = Unpacker.GetInt() != 0 && !Unpacker.Error();
+			if(!m_RconAuthed)
+				log_error(TOOL_NAME, "rcon authentication failed");
+		}
+		else if(Msg == NETMSG_RCON_LINE && Vital && m_PrintRconLines)
+		{
+			const char *pLine = Unpacker.GetString();
+			if(!Unpacker.Error())
+				log_info(TOOL_NAME, "server: %s", pLine);
+		}
+	}
+
+	void Update(int64_t Now, bool Measure, const char *pPassword)
+	{
+		if(m_State == STATE_DROPPED)
+			return;
+
+		m_NetClient.Update();
+		const int NetState = m_NetClient.State();
+		if(NetState == NETSTATE_ONLINE && !m_Online)
+		{
+			m_Online = true;
+			SendInfo(pPassword);
+		}
+		else if(NetState == NETSTATE_OFFLINE)
+		{
+			log_error(TOOL_NAME, "client %d dropped: %s", m_Index, m_NetClient.ErrorString());
+			m_State = STATE_DROPPED;
+			return;
+		}
+
+		CNetChunk Packet;
+		SECURITY_TOKEN ResponseToken;
+		while(m_NetClient.Recv(&Packet, &ResponseToken, false))
+		{
+			if(Packet.m_ClientId != -1)
+				OnPacket(&Packet, Now, Measure);
+		}
+
+		if(m_State == STATE_INGAME && m_Spectator && Now >= m_NextSpectateTime)
+		{
+			Spectate();
+			m_NextSpectateTime = Now + 2 * time_freq();
+		}
+
+		if(m_State == STATE_INGAME && m_LastSnapTick >= 0 && Now >= m_NextInputTime)
+		{
+			SendInput(Now);
+			m_NextInputTime = std::max(m_NextInputTime + time_freq() / SERVER_TICK_SPEED, Now - time_freq());
+		}
+	}
+};
+
+template<typename T>
+static T Percentile(std::vector<T> &vValues, int Percent)
+{
+	if(vValues.empty())
+		return 0;
+	std::sort(vValues.begin(), vValues.end());
+	return vValues[(vValues.size() - 1) * Percent / 100];
+}
+
+template<typename T>
+static double Average(const std::vector<T> &vValues)
+{
+	if(vValues.empty())
+		return 0.0;
+	double Sum = 0.0;
+	for(T Value : vValues)
+		Sum += Value;
+	return Sum / vValues.size();
+}
+
+static void Report(std::vector<std::unique_ptr<CLoadClient>> &vpClients, double Seconds, const NETSTATS &Stats)
+{
+	int NumInGame = 0;
+	std::vector<int> vSnapSizes;
+	std::vector<int> vUnpackedSnapSizes;
+	std::vector<int64_t> vSnapIntervals;
+	std::vector<double> vRecvRates;
+	std::vector<double> vSentRates;
+	int NumSnapCrcErrors = 0;
+	for(auto &pClient : vpClients)
+	{
+		if(pClient->m_State != CLoadClient::STATE_INGAME)
+			continue;
+		NumInGame++;
+		vSnapSizes.insert(vSnapSizes.end(), pClient->m_vSnapSizes.begin(), pClient->m_vSnapSizes.end());
+		vUnpackedSnapSizes.insert(vUnpackedSnapSizes.end(), pClient->m_vUnpackedSnapSizes.begin(), pClient->m_vUnpackedSnapSizes.end());
+		vSnapIntervals.insert(vSnapIntervals.end(), pClient->m_vSnapIntervals.begin(), pClient->m_vSnapIntervals.end());
+		vRecvRates.push_back(pClient->m_RecvBytes / Seconds / 1024.0);
+		vSentRates.push_back(pClient->m_SentBytes / Seconds / 1024.0);
+		NumSnapCrcErrors += pClient->m_NumSnapCrcErrors;
+	}
+
+	const double MsPerTick = 1000.0 / time_freq();
+	log_info(TOOL_NAME, "clients: %d of %d in game, measured %.1fs", NumInGame, (int)vpClients.size(), Seconds);
+	log_info(TOOL_NAME, "snapshots: %d received, %d crc errors", (int)vSnapSizes.size(), NumSnapCrcErrors);
+	log_info(TOOL_NAME, "snapshot interval: avg=%.2fms p50=%.2fms p99=%.2fms max=%.2fms",
+		Average(vSnapIntervals) * MsPerTick, Percentile(vSnapIntervals, 50) * MsPerTick, Percentile(vSnapIntervals, 99) * MsPerTick, Percentile(vSnapIntervals, 100) * MsPerTick);
+	log_info(TOOL_NAME, "snapshot size compressed: avg=%.0fB p50=%dB p99=%dB max=%dB",
+		Average(vSnapSizes), Percentile(vSnapSizes, 50), Percentile(vSnapSizes, 99), Percentile(vSnapSizes, 100));
+	log_info(TOOL_NAME, "snapshot size unpacked: avg=%.0fB p50=%dB p99=%dB max=%dB",
+		Average(vUnpackedSnapSizes), Percentile(vUnpackedSnapSizes, 50), Percentile(vUnpackedSnapSizes, 99), Percentile(vUnpackedSnapSizes, 100));
+	log_info(TOOL_NAME, "payload per client in: avg=%.2fKiB/s min=%.2fKiB/s max=%.2fKiB/s",
+		Average(vRecvRates), Percentile(vRecvRates, 0), Percentile(vRecvRates, 100));
+	log_info(TOOL_NAME, "payload per client out: avg=%.2fKiB/s min=%.2fKiB/s max=%.2fKiB/s",
+		Average(vSentRates), Percentile(vSentRates, 0), Percentile(vSentRates, 100));
+	log_info(TOOL_NAME, "udp total: in %" PRIu64 " packets %.2fKiB/s, out %" PRIu64 " packets %.2fKiB/s",
+		Stats.recv_packets, Stats.recv_bytes / Seconds / 1024.0, Stats.sent_packets, Stats.sent_bytes / Seconds / 1024.0);
+}
+
+static void Usage(const char *pProgram)
+{
+	log_error(TOOL_NAME, "usage: %s [-n clients] [-t seconds] [-m idle|run|random] [-f teehistorian] [-S spectators] [-s seed] [-p password] [-r rcon_password] server[:port]", pProgram);
+	log_error(TOOL_NAME, "clients connecting to a loopback server get distinct 127.1.x.y addresses to avoid the per ip limits");
+	log_error(TOOL_NAME, "with a teehistorian file, the clients send the inputs of the recorded players instead of a pattern");
+	log_error(TOOL_NAME, "with -S, the last clients join the spectators and look around the map or follow other clients");
+	log_error(TOOL_NAME, "with an rcon password, the server's tick_profile is reset before and printed after the measurement");
+}
+
+int main(int argc, const char **argv)
+{
+	CCmdlineFix CmdlineFix(&argc, &argv);
+
+	log_set_global_logger_default();
+	if(secure_random_init() != 0)
+	{
+		log_error(TOOL_NAME, "could not initialize secure RNG");
+		return -1;
+	}
+
+	int NumClients = 8;
+	int Duration = 30;
+	int Pattern = PATTERN_RANDOM;
+	int NumSpectators = 0;
+	uint64_t Seed = 0;
+	const char *pPassword = "";
+	const char *pRconPassword = nullptr;
+	const char *pTeeHistorian = nullptr;
+	const char *pServer = nullptr;
+	for(int i = 1; i < argc; i++)
+	{
+		const bool HasValue = i + 1 < argc;
+		if(str_comp(argv[i], "-n") == 0 && HasValue)
+			NumClients = str_toint(argv[++i]);
+		else if(str_comp(argv[i], "-t") == 0 && HasValue)
+			Duration = str_toint(argv[++i]);
+		else if(str_comp(argv[i], "-S") == 0 && HasValue)
+			NumSpectators = str_toint(argv[++i]);
+		else if(str_comp(argv[i], "-s") == 0 && HasValue)
+			Seed = str_toint64_base(argv[++i]);
+		else if(str_comp(argv[i], "-p") == 0 && HasValue)
+			pPassword = argv[++i];
+		else if(str_comp(argv[i], "-r") == 0 && HasValue)
+			pRconPassword = argv[++i];
+		else if(str_comp(argv[i], "-f") == 0 && HasValue)
+			pTeeHistorian = argv[++i];
+		else if(str_comp(argv[i], "-m") == 0 && HasValue)
+		{
+			const char *pPattern = argv[++i];
+			Pattern = -1;
+			for(int p = 0; p < (int)std::size(s_apPatternNames); p++)
+			{
+				if(str_comp(pPattern, s_apPatternNames[p]) == 0)
+					Pattern = p;
+			}
+			if(Pattern < 0)
+			{
+				Usage(argv[0]);
+				return -1;
+			}
+		}
+		else if(argv[i][0] != '-' && !pServer)
+			pServer = argv[i];
+		else
+		{
+			Usage(argv[0]);
+			return -1;
+		}
+	}
+	if(!pServer || NumClients < 1 || NumClients > 65535 || Duration < 1 || NumSpectators < 0 || NumSpectators > NumClients)
+	{
+		Usage(argv[0]);
+		return -1;
+	}
+
+	std::unique_ptr<IStorage> pStorage;
+	CRecordedInputs RecordedInputs;
+	if(pTeeHistorian)
+	{
+		pStorage = std::unique_ptr<IStorage>(CreateLocalStorage());
+		if(!pStorage || !RecordedInputs.Load(pStorage.get(), pTeeHistorian))
+			return -1;
+		Pattern = PATTERN_TEEHISTORIAN;
+	}
+
+	net_init();
+	CNetBase::Init();
+	// the connections read these, there is no config manager to set the defaults
+	g_Config.m_ConnTimeout = CConfig::ms_ConnTimeout;
+	g_Config.m_ConnTimeoutProtection = CConfig::ms_ConnTimeoutProtection;
+
+	NETADDR ServerAddr;
+	if(net_host_lookup(pServer, &ServerAddr, NETTYPE_ALL))
+	{
+		log_error(TOOL_NAME, "host lookup failed");
+		return -1;
+	}
+	if(ServerAddr.port == 0)
+		ServerAddr.port = 8303;
+	const bool Loopback = ServerAddr.type == NETTYPE_IPV4 && ServerAddr.ip[0] == 127;
+
+	CNetObjHandler NetObjHandler;
+	CSnapshotDelta SnapshotDelta;
+	for(int i = 0; i < NUM_NETOBJTYPES; i++)
+		SnapshotDelta.SetStaticsize(i, NetObjHandler.GetObjSize(i));
+
+	std::vector<std::unique_ptr<CLoadClient>> vpClients;
+	for(int i = 0; i < NumClients; i++)
+	{
+		NETADDR BindAddr;
+		mem_zero(&BindAddr, sizeof(BindAddr));
+		BindAddr.type = NETTYPE_ALL;
+		if(Loopback)
+		{
+			BindAddr.type = NETTYPE_IPV4;
+			BindAddr.ip[0] = 127;
+			BindAddr.ip[1] = 1;
+			BindAddr.ip[2] = (i + 1) >> 8;
+			BindAddr.ip[3] = (i + 1) & 0xff;
+		}
+
+		vpClients.push_back(std::make_unique<CLoadClient>(i, &SnapshotDelta, Pattern, Seed));
+		vpClients.back()->m_pRecordedInputs = &RecordedInputs;
+		vpClients.back()->m_Spectator = i >= NumClients - NumSpectators;
+		if(!vpClients.back()->m_NetClient.Open(BindAddr))
+		{
+			log_error(TOOL_NAME, "could not open socket for client %d", i);
+			return -1;
+		}
+		vpClients.back()->m_NetClient.Connect(&ServerAddr, 1);
+	}
+	CLoadClient *pRconClient = vpClients[0].get();
+
+	log_info(TOOL_NAME, "connecting %d clients to %s", NumClients, pServer);
+
+	enum
+	{
+		PHASE_CONNECT = 0,
+		PHASE_MEASURE,
+		PHASE_REPORT,
+	};
+	int Phase = PHASE_CONNECT;
+	const int64_t StartTime = time_get();
+	int64_t PhaseStart = StartTime;
+	NETSTATS StartStats = {};
+	bool RconRequested = false;
+	int64_t NextRecordedTick = StartTime;
+	while(true)
+	{
+		const int64_t Now = time_get();
+		if(Pattern == PATTERN_TEEHISTORIAN && Now >= NextRecordedTick)
+		{
+			RecordedInputs.Tick();
+			NextRecordedTick = std::max(NextRecordedTick + time_freq() / SERVER_TICK_SPEED, Now - time_freq());
+		}
+		for(auto &pClient : vpClients)
+			pClient->Update(Now, Phase == PHASE_MEASURE, pPassword);
+
+		if(pRconPassword && !RconRequested && pRconClient->m_State == CLoadClient::STATE_INGAME)
+		{
+			pRconClient->RconAuth(pRconPassword);
+			RconRequested = true;
+		}
+
+		if(Phase == PHASE_CONNECT)
+		{
+			const bool AllSettled = std::all_of(vpClients.begin(), vpClients.end(), [](const std::unique_ptr<CLoadClient> &pClient) {
+				return (pClient->m_State == CLoadClient::STATE_INGAME && pClient->m_LastSnapTick >= 0) || pClient->m_State == CLoadClient::STATE_DROPPED;
+			});
+			if(AllSettled || Now - StartTime > 15 * time_freq())
+			{
+				if(!AllSettled)
+					log_error(TOOL_NAME, "not all clients entered the game in time");
+				log_info(TOOL_NAME, "measuring for %ds", Duration);
+				if(pRconClient->m_RconAuthed)
+					pRconClient->Rcon("tick_profile_reset");
+				for(auto &pClient : vpClients)
+					pClient->ResetStats();
+				net_stats(&StartStats);
+				Phase = PHASE_MEASURE;
+				PhaseStart = Now;
+			}
+		}
+		else if(Phase == PHASE_MEASURE)
+		{
+			if(Now - PhaseStart >= Duration * time_freq())
+			{
+				NETSTATS Stats;
+				net_stats(&Stats);
+				Stats.sent_packets -= StartStats.sent_packets;
+				Stats.sent_bytes -= StartStats.sent_bytes;
+				Stats.recv_packets -= StartStats.recv_packets;
+				Stats.recv_bytes -= StartStats.recv_bytes;
+				Report(vpClients, (double)(Now - PhaseStart) / time_freq(), Stats);
+
+				if(!pRconClient->m_RconAuthed)
+					break;
+				pRconClient->m_PrintRconLines = true;
+				pRconClient->Rcon("tick_profile");
+				Phase = PHASE_REPORT;
+				PhaseStart = Now;
+			}
+		}
+		else if(Phase == PHASE_REPORT)
+		{
+			if(Now - PhaseStart >= time_freq())
+				break;
+		}
+
+		std::this_thread::sleep_for(std::chrono::microseconds(500));
+	}
+
+	for(auto &pClient : vpClients)
+	{
+		pClient->m_NetClient.Disconnect("load test done");
+		pClient->m_NetClient.Close();
+	}
+	return 0;
+}
@@ -0,0 +1,178 @@
+#include <base/logger.h>
+#include <base/system.h>
+
+#include <engine/shared/csv.h>
+#include <engine/shared/teehistorian_reader.h>
+#include <engine/storage.h>
+
+#include <climits>
+#include <iterator>
+
+static const char *TOOL_NAME = "teehistorian_extract";
+// ticks between two checkpoints of the index, 10 seconds
+static const int INDEX_INTERVAL = 500;
+
+static bool LoadOrBuildIndex(IStorage *pStorage, CTeeHistorianReader *pReader, const char *pIndexFilename)
+{
+	IOHANDLE File = pStorage->OpenFile(pIndexFilename, IOFLAG_READ, IStorage::TYPE_ALL_OR_ABSOLUTE);
+	if(File)
+	{
+		const bool Loaded = pReader->LoadIndex(File);
+		io_close(File);
+		if(Loaded)
+			return true;
+		log_info(TOOL_NAME, "index '%s' is outdated, rebuilding it", pIndexFilename);
+	}
+
+	const int64_t StartTime = time_get_nanoseconds().count();
+	if(!pReader->BuildIndex(INDEX_INTERVAL))
+	{
+		log_error(TOOL_NAME, "failed to index the file: %s", pReader->Error());
+		return false;
+	}
+	log_info(TOOL_NAME, "indexed the file in %.3fs, restart_points=%d", (time_get_nanoseconds().count() - StartTime) / 1e9, pReader->NumRestartPoints());
+
+	File = pStorage->OpenFile(pIndexFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE_OR_ABSOLUTE);
+	if(!File || !pReader->SaveIndex(File))
+		log_warn(TOOL_NAME, "failed to write index '%s'", pIndexFilename);
+	if(File)
+		io_close(File);
+	return true;
+}
+
+static void WriteRow(IOHANDLE Output, int NumColumns, const int *pValues)
+{
+	char aaColumns[16][16];
+	const char *apColumns[16];
+	for(int i = 0; i < NumColumns; i++)
+	{
+		str_format(aaColumns[i], sizeof(aaColumns[i]), "%d", pValues[i]);
+		apColumns[i] = aaColumns[i];
+	}
+	CsvWrite(Output, NumColumns, apColumns);
+}
+
+static int Extract(IStorage *pStorage, const char *pFilename, int ClientId, bool Inputs, const char *pOutputFilename, int FirstTick, int LastTick)
+{
+	CTeeHistorianReader Reader;
+	if(!Reader.Open(pStorage, pFilename, IStorage::TYPE_ALL_OR_ABSOLUTE))
+	{
+		log_error(TOOL_NAME, "failed to open '%s': %s", pFilename, Reader.Error());
+		return -1;
+	}
+
+	char aIndexFilename[IO_MAX_PATH_LENGTH];
+	str_format(aIndexFilename, sizeof(aIndexFilename), "%s.index", pFilename);
+	if(!LoadOrBuildIndex(pStorage, &Reader, aIndexFilename))
+		return -1;
+
+	IOHANDLE Output = io_open(pOutputFilename, IOFLAG_WRITE);
+	if(!Output)
+	{
+		log_error(TOOL_NAME, "failed to open '%s' for writing", pOutputFilename);
+		return -1;
+	}
+	if(Inputs)
+	{
+		const char *apHeader[] = {"tick", "direction", "target_x", "target_y", "jump", "fire", "hook", "player_flags", "wanted_weapon", "next_weapon", "prev_weapon"};
+		CsvWrite(Output, std::size(apHeader), apHeader);
+	}
+	else
+	{
+		const char *apHeader[] = {"tick", "alive", "x", "y"};
+		CsvWrite(Output, std::size(apHeader), apHeader);
+	}
+
+	const int64_t StartTime = time_get_nanoseconds().count();
+	int64_t NumChunks = 0;
+	int64_t NumRows = 0;
+	int Start;
+	int End;
+	int Tick = FirstTick;
+	// only read the ranges of the file in which the client is present
+	while(Reader.ActiveRange(ClientId, Tick, &Start, &End) && Start <= LastTick)
+	{
+		if(!Reader.SeekTick(Start))
+			break;
+		if(!Inputs)
+		{
+			// positions are only recorded when they change
+			int aRow[4] = {Start, 0, 0, 0};
+			aRow[1] = Reader.PlayerPosition(ClientId, &aRow[2], &aRow[3]);
+			WriteRow(Output, std::size(aRow), aRow);
+			NumRows++;
+		}
+
+		CTeeHistorianReader::CChunk Chunk;
+		while(Reader.NextChunk(&Chunk))
+		{
+			NumChunks++;
+			if(Chunk.m_Tick > LastTick || (End >= 0 && Chunk.m_Tick >= End))
+				break;
+			if(Chunk.m_ClientId != ClientId)
+				continue;
+			if(Inputs && (Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_NEW || Chunk.m_Type == CTeeHistorianReader::CHUNK_INPUT_DIFF))
+			{
+				// the input is used in the next tick
+				int aRow[11] = {Chunk.m_Tick + 1};
+				mem_copy(&aRow[1], &Chunk.m_Input, sizeof(Chunk.m_Input));
+				WriteRow(Output, std::size(aRow), aRow);
+				NumRows++;
+			}
+			else if(!Inputs && (Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_NEW || Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_DIFF || Chunk.m_Type == CTeeHistorianReader::CHUNK_PLAYER_OLD))
+			{
+				const bool Alive = Chunk.m_Type != CTeeHistorianReader::CHUNK_PLAYER_OLD;
+				const int aRow[4] = {Chunk.m_Tick, Alive, Alive ? Chunk.m_X : 0, Alive ? Chunk.m_Y : 0};
+				WriteRow(Output, std::size(aRow), aRow);
+				NumRows++;
+			}
+		}
+		if(Reader.Error()[0])
+		{
+			log_error(TOOL_NAME, "failed to read '%s': %s", pFilename, Reader.Error());
+			break;
+		}
+		if(End < 0)
+			break;
+		Tick = End;
+	}
+	io_close(Output);
+
+	log_info(TOOL_NAME, "wrote %" PRId64 " rows, read %" PRId64 " chunks in %.3fs", NumRows, NumChunks, (time_get_nanoseconds().count() - StartTime) / 1e9);
+	return Reader.Error()[0] ? -1 : 0;
+}
+
+int main(int argc, const char *argv[])
+{
+	// Create storage before setting logger to avoid log messages from storage creation
+	IStorage *pStorage = CreateLocalStorage();
+
+	CCmdlineFix CmdlineFix(&argc, &argv);
+	log_set_global_logger_default();
+
+	if(!pStorage)
+	{
+		log_error(TOOL_NAME, "Error creating local storage");
+		return -1;
+	}
+
+	if(argc < 5 || argc > 7 || (str_comp(argv[3], "path") != 0 && str_comp(argv[3], "inputs") != 0))
+	{
+		log_error(TOOL_NAME, "Usage: %s <teehistorian> <client_id> path|inputs <output_csv> [first_tick] [last_tick]", TOOL_NAME);
+		log_error(TOOL_NAME, "Writes the positions or the inputs of a client to a CSV file, using an index next to the file ('.index')");
+		return -1;
+	}
+
+	const int ClientId = str_toint(argv[2]);
+	if(ClientId < 0 || ClientId >= MAX_CLIENTS)
+	{
+		log_error(TOOL_NAME, "Invalid client id %d", ClientId);
+		return -1;
+	}
+	const int FirstTick = argc > 5 ? str_toint(argv[5]) : 0;
+	const int LastTick = argc > 6 ? str_toint(argv[6]) : INT_MAX;
+
+	const int Result = Extract(pStorage, argv[1], ClientId, str_comp(argv[3], "inputs") == 0, argv[4], FirstTick, LastTick);
+	delete pStorage;
+	return Result;
+}